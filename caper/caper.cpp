@@ -13,8 +13,10 @@ using std::exit;
 #include "fastlalr.hpp"
 #include "caper_error.hpp"
 #include "caper_scanner.hpp"
+#include "caper_mapped_file.hpp"
 #include "caper_cpg.hpp"
 #include "caper_tgt.hpp"
+#include "caper_ir.hpp"
 #include "caper_generate_cpp.hpp"
 #include "caper_generate_js.hpp"
 #include "caper_generate_csharp.hpp"
@@ -29,16 +31,77 @@ using std::exit;
 #include <iostream>
 #include <iterator>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 #include <boost/filesystem/operations.hpp>
 
+struct commandline_target {
+    std::string language;
+    std::string outfile;
+};
+
 struct commandline_options {
     std::string infile;
     std::string outfile;
     std::string language;
+    std::vector<commandline_target> targets;
     std::string algorithm;
     bool        debug_parser;
+    bool        profile_parser;
+    bool        stats;
+    bool        simplify;
 };
 
+bool get_language_option(const std::string& arg, std::string& language) {
+    if (arg == "-java" || arg == "-Java") {
+        language = "Java";
+        return true;
+    }
+    if (arg == "-cs" || arg == "-CS" ||
+        arg == "-Cs" || arg == "-C#" ||
+        arg == "-CSharp" || arg == "-csharp#" ||
+        arg == "-c#") {
+        language = "C#";
+        return true;
+    }
+    if (arg == "-d" || arg == "-D") {
+        language = "D";
+        return true;
+    }
+    if (arg == "-c++" || arg == "-C++" ||
+        arg == "-cpp" || arg == "-CPP") {
+        language = "C++";
+        return true;
+    }
+    if (arg == "-js" || arg == "-JS" ||
+        arg == "-javascript" ||
+        arg == "-JavaScript" ||
+        arg == "-JAVASCRIPT") {
+        language = "JavaScript";
+        return true;
+    }
+    if (arg == "-boo" || arg == "-BOO") {
+        language = "Boo";
+        return true;
+    }
+    if (arg == "-rb" || arg == "-RB" ||
+        arg == "-ruby" || arg == "-Ruby" || arg == "-RUBY") {
+        language = "Ruby";
+        return true;
+    }
+    if (arg == "-php" || arg == "-PHP") {
+        language = "PHP";
+        return true;
+    }
+    if (arg == "-haxe" || arg == "-HAXE" || arg == "-Haxe" ||
+        arg == "-haXe" || arg == "-hx" || arg == "-HX") {
+        language = "Haxe";
+        return true;
+    }
+    return false;
+}
+
 void get_commandline_options(
     commandline_options&    cmdopt,
     int                     argc,
@@ -46,63 +109,47 @@ void get_commandline_options(
     cmdopt.language = "C++";
     cmdopt.algorithm = "lalr1";
     cmdopt.debug_parser = false;
+    cmdopt.profile_parser = false;
+    cmdopt.stats = false;
+    cmdopt.simplify = true;
 
     int state = 0;
     for (int index = 1 ; index < argc ; index++) {
         std::string arg = argv[index];
 
         if (arg[0] == '-') {
-            if (arg == "-java" || arg == "-Java") {
-                cmdopt.language = "Java";
+            // -lang, or -lang:outfile for each output
+            std::string::size_type colon = arg.find(':');
+            std::string language;
+            if (get_language_option(arg.substr(0, colon), language)) {
+                if (colon == std::string::npos) {
+                    cmdopt.language = language;
+                } else {
+                    commandline_target target;
+                    target.language = language;
+                    target.outfile = arg.substr(colon + 1);
+                    cmdopt.targets.push_back(target);
+                }
                 continue;
             }
-            if (arg == "-cs" || arg == "-CS" ||
-                arg == "-Cs" || arg == "-C#" ||
-                arg == "-CSharp" || arg == "-csharp#" ||
-                arg == "-c#") {
-                cmdopt.language = "C#";
-                continue;
-            }
-            if (arg == "-d" || arg == "-D") {
-                cmdopt.language = "D";
-                continue;
-            }
-            if (arg == "-c++" || arg == "-C++" ||
-                arg == "-cpp" || arg == "-CPP") {
-                cmdopt.language = "C++";
-                continue;
-            }
-            if (arg == "-js" || arg == "-JS" ||
-                arg == "-javascript" ||
-                arg == "-JavaScript" ||
-                arg == "-JAVASCRIPT") {
-                cmdopt.language = "JavaScript";
-                continue;
-            }
-            if (arg == "-boo" || arg == "-BOO") {
-                cmdopt.language = "Boo";
-                continue;
-            }
-            if (arg == "-rb" || arg == "-RB" ||
-                arg == "-ruby" || arg == "-Ruby" || arg == "-RUBY") {
-                cmdopt.language = "Ruby";
+            if (arg == "-lalr1") {
+                cmdopt.algorithm = "lalr1";
                 continue;
             }
-            if (arg == "-php" || arg == "-PHP") {
-                cmdopt.language = "PHP";
+            if (arg == "--debug") {
+                cmdopt.debug_parser = true;
                 continue;
             }
-            if (arg == "-haxe" || arg == "-HAXE" || arg == "-Haxe" ||
-                arg == "-haXe" || arg == "-hx" || arg == "-HX") {
-                cmdopt.language = "Haxe";
+            if (arg == "--profile") {
+                cmdopt.profile_parser = true;
                 continue;
             }
-            if (arg == "-lalr1") {
-                cmdopt.algorithm = "lalr1";
+            if (arg == "--stats") {
+                cmdopt.stats = true;
                 continue;
             }
-            if (arg == "--debug") {
-                cmdopt.debug_parser = true;
+            if (arg == "--no-simplify") {
+                cmdopt.simplify = false;
                 continue;
             }
             
@@ -126,11 +173,28 @@ void get_commandline_options(
         }
     }
 
-    if (state < 2) {
+    if (state == 2) {
+        commandline_target target;
+        target.language = cmdopt.language;
+        target.outfile = cmdopt.outfile;
+        cmdopt.targets.insert(cmdopt.targets.begin(), target);
+    }
+    if (state < 1 || cmdopt.targets.empty()) {
         std::cerr << "caper: usage: caper [-c++ | -js | -cs | -d | -java | -boo | -ruby | -php | -haxe] input_filename output_filename" << std::endl;
+        std::cerr << "       caper input_filename -lang:output_filename..." << std::endl;
         exit(1);
     }
 
+    for (size_t i = 0 ; i < cmdopt.targets.size() ; i++) {
+        for (size_t j = 0 ; j < i ; j++) {
+            if (cmdopt.targets[i].outfile == cmdopt.targets[j].outfile) {
+                std::cerr << "caper: duplicated output file '"
+                          << cmdopt.targets[i].outfile << "'" << std::endl;
+                exit(1);
+            }
+        }
+    }
+
 }
 
 int main(int argc, const char** argv) {
@@ -145,7 +209,8 @@ int main(int argc, const char** argv) {
         const std::map<std::string, Type>&,
         const std::vector<std::string>&,
         const action_map_type&,
-        const tgt::parsing_table&);
+        const tgt::parsing_table&,
+        const TableIR&);
 
     std::unordered_map<std::string, generator_type> generators;
     generators["C++"]           = generate_cpp;
@@ -158,23 +223,41 @@ int main(int argc, const char** argv) {
     generators["PHP"]           = generate_php;
     generators["Haxe"]          = generate_haxe;
 
-    std::ifstream ifs(cmdopt.infile.c_str());
-    if (!ifs) {
+    mapped_file input(cmdopt.infile);
+    if (!input.is_open()) {
         std::cerr << "caper: can't open input file '" << cmdopt.infile << "'" << std::endl;
         exit(1);
     }
 
-    std::ofstream ofs(cmdopt.outfile.c_str());
-    if (!ofs) {
-        std::cerr << "caper: can't open output file '" << cmdopt.outfile << "'" << std::endl;
-        exit(1);
+    // o͂͑傫ȃobt@ʂď
+    //   WFl[^̓XbhNOɂňĂ
+    struct output {
+        generator_type      generate;
+        std::vector<char>   buffer;
+        std::ofstream       ofs;
+        std::exception_ptr  error;
+    };
+    std::vector<output> outputs(cmdopt.targets.size());
+    for (size_t i = 0 ; i < outputs.size() ; i++) {
+        const std::string& outfile = cmdopt.targets[i].outfile;
+        outputs[i].generate = generators.at(cmdopt.targets[i].language);
+        outputs[i].buffer.resize(1 << 20);
+        outputs[i].ofs.rdbuf()->pubsetbuf(
+            &outputs[i].buffer[0], outputs[i].buffer.size());
+        outputs[i].ofs.open(outfile.c_str());
+        if (!outputs[i].ofs) {
+            std::cerr << "caper: can't open output file '" << outfile << "'" << std::endl;
+            exit(1);
+        }
     }
 
+    auto remove_output = [&](size_t i) {
+        outputs[i].ofs.close();
+        boost::filesystem::remove(cmdopt.targets[i].outfile);
+    };
+
     // cpgXLi
-    typedef std::istreambuf_iterator<char> is_iterator;
-    is_iterator b(ifs);
-    is_iterator e;
-    scanner<is_iterator> s(b, e);
+    scanner s(input.begin(), input.end());
 
     try {
         // cpgp[T
@@ -198,6 +281,9 @@ int main(int argc, const char** argv) {
         // e̎W
         GenerateOptions options;
         options.debug_parser = cmdopt.debug_parser;
+        options.profile = cmdopt.profile_parser;
+        options.stats = cmdopt.stats;
+        options.simplify = cmdopt.simplify;
 
         std::map<std::string, Type> terminal_types;
         std::map<std::string, Type> nonterminal_types;
@@ -216,6 +302,7 @@ int main(int argc, const char** argv) {
             token_id_map,
             actions,
             p.accept_value(),
+            options,
             terminal_types,
             nonterminal_types);
 
@@ -224,16 +311,66 @@ int main(int argc, const char** argv) {
         for (const auto& x: token_id_map) {
             tokens[x.second] = x.first;
         }
-        generators[cmdopt.language](
-            cmdopt.outfile,
-            ofs,
-            options,
-            terminal_types,
-            nonterminal_types,
-            tokens,
-            actions,
-            table);
 
+        // SWFl[^ʂ̒ԕ\
+        TableIR ir;
+        make_table_ir(
+            ir, options, nonterminal_types, tokens, actions, table);
+
+        // o͐悲ƂɃXbhv[ŕsĐ
+        //   WFl[^͏̌ʂǂނ
+        std::atomic<size_t> next(0);
+        auto work = [&]() {
+            for (;;) {
+                size_t i = next++;
+                if (outputs.size() <= i) { break; }
+                generator_type generate = outputs[i].generate;
+                try {
+                    generate(
+                        cmdopt.targets[i].outfile,
+                        outputs[i].ofs,
+                        options,
+                        terminal_types,
+                        nonterminal_types,
+                        tokens,
+                        actions,
+                        table,
+                        ir);
+                    outputs[i].ofs.close();
+                }
+                catch(...) {
+                    outputs[i].error = std::current_exception();
+                }
+            }
+        };
+
+        size_t threads = std::thread::hardware_concurrency();
+        std::vector<std::thread> workers;
+        for (size_t t = 1 ; t < threads && t < outputs.size() ; t++) {
+            workers.push_back(std::thread(work));
+        }
+        work();
+        for (auto& x: workers) {
+            x.join();
+        }
+
+        // so͐͏
+        int result = 0;
+        for (size_t i = 0 ; i < outputs.size() ; i++) {
+            if (!outputs[i].error) { continue; }
+            try {
+                std::rethrow_exception(outputs[i].error);
+            }
+            catch(caper_error& e) {
+                std::cerr << "caper: " << e.what() << std::endl;
+            }
+            catch(std::exception& e) {
+                std::cerr << e.what() << std::endl;
+            }
+            remove_output(i);
+            result = 1;
+        }
+        return result;
     }
     catch(caper_error& e) {
         if (e.addr <0) {
@@ -246,8 +383,9 @@ int main(int argc, const char** argv) {
                       << std::endl;
         }
 
-        ofs.close();
-        boost::filesystem::remove(cmdopt.outfile);
+        for (size_t i = 0 ; i < outputs.size() ; i++) {
+            remove_output(i);
+        }
 
         return 1;
     }
@@ -256,5 +394,4 @@ int main(int argc, const char** argv) {
         return 1;
     }
 
-    return 0;
 }
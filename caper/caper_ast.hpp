@@ -2,8 +2,11 @@
 #define CAPER_AST_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include <boost/variant.hpp>
+#include <boost/utility/string_ref.hpp>
 #include "caper_token.hpp"
 #include "fastlalr.hpp"
 
@@ -57,31 +60,53 @@ std::ostream& operator<<(std::ostream& os, const Operator& op) {
     return os;
 }
 
+////////////////////////////////////////////////////////////////
+// symbol
+//   token text is a view into the input buffer. get_symbol() interns it,
+//   so strings kept in the AST do not refer to the buffer.
+typedef boost::string_ref symbol_type;
+
+inline const std::string& intern(symbol_type s) {
+    static std::unordered_set<std::string> pool;
+    return *pool.insert(s.to_string()).first;
+}
+
 ////////////////////////////////////////////////////////////////
 // Identifier
 struct Identifier {
-    std::string s;
+    symbol_type s;
 
     Identifier() {}
-    Identifier(const std::string& as): s(as) {}
+    Identifier(symbol_type as): s(as) {}
 };
 
 ////////////////////////////////////////////////////////////////
 // Directive
 struct Directive {
-    std::string s;
+    symbol_type s;
 
     Directive() {}
-    Directive(const std::string& as) : s(as) {}
+    Directive(symbol_type as) : s(as) {}
 };
 
 ////////////////////////////////////////////////////////////////
 // TypeTag
 struct TypeTag {
-    std::string s;
+    symbol_type s;
 
     TypeTag() {}
-    TypeTag(const std::string& as) : s(as) {}
+    TypeTag(symbol_type as) : s(as) {}
+    TypeTag(const std::string& as) : s(intern(as)) {}
+};
+
+////////////////////////////////////////////////////////////////
+// String
+//   backslash escapes are kept as written
+struct String {
+    symbol_type s;
+
+    String() {}
+    String(symbol_type as) : s(as) {}
 };
 
 ////////////////////////////////////////////////////////////////
@@ -108,7 +133,7 @@ typedef std::shared_ptr<Node> node_ptr;
 ////////////////////////////////////////////////////////////////
 // value_type
 struct Value {
-    typedef boost::variant<Nil, Operator, Identifier, Directive, TypeTag, Integer, node_ptr> data_type;
+    typedef boost::variant<Nil, Operator, Identifier, Directive, TypeTag, String, Integer, node_ptr> data_type;
 
     Range       range;
     data_type   data;
@@ -153,6 +178,7 @@ struct Choise : public Node {
 
     std::string     action_name;
     elements_type   elements;
+    std::string     prec;   // %prec
 
     Choise(const Range& r, const std::string& as, const elements_type& ae)
         : Node(r), action_name(as), elements(ae) {}
@@ -258,6 +284,57 @@ struct DontUseSTLDecl : public Declaration {
     DontUseSTLDecl(const Range& r) : Declaration(r) {}
 };
 
+struct GLRDecl : public Declaration {
+    GLRDecl(const Range& r) : Declaration(r) {}
+};
+
+struct SnapshotDecl : public Declaration {
+    SnapshotDecl(const Range& r) : Declaration(r) {}
+};
+
+struct SyncDecl : public Declaration {
+    std::string     symbol;
+    std::string     merge;
+
+    SyncDecl(const Range& r, const std::string& as, const std::string& am)
+        : Declaration(r), symbol(as), merge(am) {}
+};
+
+struct LexerDecl : public Declaration {
+    std::string     name;       // empty for skipped patterns
+    std::string     pattern;
+
+    LexerDecl(const Range& r, const std::string& an, const std::string& ap)
+        : Declaration(r), name(an), pattern(ap) {}
+};
+
+struct SplitDecl : public Declaration {
+    std::string     include;
+    std::string     value_type;
+    std::string     semantic_action;
+    int             shards;
+
+    SplitDecl(const Range& r,
+              const std::string& ai,
+              const std::string& av,
+              const std::string& as,
+              int an)
+        : Declaration(r), include(ai), value_type(av), semantic_action(as),
+          shards(an) {}
+};
+
+struct TableDecl : public Declaration {
+    TableDecl(const Range& r) : Declaration(r) {}
+};
+
+struct PrecedenceDecl : public Declaration {
+    zw::gr::associativity       assoc;
+    std::vector<std::string>    names;
+
+    PrecedenceDecl(const Range& r, zw::gr::associativity aa)
+        : Declaration(r), assoc(aa) {}
+};
+
 struct Declarations : public Node {
     typedef std::vector<std::shared_ptr<Declaration>> declarations_type;
 
@@ -286,8 +363,21 @@ struct TargetTokenTraits {
 typedef zw::gr::package<Token, TokenTraits, Value>    cpg;
 typedef zw::gr::package<int, TargetTokenTraits, int>  tgt;
 
+struct LexerRule {
+    std::string     name;       // empty for skipped patterns
+    std::string     pattern;
+    int             addr = -1;
+
+    LexerRule() {}
+    LexerRule(const std::string& an, const std::string& ap, int aa)
+        : name(an), pattern(ap), addr(aa) {}
+};
+
 struct GenerateOptions {
     bool            debug_parser    = false;
+    bool            profile         = false;
+    bool            stats           = false;    // report simplification
+    bool            simplify        = true;     // simplify grammar
     std::string     token_prefix    = "token_";
     bool            external_token  = false;
     bool            allow_ebnf      = false;
@@ -297,6 +387,16 @@ struct GenerateOptions {
     bool            recovery        = false;
     std::string     recovery_token  = "error";
     std::string     smart_pointer_tag   = "";
+    bool            glr             = false;
+    bool            snapshot        = false;
+    std::string     sync_symbol     = "";
+    std::string     sync_merge      = "";
+    std::vector<LexerRule>  lexer_rules;
+    std::string     split_include   = "";   // empty: header only
+    std::string     split_value     = "";
+    std::string     split_action    = "";
+    int             split_shards    = 1;
+    bool            table           = false;    // table-driven output
 };
 
 struct Type {
@@ -346,7 +446,7 @@ std::shared_ptr<T> get_node(const value_type& v) {
 template <class T>
 const std::string& get_symbol(const value_type& v) {
     try {
-        return boost::get<T>(v.data).s;
+        return intern(boost::get<T>(v.data).s);
     }
     catch(boost::bad_get& x) {
         std::cerr << typeid(T).name() << std::endl;
@@ -146,6 +146,55 @@ void make_cpg_parser(cpg::parser& p) {
             return Value(args[0]);
         },
         "DontUseSTLDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "GLRDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "SnapshotDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "SyncDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "LexerDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "SplitDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "TableDecl", token_semicolon);
+    make_rule(
+        g, p,
+        "Declaration", 
+        [](const arguments_type& args) -> Value {
+            return Value(args[0]);
+        },
+        "PrecedenceDecl", token_semicolon);
 
     // ..%token錾
     make_rule(
@@ -287,6 +336,140 @@ void make_cpg_parser(cpg::parser& p) {
         },
         token_directive_dont_use_stl);
 
+    // ..%glr錾
+    make_rule(
+        g, p,
+        "GLRDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<GLRDecl>(range(args));
+            return Value(p);
+        },
+        token_directive_glr);
+
+    // ..%snapshot錾
+    make_rule(
+        g, p,
+        "SnapshotDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<SnapshotDecl>(range(args));
+            return Value(p);
+        },
+        token_directive_snapshot);
+
+    // ..%sync錾
+    make_rule(
+        g, p,
+        "SyncDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<SyncDecl>(
+                range(args),
+                get_symbol<Identifier>(args[1]),
+                get_symbol<Identifier>(args[2]));
+            return Value(p);
+        },
+        token_directive_sync, token_identifier, token_identifier);
+
+    // ..%lexer錾
+    make_rule(
+        g, p,
+        "LexerDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<LexerDecl>(
+                range(args),
+                get_symbol<Identifier>(args[1]),
+                get_symbol<String>(args[2]));
+            return Value(p);
+        },
+        token_directive_lexer, token_identifier, token_string);
+    make_rule(
+        g, p,
+        "LexerDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<LexerDecl>(
+                range(args),
+                "",
+                get_symbol<String>(args[1]));
+            return Value(p);
+        },
+        token_directive_lexer, token_string);
+
+    // ..%split錾
+    make_rule(
+        g, p,
+        "SplitDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<SplitDecl>(
+                range(args),
+                get_symbol<String>(args[1]),
+                get_symbol<String>(args[2]),
+                get_symbol<String>(args[3]),
+                1);
+            return Value(p);
+        },
+        token_directive_split, token_string, token_string, token_string);
+    make_rule(
+        g, p,
+        "SplitDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<SplitDecl>(
+                range(args),
+                get_symbol<String>(args[1]),
+                get_symbol<String>(args[2]),
+                get_symbol<String>(args[3]),
+                boost::get<Integer>(args[4].data).n);
+            return Value(p);
+        },
+        token_directive_split, token_string, token_string, token_string,
+        token_integer);
+
+    // ..%table錾
+    make_rule(
+        g, p,
+        "TableDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<TableDecl>(range(args));
+            return Value(p);
+        },
+        token_directive_table);
+
+    // ..%left/%right/%nonassoc錾
+    make_rule(
+        g, p,
+        "PrecedenceDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<PrecedenceDecl>(
+                range(args), zw::gr::assoc_left);
+            return Value(p);
+        },
+        token_directive_left);
+    make_rule(
+        g, p,
+        "PrecedenceDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<PrecedenceDecl>(
+                range(args), zw::gr::assoc_right);
+            return Value(p);
+        },
+        token_directive_right);
+    make_rule(
+        g, p,
+        "PrecedenceDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = std::make_shared<PrecedenceDecl>(
+                range(args), zw::gr::assoc_nonassoc);
+            return Value(p);
+        },
+        token_directive_nonassoc);
+    make_rule(
+        g, p,
+        "PrecedenceDecl",
+        [](const arguments_type& args) -> Value {
+            auto p = get_node<PrecedenceDecl>(args[0]);
+            p->names.push_back(get_symbol<Identifier>(args[1]));
+            return Value(p);
+        },
+        "PrecedenceDecl", token_identifier);
+
     // .@ZNV
     make_rule(
         g, p,
@@ -388,6 +571,15 @@ void make_cpg_parser(cpg::parser& p) {
             return Value(q);
         },
         "Derivation", "Term");
+    make_rule(
+        g, p,
+        "Derivation",
+        [](const arguments_type& args) -> Value {
+            auto q = get_node<Choise>(args[0]);
+            q->prec = get_symbol<Identifier>(args[2]);
+            return Value(q);
+        },
+        "Derivation", token_directive_prec, token_identifier);
 
     // ...Eӂ̍
     make_rule(
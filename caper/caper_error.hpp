@@ -104,12 +104,30 @@ public:
         : caper_error(a, fmt("unknown special identifier '%s'", m)){
     }
 };
+class nonterminal_precedence : public caper_error {
+public:
+    nonterminal_precedence(int a, const std::string& m)
+        : caper_error(a, fmt("precedence of nonterminal '%s'", m)){
+    }
+};
 class unallowed_ebnf : public caper_error {
 public:
     unallowed_ebnf(int a)
         : caper_error(a, "EBNF is not allowed, use %allow_ebnf"){
     }
 };
+class bad_regex : public caper_error {
+public:
+    bad_regex(int a, const std::string& p, const std::string& m)
+        : caper_error(a, fmt("bad regex \"%s\": %s", p, m)) {
+    }
+};
+class cant_open_output : public caper_error {
+public:
+    cant_open_output(const std::string& f)
+        : caper_error(-1, fmt("can't open output file '%s'", f)) {
+    }
+};
 
 class unsupported_feature : public caper_error {
 public:
@@ -27,11 +27,30 @@ void generate_boo(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
     if (options.allow_ebnf) {
         throw unsupported_feature("Boo", "EBNF");
     }
+    if (options.glr) {
+        throw unsupported_feature("Boo", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("Boo", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("Boo", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("Boo", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("Boo", "%split");
+    }
+    if (options.table) {
+        throw unsupported_feature("Boo", "%table");
+    }
 
     // notice / URL
     stencil(
@@ -272,8 +291,7 @@ ${access_modifier}class Parser ():
         {"first_state", table.first_state()});
 
     // states handler
-    for (tgt::parsing_table::states_type::const_iterator i = table.states().begin(); i != table.states().end(); ++i) {
-        const tgt::parsing_table::state& s = *i;
+    for (const auto& s: ir.states) {
         // gotof header
         stencil(
             os, R"(
@@ -281,48 +299,27 @@ ${access_modifier}class Parser ():
 )",
             {"num", s.no});
         // gotof dispatcher
-        std::stringstream ss;
-        //ss << "			switch(nonterminal_index)\n"
-        //   << "			{\n";
-        bool output_switch = false;
-        std::set<size_t> generated;
         bool first = true;
-        for (const auto& rule: table.get_grammar()) {
-            size_t nonterminal_index = std::distance(
-                nonterminal_types.begin(),
-                nonterminal_types.find( rule.left().name() ) );
-
-            if (generated.find( nonterminal_index ) != generated.end()) {
-                continue;
-            }
-
-            tgt::parsing_table::state::goto_table_type::const_iterator k =
-                (*i).goto_table.find(rule.left());
-
-            if (k != (*i).goto_table.end()) {
-                stencil(
-                    ss, R"(
+        for (const auto& x: s.gotos) {
+            stencil(
+                os, R"(
     ${if} nonterminal_index == ${nonterminal_index}:
 )",
-                    {"if", (first)? "if" : "elif"},
-                    {"nonterminal_index", nonterminal_index});
-                first = false;
-                stencil(
-                    ss, "      return push_stack(self.state_${next_state}, self.gotof_${next_state}, v)\n",
-                    {"next_state", (*k).second});
-                output_switch = true;
-                generated.insert( nonterminal_index );
-            }
+                {"if", (first)? "if" : "elif"},
+                {"nonterminal_index", x.first});
+            first = false;
+            stencil(
+                os, "      return push_stack(self.state_${next_state}, self.gotof_${next_state}, v)\n",
+                {"next_state", x.second});
         }
-        stencil(
-            ss, R"(
+        if (!s.gotos.empty()) {
+            stencil(
+                os, R"(
     else:
       System.Diagnostics.Debug.Assert(false)
       return false
 
 )");
-        if (output_switch) {
-            os << ss.str();
         } else {
             stencil(
                 os, R"(
@@ -339,58 +336,73 @@ ${access_modifier}class Parser ():
 )",
             {"num", s.no});
 
-        // dispatcher header
-        //os << "			switch(token)\n"
-        //   << "			{\n";
-        // action table
+        // cases (the default reduction, if any, is the last one as "else")
+        //   a state with nothing else reduces without "if"
+        std::vector<TableIR::Case> cases = s.cases;
+        bool default_reduce = s.default_action.kind == TableIR::Reduce;
+        bool dispatch = !cases.empty() || !default_reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = s.default_action;
+        }
+
         first = true;
         int ridx = 0;
-        for (tgt::parsing_table::state::action_table_type::const_iterator j = s.action_table.begin(); j != s.action_table.end(); ++j) {
+        for (const auto& c: cases) {
+            std::stringstream ss;
+
             // action header 
-            stencil(
-                os, R"(
-    ${if} token == Token.${token_prefix}${token}:
+            if (c.tokens.empty()) {
+                if (dispatch) {
+                    stencil(
+                        os, R"(
+    else:
+)");
+                }
+            } else {
+                stencil(
+                    os, R"(
+    ${if} ${condition}:
 )",
-                {"if", (first)? "if" : "elif"},
-                {"token_prefix", options.token_prefix},
-                {"token", tokens[(*j).first]});
+                    {"if", (first)? "if" : "elif"},
+                    {"condition", [&](std::ostream& os) {
+                            for (size_t l = 0 ; l < c.tokens.size() ; l++) {
+                                if (l != 0) { os << " or "; }
+                                os << "token == Token." << options.token_prefix
+                                   << tokens[c.tokens[l]];
+                            }
+                        }});
+            }
             first = false;
             // action
-            const tgt::parsing_table::action* a = &(*j).second;
-            switch( a->type ) {
-            case zw::gr::action_shift:
+            const TableIR::Action& a = c.action;
+            switch (a.kind) {
+            case TableIR::Shift:
                 stencil(
-                    os, R"(
+                    ss, R"(
       // shift
       push_stack(self.state_${dest_index}, self.gotof_${dest_index}, value)
       return false
 )",
-                    {"dest_index", a->dest_index});
+                    {"dest_index", a.value});
                 break;
-            case zw::gr::action_reduce:
+            case TableIR::Reduce:
                 stencil(
-                    os, R"(
+                    ss, R"(
       // reduce
 )");
                 {
-                    size_t base = a->rule.right().size();
+                    const TableIR::Rule& rule = ir.rules[a.value];
+                    int base = rule.length;
 
-                    const tgt::parsing_table::rule_type& rule = a->rule;
-                    action_map_type::const_iterator k = actions.find( rule );
+                    if (rule.action) {
+                        const SemanticAction& sa = *rule.action;
 
-                    size_t nonterminal_index = std::distance(
-                        nonterminal_types.begin(),
-                        nonterminal_types.find( rule.left().name() ) );
-
-                    if( k != actions.end() ) {
-                        const SemanticAction& sa = (*k).second;
-
-                        //os << "				{\n";
                         // automatic argument conversion
                         for( size_t l = 0 ; l < sa.args.size() ; l++ ) {
                             const SemanticAction::Argument& arg = sa.args[l];
                             stencil(
-                                os, R"(
+                                ss, R"(
       arg${idx} = my_get_arg(${base}, ${source}) cast ${type}
 )",
                                 {"idx", l},
@@ -401,12 +413,12 @@ ${access_modifier}class Parser ():
 
                         // semantic action
                         stencil(
-                            os, R"(
+                            ss, R"(
       r${ridx} as ${type}
       self.sa.${sa_name}(r${ridx}$${args} )
 )",
                             {"ridx", ridx},
-                            {"type", (*nonterminal_types.find( rule.left().name() )).second.name},
+                            {"type", (*nonterminal_types.find(ir.nonterminals[rule.nonterminal])).second.name},
                             {"sa_name", sa.name},
                             {"args",
                                 [&](std::ostream& os) {
@@ -420,29 +432,29 @@ ${access_modifier}class Parser ():
 
                         // automatic return value conversion
                         stencil(
-                            os, R"(
+                            ss, R"(
       v = r${ridx} cast object
       pop_stack(${base})
       return stack_top().gotof(${nonterminal_index}, v)
 )",
                             {"ridx", ridx},
                             {"base", base},
-                            {"nonterminal_index", nonterminal_index});
+                            {"nonterminal_index", rule.nonterminal});
                     } else {
                         stencil(
-                            os, R"(
+                            ss, R"(
       // run_semantic_action()
       pop_stack(${base})
       return stack_top().gotof(${nonterminal_index}, object())
 )",
                             {"base", base},
-                            {"nonterminal_index", nonterminal_index});
+                            {"nonterminal_index", rule.nonterminal});
                     }
                 }
                 break;
-            case zw::gr::action_accept:
+            case TableIR::Accept:
                 stencil(
-                    os, R"(
+                    ss, R"(
       // accept
       // run_semantic_action()
       self.accepted = true
@@ -450,9 +462,9 @@ ${access_modifier}class Parser ():
       return false
 )");
                 break;
-            case zw::gr::action_error:
+            default:
                 stencil(
-                    os, R"(
+                    ss, R"(
       self.sa.syntax_error()
       self.error = true
       return false
@@ -460,19 +472,25 @@ ${access_modifier}class Parser ():
                 break;
             }
 
-            // action footer
+            // action footer (one level shallower without "if")
+            std::string line;
+            while (std::getline(ss, line)) {
+                os << (dispatch || line.size() < 2 ? line : line.substr(2)) << "\n";
+            }
             ++ridx;
         }
 
         // dispatcher footer
-        stencil(
-            os, R"(
+        if (!default_reduce) {
+            stencil(
+                os, R"(
     else:
       self.sa.syntax_error()
       self.error = true
       return false
-
 )");
+        }
+        os << "\n";
     }
 
     stencil(
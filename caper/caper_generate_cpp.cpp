@@ -4,11 +4,16 @@
 // $Id$
 
 #include "caper_ast.hpp"
+#include "caper_error.hpp"
 #include "caper_generate_cpp.hpp"
 #include "caper_format.hpp"
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
+#include "caper_lexer.hpp"
 #include <algorithm>
+#include <set>
+#include <cstdio>
+#include <fstream>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
 
@@ -55,26 +60,6 @@ std::string make_arg_decl(const Type& x, size_t l, const std::string& smart_poin
     }
 }
 
-void make_signature(
-    const std::map<std::string, Type>&      nonterminal_types,
-    const tgt::parsing_table::rule_type&    rule,
-    const SemanticAction&                   sa,
-    std::vector<std::string>&               signature,
-    const std::string&                      smart_pointer_tag) {
-    // function name
-    signature.push_back(sa.name);
-
-    // return value
-    signature.push_back(
-        make_type_name(*finder(nonterminal_types, rule.left().name()),
-                       smart_pointer_tag));
-
-    // arguments
-    for (const auto& arg: sa.args) {
-        signature.push_back(make_type_name(arg.type, smart_pointer_tag));
-    }
-}
-
 std::string normalize_internal_sa_name(const std::string& s) {
     std::string r;
     for(auto c: s) {
@@ -98,17 +83,352 @@ std::string normalize_sa_call(const std::string& s) {
     return prefix + s;
 }
 
+// "case tag:", or "default:" for the default reduction (empty tag)
+void case_label(std::ostream& os, const std::string& case_tag) {
+    if (case_tag.empty()) {
+        stencil(
+            os, R"(
+        default:
+)"
+            );
+    } else {
+        stencil(
+            os, R"(
+        case ${case_tag}:
+)",
+            {"case_tag", case_tag}
+            );
+    }
+}
+
+int glr_action_code(const tgt::parsing_table::action& action) {
+    // shift: dest << 2, reduce: rule << 2 | 1, accept: 2
+    switch (action.type) {
+        case zw::gr::action_shift:
+            return action.dest_index << 2;
+        case zw::gr::action_reduce:
+            return int(action.rule.id()) << 2 | 1;
+        case zw::gr::action_accept:
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+template <class It>
+bool collect_edge_tokens(
+    std::set<int>&                          s,
+    std::map<std::string, std::set<int>>&   sets,
+    const std::set<std::string>&            nullable,
+    It                                      b,
+    It                                      e) {
+    // returns true if all symbols in [b, e) are nullable
+    for (; b != e ; ++b) {
+        if ((*b).is_terminal()) {
+            s.insert((*b).token());
+            return false;
+        }
+        const auto& x = sets[(*b).name()];
+        s.insert(x.begin(), x.end());
+        if (nullable.count((*b).name()) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void make_sync_tokens(
+    const tgt::grammar& g,
+    const std::string&  symbol,
+    std::set<int>&      begin,
+    std::set<int>&      end) {
+    // terminals that can begin / end a sentence derived from the symbol
+    std::map<std::string, std::set<int>> first;
+    std::map<std::string, std::set<int>> last;
+    std::set<std::string> nullable;
+
+    bool repeat = true;
+    while (repeat) {
+        repeat = false;
+        for (const auto& rule: g) {
+            const std::string& left = rule.left().name();
+            size_t n = first[left].size() + last[left].size();
+            bool all_nullable = collect_edge_tokens(
+                first[left], first, nullable,
+                rule.right().begin(), rule.right().end());
+            collect_edge_tokens(
+                last[left], last, nullable,
+                rule.right().rbegin(), rule.right().rend());
+            if (all_nullable && nullable.insert(left).second) {
+                repeat = true;
+            }
+            if (n != first[left].size() + last[left].size()) {
+                repeat = true;
+            }
+        }
+    }
+
+    begin = first[symbol];
+    end = last[symbol];
+}
+
+std::string c_string_literal(const std::string& s) {
+    std::string r = "\"";
+    for (char c: s) {
+        unsigned char u = (unsigned char)c;
+        if (c == '"' || c == '\\') {
+            r += '\\';
+            r += c;
+        } else if (u < 0x20 || 0x7f <= u) {
+            char buf[8];
+            sprintf(buf, "\\%03o", u);
+            r += buf;
+        } else {
+            r += c;
+        }
+    }
+    return r + "\"";
+}
+
+void generate_lexer(
+    std::ostream&                       os,
+    const GenerateOptions&              options,
+    const std::map<std::string, Type>&  terminal_types) {
+    const auto& rules = options.lexer_rules;
+    for (const auto& rule: rules) {
+        if (!rule.name.empty() && terminal_types.count(rule.name) == 0) {
+            throw undefined_symbol(rule.addr, rule.name);
+        }
+    }
+
+    LexerTable table;
+    make_lexer_table(table, rules);
+
+    size_t states = table.transitions.size();
+    const char* state_type =
+        states <= 0x100 ? "unsigned char" :
+        states <= 0x10000 ? "unsigned short" :
+        "int";
+
+    stencil(
+        os, R"(
+// lexer tables
+//   state 0 is the dead state, state 1 the start state. bytes are
+//   mapped to classes first, the transitions are indexed by class.
+struct lexer_table {
+    static int next(int state, unsigned char c) {
+        static const unsigned char classes[256] = {
+$${classes}
+        };
+        static const ${state_type} transitions[${state_count} * ${class_count}] = {
+$${transitions}
+        };
+        return transitions[state * ${class_count} + classes[c]];
+    }
+
+    // the token, -2 for skipped patterns, -1 if not accepting
+    static int accept(int state) {
+        static const int accepts[${state_count}] = {
+$${accepts}
+        };
+        return accepts[state];
+    }
+
+    // keywords are looked up by perfect hash on [b, e) after the token
+    // they collide with has matched
+    template <class It>
+    static Token keyword(Token token, It b, It e) {
+        switch (token) {
+$${keywords}
+        default:
+            return token;
+        }
+    }
+
+    // the token a keyword is taken for where it is not expected
+    static Token fallback(Token token) {
+        switch (token) {
+$${fallbacks}
+        default:
+            return token;
+        }
+    }
+
+    template <class It>
+    static Token find(Token token, It b, It e, unsigned multiplier,
+                      unsigned size, const char* const* texts,
+                      const Token* tokens) {
+        unsigned h = 0;
+        for (It i = b ; i != e ; ++i) { h++; }
+        for (It i = b ; i != e ; ++i) { h = h * multiplier + (unsigned char)*i; }
+        h %= size;
+        const char* p = texts[h];
+        if (!p) { return token; }
+        for (It i = b ; i != e ; ++i, ++p) {
+            if (*p == '\0' || *p != *i) { return token; }
+        }
+        return *p == '\0' ? tokens[h] : token;
+    }
+};
+
+// Lexer
+//   longest match over the %lexer patterns, ties go to the one declared
+//   first. It must be a forward iterator over char.
+template <class It>
+class Lexer {
+public:
+    Lexer(It b, It e) : b_(b), c_(b), e_(e) {}
+
+    // reads the next token, ${eof} at the end of the input.
+    // returns false if no pattern matches at begin().
+    bool get(Token& token) {
+        for (;;) {
+            b_ = c_;
+            if (c_ == e_) {
+                token = ${eof};
+                return true;
+            }
+            int accept = -1;
+            int state = 1;
+            for (It i = c_ ; i != e_ ; ) {
+                state = lexer_table::next(state, (unsigned char)*i);
+                if (state == 0) { break; }
+                ++i;
+                int a = lexer_table::accept(state);
+                if (a != -1) {
+                    accept = a;
+                    c_ = i;
+                }
+            }
+            if (accept == -1) { return false; }
+            if (accept != -2) {
+                token = lexer_table::keyword(Token(accept), b_, c_);
+                return true;
+            }
+        }
+    }
+
+    // lexeme of the last token
+    It begin() const { return b_; }
+    It end() const { return c_; }
+
+private:
+    It  b_;
+    It  c_;
+    It  e_;
+
+};
+
+)",
+        {"state_type", state_type},
+        {"state_count", states},
+        {"class_count", table.class_count},
+        {"eof", options.token_prefix + "eof"},
+        {"classes", [&](std::ostream& os) {
+                for (int i = 0 ; i < 256 ; i += 16) {
+                    os << "           ";
+                    for (int j = i ; j < i + 16 ; j++) {
+                        os << " " << table.char_classes[j] << ",";
+                    }
+                    os << "\n";
+                }
+            }},
+        {"transitions", [&](std::ostream& os) {
+                for (const auto& row: table.transitions) {
+                    os << "           ";
+                    for (int t: row) { os << " " << t << ","; }
+                    os << "\n";
+                }
+            }},
+        {"accepts", [&](std::ostream& os) {
+                for (int a: table.accepts) {
+                    os << "            ";
+                    if (a < 0) {
+                        os << "-1";
+                    } else if (rules[a].name.empty()) {
+                        os << "-2";
+                    } else {
+                        os << options.token_prefix << rules[a].name;
+                    }
+                    os << ",\n";
+                }
+            }},
+        {"fallbacks", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < rules.size() ; i++) {
+                    for (int k: table.keywords[i]) {
+                        stencil(
+                            os, R"(
+        case ${prefix}${keyword}: return ${prefix}${token};
+)",
+                            {"prefix", options.token_prefix},
+                            {"keyword", rules[k].name},
+                            {"token", rules[i].name}
+                            );
+                    }
+                }
+            }},
+        {"keywords", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < rules.size() ; i++) {
+                    const auto& keywords = table.keywords[i];
+                    if (keywords.empty()) { continue; }
+
+                    std::vector<std::string> texts;
+                    for (int k: keywords) {
+                        texts.push_back(table.literals[k]);
+                    }
+                    PerfectHash hash;
+                    make_perfect_hash(hash, texts);
+
+                    stencil(
+                        os, R"(
+        case ${prefix}${token}: {
+            static const char* const texts[${size}] = {
+$${texts}
+            };
+            static const Token tokens[${size}] = {
+$${tokens}
+            };
+            return find(token, b, e, ${multiplier}, ${size}, texts, tokens);
+        }
+)",
+                        {"prefix", options.token_prefix},
+                        {"token", rules[i].name},
+                        {"size", size_t(hash.size)},
+                        {"multiplier", size_t(hash.multiplier)},
+                        {"texts", [&](std::ostream& os) {
+                                for (int k: hash.slots) {
+                                    os << "                "
+                                       << (k < 0 ? "0" :
+                                           c_string_literal(texts[k]))
+                                       << ",\n";
+                                }
+                            }},
+                        {"tokens", [&](std::ostream& os) {
+                                for (int k: hash.slots) {
+                                    os << "                "
+                                       << options.token_prefix
+                                       << rules[k < 0 ? i : keywords[k]].name
+                                       << ",\n";
+                                }
+                            }}
+                        );
+                }
+            }}
+        );
+}
+
 } // unnamed namespace
 
 void generate_cpp(
     const std::string&                  src_filename,
     std::ostream&                       os,
     const GenerateOptions&              options,
-    const std::map<std::string, Type>&,
+    const std::map<std::string, Type>&  terminal_types,
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
 #ifdef _WIN32
     char basename[_MAX_PATH];
@@ -119,6 +439,70 @@ void generate_cpp(
     std::string filename = src_filename;
 #endif
 
+    if (options.glr && options.dont_use_stl) {
+        throw unsupported_feature("C++", "%glr with %dont_use_stl");
+    }
+    if (options.glr && options.allow_ebnf) {
+        throw unsupported_feature("C++", "%glr with EBNF");
+    }
+    if (options.snapshot && options.dont_use_stl) {
+        throw unsupported_feature("C++", "%snapshot with %dont_use_stl");
+    }
+    if (options.snapshot && options.allow_ebnf) {
+        throw unsupported_feature("C++", "%snapshot with EBNF");
+    }
+    if (options.snapshot && options.glr) {
+        throw unsupported_feature("C++", "%snapshot with %glr");
+    }
+
+    bool sync = !options.sync_symbol.empty();
+    if (sync && options.dont_use_stl) {
+        throw unsupported_feature("C++", "%sync with %dont_use_stl");
+    }
+    if (sync && options.glr) {
+        throw unsupported_feature("C++", "%sync with %glr");
+    }
+    if (sync && nonterminal_types.count(options.sync_symbol) == 0) {
+        throw undefined_symbol(-1, options.sync_symbol);
+    }
+    std::string syntax_error = sync ? "syntax_error" : "sa_.syntax_error";
+
+    bool split = !options.split_include.empty();
+    if (split && options.external_token) {
+        throw unsupported_feature("C++", "%split with %external_token");
+    }
+    if (options.table) {
+        throw unsupported_feature("C++", "%table");
+    }
+
+    bool lexer = !options.lexer_rules.empty();
+    if (lexer && options.external_token) {
+        throw unsupported_feature("C++", "%lexer with %external_token");
+    }
+
+    auto profile_call = [&](const std::string& s) -> std::string {
+        return options.profile ? "            " + s + "\n" : "";
+    };
+
+    // reduction call of the rule
+    auto reduce_call = [&](int rule_id) -> std::string {
+        const auto& rule = ir.rules[rule_id];
+        std::string name = rule.action ? rule.action->name : "call_nothing";
+        if (0 <= rule.stub) {
+            name = "call_" + std::to_string(ir.stubs[rule.stub].index) +
+                "_" + normalize_internal_sa_name(rule.action->name);
+        }
+        std::string call = name + "(Nonterminal_" +
+            ir.nonterminals[rule.nonterminal] + ", /*pop*/ " +
+            std::to_string(rule.length);
+        if (0 <= rule.stub) {
+            for (int index: rule.action->source_indices) {
+                call += ", " + std::to_string(index);
+            }
+        }
+        return call + ")";
+    };
+
     std::string headername = filename;
     for (auto& x: headername){
         if (!isalpha(x) && !isdigit(x)) {
@@ -141,6 +525,8 @@ void generate_cpp(
 #include <cassert>
 $${debug_include}
 $${use_stl}
+$${sync_include}
+$${profile_macros}
 
 namespace ${namespace_name} {
 
@@ -150,7 +536,26 @@ namespace ${namespace_name} {
         {"debug_include",
             {options.debug_parser ? "#include <iostream>\n" : ""}},
         {"use_stl",
-            {options.dont_use_stl ? "" : "#include <vector>\n"}},
+            {options.dont_use_stl ? "" :
+                options.glr ? "#include <vector>\n#include <deque>\n" :
+                options.snapshot ?
+                    "#include <vector>\n#include <map>\n#include <memory>\n#include <cstddef>\n" :
+                "#include <vector>\n"}},
+        {"profile_macros", {
+                options.profile ?
+                    R"(
+#ifndef CAPER_PROFILE
+#define CAPER_PROFILE 1
+#endif
+#ifndef CAPER_TRACE_SIZE
+#define CAPER_TRACE_SIZE 0
+#endif
+)" :
+                    ""}},
+        {"sync_include", {
+                sync ?
+                    "#include <algorithm>\n#include <atomic>\n#include <thread>\n" :
+                    ""}},
         {"namespace_name", options.namespace_name}
         );
 
@@ -196,8 +601,137 @@ $${labels}
 
     }
 
+    if (lexer) {
+        // lexer
+        generate_lexer(os, options, terminal_types);
+    }
+
     // stack class header
-    if (!options.dont_use_stl) {
+    if (options.snapshot) {
+        // persistent version
+        stencil(
+            os, R"(
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    // frames are immutable nodes linked to their parents,
+    // so copying a stack shares the whole contents (O(1))
+    Stack() {}
+    Stack(const Stack& x) : top_(x.top_), gap_(x.gap_) {}
+    ~Stack() { clear(); }
+
+    Stack& operator=(const Stack& x) {
+        node_ptr t = x.top_;
+        node_ptr g = x.gap_;
+        clear();
+        top_ = t;
+        gap_ = g;
+        return *this;
+    }
+
+    void rollback_tmp() {
+        top_ = gap_;
+    }
+
+    void commit_tmp() {
+        gap_ = top_;
+    }
+
+    bool push(const T& f) {
+        size_t d = depth();
+        if (StackSize != 0 && StackSize <= d) {
+            return false;
+        }
+        top_ = std::make_shared<node>(f, top_, d + 1);
+        return true;
+    }
+
+    void pop(size_t n) {
+        while (n--) {
+            top_ = top_->prev;
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        return top_->value;
+    }
+
+    const T& committed_top() const {
+        assert(gap_);
+        return gap_->value;
+    }
+
+    const T& get_arg(size_t base, size_t index) {
+        return at(base - index - 1)->value;
+    }
+
+    void clear() {
+        release(top_);
+        release(gap_);
+    }
+
+    bool empty() const {
+        return !top_;
+    }
+
+    size_t depth() const {
+        return top_ ? top_->depth : 0;
+    }
+
+    T& nth(size_t index) {
+        return at(depth() - 1 - index)->value;
+    }
+
+    bool equal(const Stack& x) const {
+        // stops at the first shared frame
+        if (depth() != x.depth()) { return false; }
+        const node* p = top_.get();
+        const node* q = x.top_.get();
+        while (p != q) {
+            if (!(p->value == q->value)) { return false; }
+            p = p->prev.get();
+            q = q->prev.get();
+        }
+        return true;
+    }
+
+private:
+    struct node {
+        T                       value;
+        std::shared_ptr<node>   prev;
+        size_t                  depth;
+
+        node(const T& v, const std::shared_ptr<node>& p, size_t d)
+            : value(v), prev(p), depth(d) {}
+    };
+    typedef std::shared_ptr<node> node_ptr;
+
+    node* at(size_t n) {
+        node* p = top_.get();
+        while (n--) {
+            p = p->prev.get();
+        }
+        return p;
+    }
+
+    static void release(node_ptr& p) {
+        // avoid recursive destruction of long chains
+        while (p && p.unique()) {
+            node_ptr q = p->prev;
+            p = q;
+        }
+        p.reset();
+    }
+
+private:
+    node_ptr top_;
+    node_ptr gap_;
+
+};
+
+)");
+    } else if (!options.dont_use_stl) {
         // STL version
         stencil(
             os, R"(
@@ -247,6 +781,11 @@ public:
             return stack_[gap_ - 1];
         }
     }
+
+    const T& committed_top() const {
+        assert(!stack_.empty());
+        return stack_.back();
+    }
 	   
     const T& get_arg(size_t base, size_t index) {
         size_t n = tmp_.size();
@@ -362,6 +901,11 @@ public:
         }
     }
 
+    const T& committed_top() const {
+        assert(0 < top_);
+        return at(top_ - 1);
+    }
+
     const T& get_arg(size_t base, size_t index) {
         if (base - index <= tmp_) {
             return at(StackSize-1 - (tmp_ -(base - index)));
@@ -411,6 +955,10 @@ private:
         return *(T*)(stack_ + (n * sizeof(T)));
     }
 
+    const T& at(size_t n) const {
+        return *(const T*)(stack_ + (n * sizeof(T)));
+    }
+
 private:
     char stack_[ StackSize * sizeof(T) ];
     size_t top_;
@@ -454,11 +1002,12 @@ public:
     };
 
 public:
-    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+    Parser(_SemanticAction& sa) : sa_(sa)${constructor_init} { reset(); }
 
     void reset() {
         error_ = false;
         accepted_ = false;
+$${reset_extension}
         clear_stack();
         rollback_tmp_stack();
         if (push_stack(${first_state}, value_type())) {
@@ -472,12 +1021,11 @@ public:
     bool post(token_type token, const value_type& value) {
         rollback_tmp_stack();
         error_ = false;
-        while ((this->*(stack_top()->entry->state))(token, value))
-            ; // may throw
+$${post_dispatch}
         if (!error_) {
             commit_tmp_stack();
         } else {
-            recover(token, value);
+            ${recover}(token, value);
         }
         return accepted_ || error_;
     }
@@ -491,10 +1039,131 @@ public:
 
     bool error() { return error_; }
 
+$${lexer_parse}
+)",
+        {"first_state", table.first_state()},
+        {"lexer_parse", [&](std::ostream& os) {
+                if (!lexer) { return; }
+                stencil(
+                    os, R"(
+    // scans [b, e) with Lexer and posts the tokens, the values are made
+    // by f(token, lexeme begin, lexeme end). b is left after the last
+    // token read, or at the offending char on a lexical error.
+    // a keyword that is not expected in the current state is taken for
+    // the token it collides with (contextual keywords).
+    template <class It, class F>
+    bool parse(It& b, It e, F f) {
+        reset();
+        Lexer<It> lexer(b, e);
+        Token token;
+        do {
+            if (!lexer.get(token)) {
+                b = lexer.begin();
+                ${syntax_error}();
+                error_ = true;
+                return false;
+            }
+            b = lexer.end();
+            if (!expected(token)) {
+                Token t = lexer_table::fallback(token);
+                if (t != token && expected(t)) { token = t; }
+            }
+        } while (!post(token, f(token, lexer.begin(), lexer.end())));
+        return !error_;
+    }
+
 )",
-        {"first_state", table.first_state()}
+                    {"syntax_error", syntax_error}
+                    );
+            }},
+        {"constructor_init", {
+                std::string(options.snapshot ? ", checkpoint_interval_(0)" : "") +
+                (sync ? ", speculative_(false)" : "")}},
+        {"recover", {sync ? "sync_recover" : "recover"}},
+        {"reset_extension", {
+                options.glr ? "        glr_clear();\n" :
+                options.snapshot ? "        checkpoint_clear();\n" :
+                ""}},
+        {"post_dispatch", {
+                options.glr ?
+                    R"(        if (glr_active_) {
+            glr_post(token, value);
+        } else {
+            while ((this->*(stack_top()->entry->state))(token, value))
+                ; // may throw
+            reduce_consistent(token, value);
+        }
+)" :
+                    R"(        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+)"}}
         );
 
+    // expected tokens
+    {
+        size_t bytes = (tokens.size() + 7) / 8;
+        stencil(
+            os, R"(
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[${state_count}][${bytes}] = {
+$${rows}
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() const {
+        return int(stack_.committed_top().entry - entry(0));
+    }
+
+    bool expected(token_type token) const {
+$${glr_expected}
+        return expected(state(), token);
+    }
+
+)",
+            {"state_count", table.states().size()},
+            {"bytes", bytes},
+            {"rows", [&](std::ostream& os) {
+                    for (const auto& state: table.states()) {
+                        std::vector<int> row(bytes);
+                        for (const auto& pair: state.action_table) {
+                            // %nonassoc errors are not expected
+                            if (pair.second.type == zw::gr::action_error) {
+                                continue;
+                            }
+                            row[pair.first >> 3] |= 1 << (pair.first & 7);
+                        }
+                        os << "            {";
+                        for (size_t i = 0 ; i < bytes ; i++) {
+                            os << (i ? ", " : " ") << row[i];
+                        }
+                        os << " },\n";
+                    }
+                }},
+            {"glr_expected", {
+                    options.glr ?
+                        R"(        if (glr_active_) {
+            // any of the stacks
+            for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+                if (expected(glr_heads_[i]->state, token)) { return true; }
+            }
+            return false;
+        }
+)" :
+                        ""}}
+            );
+    }
+
     // implementation
     stencil(
         os, R"(
@@ -513,6 +1182,7 @@ private:
         state_type  state;
         gotof_type  gotof;
         bool        handle_error;
+        bool        consistent;
     };
 
     struct stack_frame {
@@ -522,9 +1192,18 @@ private:
 
         stack_frame(const table_entry* e, const value_type& v, int sl)
             : entry(e), value(v), sequence_length(sl) {}
+$${stack_frame_equal}
     };
 
 )",
+        {"stack_frame_equal", {
+                options.snapshot ?
+                    R"(
+        bool operator==(const stack_frame& x) const {
+            return entry == x.entry && value == x.value;
+        }
+)" :
+                    ""}},
         {"token_paremter", options.external_token ? "_Token, " : ""}
         );
 
@@ -540,6 +1219,7 @@ private:
             error_ = true;
             sa_.stack_overflow();
         }
+$${profile}
         return f;
     }
 
@@ -567,7 +1247,16 @@ $${pop_stack_implementation}
         stack_.commit_tmp();
     }
 
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
 )",
+        {"profile", {options.profile ? "        profile_depth();\n" : ""}},
         {"pop_stack_implementation", [&](std::ostream& os) {
                 if (options.allow_ebnf) {
                     stencil(
@@ -588,12 +1277,552 @@ $${pop_stack_implementation}
             }}
         );
 
-    if (options.recovery) {
+    if (options.snapshot) {
         stencil(
             os, R"(
-    void recover(token_type token, const value_type& value) {
-        rollback_tmp_stack();
+public:
+    // snapshot / fork
+    class snapshot_type {
+        friend class Parser;
+
+    public:
+        snapshot_type() : accepted_(false), error_(false) {}
+
+    private:
+        Stack<stack_frame, _StackSize>  stack_;
+        bool                            accepted_;
+        bool                            error_;
+        value_type                      accepted_value_;
+    };
+
+    snapshot_type snapshot() const {
+        snapshot_type s;
+        s.stack_ = stack_;
+        s.accepted_ = accepted_;
+        s.error_ = error_;
+        s.accepted_value_ = accepted_value_;
+        return s;
+    }
+
+    void restore(const snapshot_type& s) {
+        stack_ = s.stack_;
+        accepted_ = s.accepted_;
+        error_ = s.error_;
+        accepted_value_ = s.accepted_value_;
+    }
+
+    Parser fork() const {
+        return *this;
+    }
+
+    // incremental reparse
+    //   post_at() takes a snapshot before a token every
+    //   checkpoint_interval tokens and after each checkpoint token.
+    //   edit() rewinds to the last checkpoint before an edit.
+    //   checkpoints behind the edit are kept, and post_at() stops
+    //   reparsing (returns true, converged() == true) as soon as the
+    //   stack matches one of them again: the parser then takes the
+    //   state after the last token of the previous parse.
+    //   frames are compared with value_type::operator==.
+    void set_checkpoint_interval(size_t n) {
+        checkpoint_interval_ = n;
+    }
+
+    void add_checkpoint_token(token_type token) {
+        checkpoint_tokens_.push_back(token);
+    }
+
+    bool post_at(size_t offset, token_type token, const value_type& value) {
+        converged_ = false;
+
+        // convergence with the previous parse
+        typename checkpoint_map::iterator i = old_checkpoints_.begin();
+        while (i != old_checkpoints_.end() && (*i).first < offset) {
+            old_checkpoints_.erase(i++);
+        }
+        if (i != old_checkpoints_.end() && (*i).first == offset &&
+            !error_ && !(*i).second.error_ &&
+            stack_.equal((*i).second.stack_)) {
+            checkpoints_.insert(old_checkpoints_.begin(), old_checkpoints_.end());
+            old_checkpoints_.clear();
+            restore(old_last_);
+            last_ = old_last_;
+            converged_ = true;
+            return true;
+        }
+
+        // checkpoint
+        if (checkpoint_pending_ ||
+            (0 < checkpoint_interval_ &&
+             checkpoint_interval_ <= checkpoint_count_)) {
+            checkpoints_[offset] = snapshot();
+            checkpoint_pending_ = false;
+            checkpoint_count_ = 0;
+        }
+        checkpoint_count_++;
+        for (size_t j = 0 ; j < checkpoint_tokens_.size() ; j++) {
+            if (checkpoint_tokens_[j] == token) {
+                checkpoint_pending_ = true;
+                break;
+            }
+        }
+
+        bool r = post(token, value);
+        last_ = snapshot();
+        return r;
+    }
+
+    // [begin, end) of the previous input was replaced,
+    // changing its length by delta.
+    // returns the offset to restart lexing/posting from.
+    size_t edit(size_t begin, size_t end, std::ptrdiff_t delta) {
+        checkpoint_map old;
+        for (typename checkpoint_map::iterator i =
+                 checkpoints_.lower_bound(end);
+             i != checkpoints_.end() ; ++i) {
+            old[size_t((*i).first + delta)] = (*i).second;
+        }
+        snapshot_type old_last = last_;
+
+        typename checkpoint_map::iterator i = checkpoints_.lower_bound(begin);
+        size_t offset = 0;
+        if (i == checkpoints_.begin()) {
+            reset();
+        } else {
+            --i;
+            offset = (*i).first;
+            restore((*i).second);
+            checkpoints_.erase(i, checkpoints_.end());
+        }
+
+        old_checkpoints_.swap(old);
+        old_last_ = old_last;
+        checkpoint_pending_ = true;
+        checkpoint_count_ = 0;
+        converged_ = false;
+        return offset;
+    }
+
+    bool converged() const { return converged_; }
+
+private:
+    typedef std::map<size_t, snapshot_type> checkpoint_map;
+
+    size_t                  checkpoint_interval_;
+    std::vector<token_type> checkpoint_tokens_;
+    checkpoint_map          checkpoints_;
+    checkpoint_map          old_checkpoints_;
+    snapshot_type           last_;
+    snapshot_type           old_last_;
+    size_t                  checkpoint_count_;
+    bool                    checkpoint_pending_;
+    bool                    converged_;
+
+    void checkpoint_clear() {
+        checkpoints_.clear();
+        old_checkpoints_.clear();
+        last_ = snapshot_type();
+        old_last_ = snapshot_type();
+        checkpoint_count_ = 0;
+        checkpoint_pending_ = true;
+        converged_ = false;
+    }
+
+)"
+            );
+    }
+
+    if (sync) {
+        const auto& root = table.get_grammar().root_rule();
+        std::string start_symbol = root.right()[0].name();
+        std::set<int> sync_begin;
+        std::set<int> sync_end;
+        make_sync_tokens(
+            table.get_grammar(), options.sync_symbol, sync_begin, sync_end);
+
+        auto token_cases = [&](std::ostream& os, const std::set<int>& s) {
+            for (int x: s) {
+                stencil(
+                    os, R"(
+        case ${case_tag}:
+)",
+                    {"case_tag", options.token_prefix + tokens[x]}
+                    );
+            }
+        };
+
+        stencil(
+            os, R"(
+public:
+    // parallel parsing
+    //   the input is split before tokens that can begin ${sync_symbol}
+    //   right after tokens that can end it. each chunk is parsed as a
+    //   whole ${start_symbol} by its own parser on a worker thread, and
+    //   the results are joined from left to right by ${merge}.
+    //   a chunk that is not a sentence by itself is parsed sequentially
+    //   together with the following chunks. if the input has a syntax
+    //   error, it is parsed again sequentially to report it.
+    //   note: semantic actions must be pure and idempotent. they are called
+    //   concurrently from several threads, for chunks whose result is
+    //   thrown away, and again for the same tokens when chunks are parsed
+    //   sequentially or the input is parsed again. only the values they
+    //   return are kept. syntax_error() and recovery are not called
+    //   while chunks are parsed speculatively.
+    bool parse_parallel(const std::vector<token_type>& tokens,
+                        const std::vector<value_type>& values,
+                        unsigned int threads = 0) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+            if (threads == 0) { threads = 1; }
+        }
+        size_t n = tokens.size();
+        if (0 < n && tokens[n - 1] == ${token_eof}) { n--; }
+
+        // split
+        std::vector<size_t> candidates;
+        for (size_t i = 1 ; i < n ; i++) {
+            if (sync_begin(tokens[i]) && sync_end(tokens[i - 1])) {
+                candidates.push_back(i);
+            }
+        }
+        std::vector<sync_chunk> chunks;
+        size_t chunk_count = threads * 4;
+        size_t b = 0;
+        for (size_t k = 1 ; k < chunk_count ; k++) {
+            size_t target = (std::max)(n * k / chunk_count, b + 1);
+            std::vector<size_t>::const_iterator i =
+                std::lower_bound(candidates.begin(), candidates.end(), target);
+            if (i == candidates.end()) { break; }
+            chunks.push_back(sync_chunk(b, *i));
+            b = *i;
+        }
+        chunks.push_back(sync_chunk(b, n));
+
+        // parse chunks
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> workers;
+        for (size_t t = 1 ; t < threads && t < chunks.size() ; t++) {
+            workers.push_back(
+                std::thread(
+                    [&]() { sync_work(next, chunks, tokens, values); }));
+        }
+        sync_work(next, chunks, tokens, values);
+        for (size_t t = 0 ; t < workers.size() ; t++) {
+            workers[t].join();
+        }
+
+        // stitch
+        reset();
+        value_type result;
+        bool first = true;
+        size_t k = 0;
+        while (k < chunks.size()) {
+            value_type v;
+            if (chunks[k].accepted) {
+                v = chunks[k].value;
+                k++;
+            } else if (!sync_fallback(k, chunks, tokens, values, v)) {
+                // syntax error
+                reset();
+                for (size_t i = 0 ; i < n ; i++) {
+                    if (post(tokens[i], values[i])) { return false; }
+                }
+                post(${token_eof}, value_type());
+                return accepted_ && !error_;
+            }
+            result = first ? v : sync_merge(result, v);
+            first = false;
+        }
+        accepted_ = true;
+        accepted_value_ = result;
+        return true;
+    }
+
+private:
+    struct sync_chunk {
+        size_t      begin;
+        size_t      end;
+        bool        accepted;
+        value_type  value;
+
+        sync_chunk(size_t b, size_t e)
+            : begin(b), end(e), accepted(false) {}
+    };
+
+    bool speculative_;
+
+    void syntax_error() {
+        if (!speculative_) { sa_.syntax_error(); }
+    }
+
+    void sync_recover(token_type token, const value_type& value) {
+        if (!speculative_) { recover(token, value); }
+    }
+
+    static bool sync_begin(token_type token) {
+        switch (token) {
+$${sync_begin}
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static bool sync_end(token_type token) {
+        switch (token) {
+$${sync_end}
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void sync_work(std::atomic<size_t>& next,
+                   std::vector<sync_chunk>& chunks,
+                   const std::vector<token_type>& tokens,
+                   const std::vector<value_type>& values) {
+        for (;;) {
+            size_t k = next++;
+            if (chunks.size() <= k) { return; }
+
+            sync_chunk& c = chunks[k];
+            Parser p(sa_);
+            p.speculative_ = true;
+            size_t i = c.begin;
+            while (i < c.end && !p.post(tokens[i], values[i])) { i++; }
+            if (i == c.end &&
+                p.post(${token_eof}, value_type()) && !p.error_) {
+                c.accepted = true;
+                c.value = p.accepted_value_;
+            }
+        }
+    }
+
+    bool sync_fallback(size_t& k,
+                       const std::vector<sync_chunk>& chunks,
+                       const std::vector<token_type>& tokens,
+                       const std::vector<value_type>& values,
+                       value_type& v) {
+        // chunks[k] starts at a verified boundary; parse sequentially
+        // until the input read so far forms a sentence at a chunk end
+        Parser p(sa_);
+        p.speculative_ = true;
+        while (k < chunks.size()) {
+            for (size_t i = chunks[k].begin ; i < chunks[k].end ; i++) {
+                if (p.post(tokens[i], values[i])) { return false; }
+            }
+            k++;
+            Parser q(p);
+            if (q.post(${token_eof}, value_type()) && !q.error_) {
+                v = q.accepted_value_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    value_type sync_merge(const value_type& x, const value_type& y) {
+        ${start_type} arg0; sa_.downcast(arg0, x);
+        ${start_type} arg1; sa_.downcast(arg1, y);
+        ${start_type} r = sa_.${merge_call}(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        return v;
+    }
+
+)",
+            {"sync_symbol", options.sync_symbol},
+            {"start_symbol", start_symbol},
+            {"merge", options.sync_merge},
+            {"merge_call", {normalize_sa_call(options.sync_merge)}},
+            {"start_type", make_type_name(
+                    *finder(nonterminal_types, start_symbol),
+                    options.smart_pointer_tag)},
+            {"token_eof", options.token_prefix + "eof"},
+            {"sync_begin", [&](std::ostream& os) {
+                    token_cases(os, sync_begin);
+                }},
+            {"sync_end", [&](std::ostream& os) {
+                    token_cases(os, sync_end);
+                }}
+            );
+    }
+
+    if (options.profile) {
+        stencil(
+            os, R"(
+public:
+    // profiling
+    //   counters are compiled in when CAPER_PROFILE is nonzero,
+    //   the ring buffer of recent events when CAPER_TRACE_SIZE is nonzero.
+    enum {
+        state_count = ${state_count},
+        rule_count = ${rule_count}
+    };
+
+    struct stats_type {
+        unsigned long   shifts[state_count];        // by state
+        unsigned long   reductions[rule_count];     // by rule
+        unsigned long   gotos[state_count];         // by source state
+        unsigned long   recoveries;
+        size_t          max_depth;
+
+        stats_type() { clear(); }
+
+        void clear() {
+            for (int i = 0 ; i < state_count ; i++) {
+                shifts[i] = 0;
+                gotos[i] = 0;
+            }
+            for (int i = 0 ; i < rule_count ; i++) {
+                reductions[i] = 0;
+            }
+            recoveries = 0;
+            max_depth = 0;
+        }
+    };
+
+    enum trace_action {
+        trace_shift,    // target: destination state
+        trace_reduce,   // target: rule
+        trace_accept,
+        trace_error,
+    };
+
+    struct trace_event {
+        int     state;
+        int     token;
+        int     action;
+        int     target;
+    };
+
+    const stats_type& stats() const { return stats_; }
+    void clear_stats() { stats_.clear(); }
+
+    static const char* rule_label(int rule) {
+        static const char* labels[] = {
+$${rule_labels}
+        };
+        return labels[rule];
+    }
+
+    // copies up to n recent events (oldest first), returns the count
+    size_t trace(trace_event* events, size_t n) const {
+#if CAPER_TRACE_SIZE
+        size_t count = trace_.count;
+        if (CAPER_TRACE_SIZE < count) { count = CAPER_TRACE_SIZE; }
+        if (n < count) { count = n; }
+        for (size_t i = 0 ; i < count ; i++) {
+            events[i] = trace_.events[
+                (trace_.count - count + i) % CAPER_TRACE_SIZE];
+        }
+        return count;
+#else
+        (void)events;
+        (void)n;
+        return 0;
+#endif
+    }
+
+private:
+    stats_type stats_;
+#if CAPER_TRACE_SIZE
+    struct trace_buffer {
+        trace_event events[CAPER_TRACE_SIZE];
+        size_t      count;
+
+        trace_buffer() : count(0) {}
+    };
+    trace_buffer trace_;
+#endif
+
+    void profile_trace(int state, token_type token, int action, int target) {
+#if CAPER_TRACE_SIZE
+        trace_event& e = trace_.events[trace_.count++ % CAPER_TRACE_SIZE];
+        e.state = state;
+        e.token = int(token);
+        e.action = action;
+        e.target = target;
+#else
+        (void)state;
+        (void)token;
+        (void)action;
+        (void)target;
+#endif
+    }
+
+    void profile_shift(int state, token_type token, int dest) {
+#if CAPER_PROFILE
+        stats_.shifts[state]++;
+#endif
+        profile_trace(state, token, trace_shift, dest);
+    }
+
+    void profile_reduce(int state, token_type token, int rule) {
+#if CAPER_PROFILE
+        stats_.reductions[rule]++;
+#endif
+        profile_trace(state, token, trace_reduce, rule);
+    }
+
+    void profile_accept(int state, token_type token) {
+        profile_trace(state, token, trace_accept, 0);
+    }
+
+    void profile_error(int state, token_type token) {
+        profile_trace(state, token, trace_error, 0);
+    }
+
+    void profile_goto(int state) {
+#if CAPER_PROFILE
+        stats_.gotos[state]++;
+#else
+        (void)state;
+#endif
+    }
+
+    void profile_recover() {
+#if CAPER_PROFILE
+        stats_.recoveries++;
+#endif
+    }
+
+    void profile_depth() {
+#if CAPER_PROFILE
+        if (stats_.max_depth < stack_.depth()) {
+            stats_.max_depth = stack_.depth();
+        }
+#endif
+    }
+
+)",
+            {"state_count", table.states().size()},
+            {"rule_count", table.get_grammar().size()},
+            {"rule_labels", [&](std::ostream& os) {
+                    for (const auto& rule: table.get_grammar()) {
+                        std::stringstream ss;
+                        ss << rule;
+                        std::string label = ss.str();
+                        while (!label.empty() && label.back() == ' ') {
+                            label.pop_back();
+                        }
+                        stencil(
+                            os, R"(
+            "${label}",
+)",
+                            {"label", label}
+                            );
+                    }
+                }}
+            );
+    }
+
+    if (options.recovery) {
+        stencil(
+            os, R"(
+    void recover(token_type token, const value_type& value) {
+        rollback_tmp_stack();
         error_ = false;
+$${profile}
 $${debmes:start}
         while(!stack_top()->entry->handle_error) {
             pop_stack(1);
@@ -614,6 +1843,7 @@ $${debmes:post_error_done}
 $${debmes:repost_start}
         while ((this->*(stack_top()->entry->state))(token, value));
 $${debmes:repost_done}
+        reduce_consistent(token, value);
         if (!error_) {
             commit_tmp_stack();
         }
@@ -623,6 +1853,7 @@ $${debmes:repost_done}
     }
 
 )",
+            {"profile", {options.profile ? "        profile_recover();\n" : ""}},
             {"recovery_token", options.token_prefix + options.recovery_token},
             {"token_eof", options.token_prefix + "eof"},
             {"debmes:start", {
@@ -856,45 +2087,14 @@ $${debmes:repost_done}
 )"
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            const auto& rule_type =
-                *finder(nonterminal_types, rule.left().name());
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            const auto& rule_type = *finder(
                 nonterminal_types,
-                rule,
-                sa,
-                signature,
-                options.smart_pointer_tag);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+                ir.nonterminals[ir.rules[stub.rule].nonterminal]);
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -966,16 +2166,504 @@ $${debmes:repost_done}
         }
     }
 
+    if (options.glr) {
+        // GLR support (graph-structured stack / shared packed forest)
+        stencil(
+            os, R"(
+    // GLR support
+    //   when a conflicted action is met, the parser leaves the deterministic
+    //   stack as is and continues on a graph-structured stack (GSS).
+    //   reductions are recorded in a shared packed forest and replayed on
+    //   the deterministic stack (with semantic actions) as soon as the GSS
+    //   has a single head and a single path down to the deterministic stack.
+    //   among local ambiguities, the first derivation found wins.
+    //   a reduction enumerates every path of its length down from the
+    //   head, so highly ambiguous input is polynomial but steep: for
+    //   "E : E + E | n" (samples/grammar/glr1.cpg) time grows about n^3.6
+    //   and memory about n^3 in the number of terms (0.8s for 100 terms,
+    //   10s for 200).
+    struct glr_node;
+    struct glr_forest;
+
+    struct glr_link {
+        glr_node*   prev;   // 0 = stack frame below (materialized lazily)
+        glr_forest* forest;
+    };
+
+    struct glr_node {
+        int                     state;
+        int                     frame;  // index of stack frame, or -1
+        std::vector<glr_link>   links;
+    };
+
+    struct glr_forest {
+        int                         rule;   // -1 = leaf (shifted value)
+        int                         state;
+        value_type                  value;
+        std::vector<glr_forest*>    children;
+        glr_forest*                 alternative;
+    };
+
+    struct glr_reduction {
+        glr_node*   node;
+        int         rule;
+        glr_node*   via_node;   // reduce only along paths via this link
+        int         via_link;
+    };
+
+    struct glr_rule_entry {
+        Nonterminal nonterminal;
+        int         length;
+    };
+
+    typedef std::pair<glr_node*, std::vector<glr_forest*> > glr_path;
+
+    bool                    glr_active_;
+    int                     glr_base_;
+    std::deque<glr_node>    glr_nodes_;
+    std::deque<glr_forest>  glr_forests_;
+    std::vector<glr_node*>  glr_heads_;
+    std::vector<glr_node*>  glr_frame_nodes_;
+
+    void glr_clear() {
+        glr_active_ = false;
+        glr_base_ = 0;
+        glr_nodes_.clear();
+        glr_forests_.clear();
+        glr_heads_.clear();
+        glr_frame_nodes_.clear();
+    }
+
+    glr_node* glr_new_node(int state, int frame) {
+        glr_nodes_.push_back(glr_node());
+        glr_node* n = &glr_nodes_.back();
+        n->state = state;
+        n->frame = frame;
+        return n;
+    }
+
+    glr_forest* glr_new_forest(int rule, int state, const value_type& value) {
+        glr_forests_.push_back(glr_forest());
+        glr_forest* f = &glr_forests_.back();
+        f->rule = rule;
+        f->state = state;
+        f->value = value;
+        f->alternative = 0;
+        return f;
+    }
+
+    glr_node* glr_frame_node(int index) {
+        if (glr_frame_nodes_[index]) { return glr_frame_nodes_[index]; }
+        stack_frame& f = stack_.nth(index);
+        glr_node* n = glr_new_node(int(f.entry - entry(0)), index);
+        if (0 < index) {
+            glr_link l = { 0, glr_new_forest(-1, n->state, f.value) };
+            n->links.push_back(l);
+        }
+        glr_frame_nodes_[index] = n;
+        return n;
+    }
+
+    glr_node* glr_prev(glr_node* n, size_t i) {
+        if (!n->links[i].prev) {
+            n->links[i].prev = glr_frame_node(n->frame - 1);
+        }
+        return n->links[i].prev;
+    }
+
+    glr_node* glr_find(const std::vector<glr_node*>& v, int state) {
+        for (size_t i = 0 ; i < v.size() ; i++) {
+            if (v[i]->state == state) { return v[i]; }
+        }
+        return 0;
+    }
+
+    bool glr_start(token_type token, const value_type& value) {
+        glr_clear();
+        glr_active_ = true;
+        int depth = int(stack_.depth());
+        glr_base_ = depth - 1;
+        glr_frame_nodes_.resize(depth, 0);
+
+        // the root is a copy of the top frame,
+        // so that frame nodes never get additional links
+        stack_frame& top = stack_.nth(depth - 1);
+        glr_node* root = glr_new_node(int(top.entry - entry(0)), -1);
+        if (1 < depth) {
+            glr_link l = {
+                glr_frame_node(depth - 2),
+                glr_new_forest(-1, root->state, top.value) };
+            root->links.push_back(l);
+        }
+        glr_heads_.push_back(root);
+
+        glr_post(token, value);
+        return false;
+    }
+
+    void glr_post(token_type token, const value_type& value) {
+        // reduce
+        std::vector<glr_reduction> queue;
+        for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+            glr_enqueue(queue, glr_heads_[i], token, 0, -1);
+        }
+        while (!queue.empty()) {
+            glr_reduction r = queue.back();
+            queue.pop_back();
+            glr_reduce_paths(queue, r, token);
+        }
+
+        // shift / accept
+        glr_node* accepted = 0;
+        std::vector<glr_node*> next;
+        for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+            glr_node* head = glr_heads_[i];
+            const int* codes;
+            int n = glr_actions(head->state, token, codes);
+            for (int j = 0 ; j < n ; j++) {
+                if (codes[j] == 2 && !accepted) { accepted = head; }
+                if ((codes[j] & 3) != 0) { continue; }
+
+                int dest = codes[j] >> 2;
+                glr_node* w = glr_find(next, dest);
+                glr_link l = { head, 0 };
+                if (w) {
+                    l.forest = w->links[0].forest;
+                } else {
+                    w = glr_new_node(dest, -1);
+                    l.forest = glr_new_forest(-1, dest, value);
+                    next.push_back(w);
+                }
+                w->links.push_back(l);
+            }
+        }
+
+        if (accepted) {
+            glr_collapse(accepted);
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return;
+        }
+        if (next.empty()) {
+            glr_clear();
+            sa_.syntax_error();
+            error_ = true;
+            return;
+        }
+
+        glr_heads_.swap(next);
+        if (glr_heads_.size() == 1 && glr_linear(glr_heads_[0])) {
+            glr_collapse(glr_heads_[0]);
+        }
+    }
+
+    void glr_enqueue(std::vector<glr_reduction>& queue, glr_node* node,
+                     token_type token, glr_node* via_node, int via_link) {
+        const int* codes;
+        int n = glr_actions(node->state, token, codes);
+        for (int j = 0 ; j < n ; j++) {
+            if ((codes[j] & 3) != 1) { continue; }
+            int rule = codes[j] >> 2;
+            if (via_node && glr_rule(rule).length == 0) { continue; }
+            glr_reduction r = { node, rule, via_node, via_link };
+            queue.push_back(r);
+        }
+    }
+
+    void glr_reduce_paths(std::vector<glr_reduction>& queue,
+                          const glr_reduction& r, token_type token) {
+        const glr_rule_entry& re = glr_rule(r.rule);
+
+        std::vector<glr_path> paths;
+        std::vector<glr_forest*> children;
+        glr_collect_paths(
+            paths, children, r.node, re.length, r, r.via_node == 0);
+
+        for (size_t i = 0 ; i < paths.size() ; i++) {
+            glr_node* u = paths[i].first;
+            int dest = (this->*(entry(u->state)->gotof))(re.nonterminal);
+            glr_forest* f = glr_new_forest(r.rule, dest, value_type());
+            f->children.swap(paths[i].second);
+
+            glr_node* w = glr_find(glr_heads_, dest);
+            if (!w) {
+                w = glr_new_node(dest, -1);
+                glr_link l = { u, f };
+                w->links.push_back(l);
+                glr_heads_.push_back(w);
+                glr_enqueue(queue, w, token, 0, -1);
+                continue;
+            }
+
+            int k = -1;
+            for (size_t j = 0 ; j < w->links.size() ; j++) {
+                if (w->links[j].prev == u && 0 <= w->links[j].forest->rule) {
+                    k = int(j);
+                    break;
+                }
+            }
+            if (0 <= k) {
+                // local ambiguity: pack into the existing derivation
+                glr_forest* g = w->links[k].forest;
+                f->alternative = g->alternative;
+                g->alternative = f;
+            } else {
+                // new link: reductions through it must be done again
+                glr_link l = { u, f };
+                w->links.push_back(l);
+                int index = int(w->links.size()) - 1;
+                for (size_t j = 0 ; j < glr_heads_.size() ; j++) {
+                    glr_enqueue(queue, glr_heads_[j], token, w, index);
+                }
+            }
+        }
+    }
+
+    void glr_collect_paths(std::vector<glr_path>& paths,
+                           std::vector<glr_forest*>& children,
+                           glr_node* node, int n,
+                           const glr_reduction& r, bool via) {
+        if (n == 0) {
+            if (via) {
+                paths.push_back(
+                    glr_path(
+                        node,
+                        std::vector<glr_forest*>(
+                            children.rbegin(), children.rend())));
+            }
+            return;
+        }
+        for (size_t i = 0 ; i < node->links.size() ; i++) {
+            glr_node* prev = glr_prev(node, i);
+            children.push_back(node->links[i].forest);
+            glr_collect_paths(
+                paths, children, prev, n - 1, r,
+                via || (node == r.via_node && int(i) == r.via_link));
+            children.pop_back();
+        }
+    }
+
+    bool glr_linear(glr_node* n) {
+        while (n->frame < 0 && !n->links.empty()) {
+            if (n->links.size() != 1) { return false; }
+            n = n->links[0].prev;
+        }
+        return true;
+    }
+
+    void glr_collapse(glr_node* head) {
+        // choose a path down to the deterministic stack
+        std::vector<glr_forest*> chain;
+        glr_node* n = head;
+        while (n->frame < 0 && !n->links.empty()) {
+            chain.push_back(n->links[0].forest);
+            n = glr_prev(n, 0);
+        }
+        int base = n->frame < 0 ? glr_base_ : n->frame;
+
+        // replay the derivation with semantic actions
+        glr_active_ = false;
+        stack_.pop(stack_.depth() - (base + 1));
+        for (size_t i = chain.size() ; 0 < i ; i--) {
+            if (!glr_replay(chain[i - 1])) { break; }
+        }
+        glr_clear();
+    }
+
+    bool glr_replay(glr_forest* f) {
+        if (f->rule < 0) {
+            return push_stack(f->state, f->value);
+        }
+        for (size_t i = 0 ; i < f->children.size() ; i++) {
+            if (!glr_replay(f->children[i])) { return false; }
+        }
+        return glr_reduce(f->rule);
+    }
+
+)"
+            );
+
+        // GLR tables
+        std::vector<int> glr_index;
+        std::vector<int> glr_keys;
+        std::vector<int> glr_codes;
+        for (const auto& state: table.states()) {
+            glr_index.push_back(int(glr_keys.size()));
+            for (const auto& pair: state.action_table) {
+                glr_keys.push_back(pair.first);
+                glr_keys.push_back(int(glr_codes.size()));
+                glr_codes.push_back(glr_action_code(pair.second));
+                auto c = state.conflict_table.find(pair.first);
+                if (c != state.conflict_table.end()) {
+                    for (const auto& x: (*c).second) {
+                        glr_codes.push_back(glr_action_code(x));
+                    }
+                }
+                glr_keys.push_back(int(glr_codes.size()));
+            }
+        }
+        glr_index.push_back(int(glr_keys.size()));
+
+        auto int_array = [](std::ostream& os, const std::vector<int>& v) {
+            for (size_t i = 0 ; i < v.size() ; i++) {
+                if (i % 12 == 0) { os << (i == 0 ? "" : "\n") << "            "; }
+                os << v[i] << ", ";
+            }
+            os << "\n";
+        };
+
+        stencil(
+            os, R"(
+    int glr_actions(int state, token_type token, const int*& codes) const {
+        static const int index[] = {
+$${index}
+        };
+        static const int keys[] = { // token, begin, end
+$${keys}
+        };
+        static const int actions[] = {
+$${codes}
+        };
+        for (int i = index[state] ; i < index[state + 1] ; i += 3) {
+            if (keys[i] == int(token)) {
+                codes = &actions[keys[i + 1]];
+                return keys[i + 2] - keys[i + 1];
+            }
+        }
+        return 0;
+    }
+
+    const glr_rule_entry& glr_rule(int rule) const {
+        static const glr_rule_entry rules[] = {
+$${rules}
+        };
+        return rules[rule];
+    }
+
+    bool glr_reduce(int rule) {
+        switch (rule) {
+$${reduces}
+        default: assert(0); return false;
+        }
+    }
+
+)",
+            {"index", [&](std::ostream& os) { int_array(os, glr_index); }},
+            {"keys", [&](std::ostream& os) { int_array(os, glr_keys); }},
+            {"codes", [&](std::ostream& os) { int_array(os, glr_codes); }},
+            {"rules", [&](std::ostream& os) {
+                    for (const auto& rule: table.get_grammar()) {
+                        if (rule == table.get_grammar().root_rule()) {
+                            stencil(
+                                os, R"(
+            { Nonterminal(0), 1 }, // ${rule}
+)",
+                                {"rule", rule.left().name()}
+                                );
+                        } else {
+                            stencil(
+                                os, R"(
+            { Nonterminal_${nonterminal}, ${length} },
+)",
+                                {"nonterminal", rule.left().name()},
+                                {"length", rule.right().size()}
+                                );
+                        }
+                    }
+                }},
+            {"reduces", [&](std::ostream& os) {
+                    for (size_t i = 0 ; i < ir.rules.size() ; i++) {
+                        if (ir.rules[i].nonterminal < 0) { continue; }
+                        stencil(
+                            os, R"(
+        case ${rule_id}: return ${call};
+)",
+                            {"rule_id", i},
+                            {"call", reduce_call(int(i))}
+                            );
+                    }
+                }}
+            );
+    }
+
     // states handler
-    for (const auto& state: table.states()) {
-        // state header
+    //   handlers are rendered first and emitted once per distinct body;
+    //   states whose bodies come out identical (e.g. states that reduce
+    //   the same rule, states that only differ in number) share the
+    //   function through table_entry.
+    std::map<std::string, int> state_bodies;
+    std::map<std::string, int> gotof_bodies;
+    std::vector<int> state_functions;
+    std::vector<int> gotof_functions;
+
+    // member function definition
+    //   inside the class, or with %split only its declaration; the
+    //   definition and its explicit instantiation are kept for the .cpp
+    //   files then.
+    std::vector<std::pair<std::string, std::string>> split_members;
+    auto define_member = [&](
+        const std::string&  result,
+        const std::string&  declarator,
+        const std::string&  body) {
+        if (!split) {
+            stencil(
+                os, R"(
+    ${result} ${declarator} {
+${body}    }
+
+)",
+                {"result", result},
+                {"declarator", declarator},
+                {"body", body}
+                );
+            return;
+        }
+
         stencil(
             os, R"(
-    bool state_${state_no}(token_type token, const value_type& value) {
+    ${result} ${declarator};
+)",
+            {"result", result},
+            {"declarator", declarator}
+            );
+
+        std::stringstream definition;
+        stencil(
+            definition, R"(
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::${declarator} -> ${result} {
+${body}}
+
+)",
+            {"result", result},
+            {"declarator", declarator},
+            {"body", body}
+            );
+        std::stringstream instantiation;
+        stencil(
+            instantiation, R"(
+template auto Parser<${value}, ${action}>::${declarator} -> ${result};
+)",
+            {"value", options.split_value},
+            {"action", options.split_action},
+            {"result", result},
+            {"declarator", declarator}
+            );
+        split_members.push_back(
+            std::make_pair(definition.str(), instantiation.str()));
+    };
+
+    for (const auto& state: ir.states) {
+        std::stringstream body;
+
+        // state body header
+        //   a consistent state reduces without looking at the token
+        stencil(
+            body, R"(
 $${debmes:state}
-        switch(token) {
+$${switch}
 )",
-            {"state_no", state.no},
+            {"switch", {state.consistent ? "" : "        switch(token) {\n"}},
             {"debmes:state", [&](std::ostream& os){
                     if (options.debug_parser) {
                         stencil(
@@ -987,179 +2675,149 @@ $${debmes:state}
                     }}}
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag = options.token_prefix + tokens[token];
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "default:".
+        //   states that handle error have none (see make_lalr_table).
+        std::stringstream dispatch;
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        for (const auto& c: cases) {
+            // fall through, be aware when port to other language
+            if (c.tokens.empty() && !state.consistent) {
+                case_label(dispatch, "");
+            }
+            for (int token: c.tokens) {
+                case_label(dispatch, options.token_prefix + tokens[token]);
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
-                        os, R"(
-        case ${case_tag}:
+                        dispatch, R"(
             // shift
+$${profile}
             push_stack(/*state*/ ${dest_index}, value);
             return false;
 )",
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value},
+                        {"profile", {profile_call(
+                                    "profile_shift(" +
+                                    std::to_string(state.no) + ", token, " +
+                                    std::to_string(action.value) + ");")}}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature,
-                            options.smart_pointer_tag);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
-                        stencil(
-                            os, R"(
-        case ${case_tag}:
-)",
-                            {"case_tag", case_tag}
-                            );
-                        std::string funcname = "call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = sa.name;
-                        }
-                        stencil(
-                            os, R"(
+                case TableIR::Reduce:
+                    stencil(
+                        dispatch, R"(
             // reduce
-            return ${funcname}(Nonterminal_${nonterminal}, /*pop*/ ${base});
+$${profile}
+            return ${call};
 )",
-                            {"funcname", funcname},
-                            {"nonterminal", rule.left().name()},
-                            {"base", base}
-                            );
-                    }
-                }
+                        {"profile", {profile_call(
+                                    "profile_reduce(" +
+                                    std::to_string(state.no) + ", token, " +
+                                    std::to_string(action.value) + ");")}},
+                        {"call", reduce_call(action.value)}
+                        );
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
-                        os, R"(
-        case ${case_tag}:
+                        dispatch, R"(
             // accept
+$${profile}
             accepted_ = true;
             accepted_value_ = get_arg(1, 0);
             return false;
 )",
-                        {"case_tag", case_tag}
+                        {"profile", {profile_call(
+                                    "profile_accept(" +
+                                    std::to_string(state.no) + ", token);")}}
                         );
                     break;
-                case zw::gr::action_error:
+                case TableIR::Error:
                     stencil(
-                        os, R"(
-        case ${case_tag}:
-            sa_.syntax_error();
+                        dispatch, R"(
+$${profile}
+            ${syntax_error}();
             error_ = true;
             return false;
 )",
-                        {"case_tag", case_tag}
+                        {"profile", {profile_call(
+                                    "profile_error(" +
+                                    std::to_string(state.no) + ", token);")}},
+                        {"syntax_error", syntax_error}
+                        );
+                    break;
+                case TableIR::Conflict:
+                    // conflicted actions are resolved by GLR
+                    stencil(
+                        dispatch, R"(
+            // conflict
+            return glr_start(token, value);
+)"
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            for (size_t j = 0 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                stencil(
-                    os, R"(
-        case ${case}:
-)",
-                    {"case", cases[j]}
-                    );
-            }
-
-            int index = stub_indices[signature];
-
-            stencil(
-                os, R"(
-            // reduce
-            return call_${index}_${sa_name}(Nonterminal_${nonterminal}, /*pop*/ ${base}${args});
-)",
-                {"index", index},
-                {"sa_name", normalize_internal_sa_name(signature[0])},
-                {"nonterminal", nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
-                );
+        // one level shallower without "switch"
+        std::string line;
+        while (std::getline(dispatch, line)) {
+            body << (state.consistent && 4 <= line.size() ?
+                     line.substr(4) : line) << "\n";
         }
 
-        // dispatcher footer / state footer
-        stencil(
-            os, R"(
+        // dispatcher footer
+        if (!default_reduce) {
+            stencil(
+                body, R"(
         default:
-            sa_.syntax_error();
+$${profile}
+            ${syntax_error}();
             error_ = true;
             return false;
+)",
+                {"profile", {profile_call(
+                            "profile_error(" +
+                            std::to_string(state.no) + ", token);")}},
+                {"syntax_error", syntax_error}
+                );
+        }
+        if (!state.consistent) {
+            stencil(
+                body, R"(
         }
-    }
-
 )"
-            );
+                );
+        }
 
-        // gotof header
-        stencil(
-            os, R"(
-    int gotof_${state_no}(Nonterminal nonterminal) {
+        // state function
+        auto s = state_bodies.insert(std::make_pair(body.str(), state.no));
+        state_functions.push_back(s.first->second);
+        if (s.second) {
+            define_member(
+                "bool",
+                "state_" + std::to_string(state.no) +
+                "(token_type token, const value_type& value)",
+                body.str());
+        }
+
+        // gotof body
+        std::stringstream gotof_body;
+        if (options.profile) {
+            stencil(
+                gotof_body, R"(
+        profile_goto(${state_no});
 )",
-            {"state_no", state.no}
-            );
+                {"state_no", state.no}
+                );
+        }
             
         // gotof dispatcher
         std::stringstream ss;
@@ -1169,12 +2827,12 @@ $${debmes:state}
 )"
             );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
         case Nonterminal_${nonterminal}: return ${state_index};
 )",
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
@@ -1188,50 +2846,56 @@ $${debmes:state}
 )"
             );
         if (output_switch) {
-            os << ss.str();
+            gotof_body << ss.str();
         } else {
             stencil(
-                os, R"(
+                gotof_body, R"(
         assert(0);
         return true;
 )"
                 );
         }
-        stencil(os, R"(
-    }
-
-)"
-            );
-
 
+        // gotof function
+        auto g = gotof_bodies.insert(
+            std::make_pair(gotof_body.str(), state.no));
+        gotof_functions.push_back(g.first->second);
+        if (g.second) {
+            define_member(
+                "int",
+                "gotof_" + std::to_string(state.no) +
+                "(Nonterminal nonterminal)",
+                gotof_body.str());
+        }
     }
 
     // table
+    std::stringstream entry_body;
     stencil(
-        os, R"(
-    const table_entry* entry(int n) const {
+        entry_body, R"(
         static const table_entry entries[] = {
 $${entries}
         };
         return &entries[n];
-    }
-
 )",
         {"entries", [&](std::ostream& os) {
                 int i = 0;
                 for (const auto& state: table.states()) {
                     stencil(
                         os, R"(
-            { &Parser::state_${i}, &Parser::gotof_${i}, ${handle_error} },
+            { &Parser::state_${state}, &Parser::gotof_${gotof}, ${handle_error}, ${consistent} },
 )",
                             
-                        {"i", i},
-                        {"handle_error", state.handle_error}
+                        {"state", state_functions[i]},
+                        {"gotof", gotof_functions[i]},
+                        {"handle_error", state.handle_error},
+                        {"consistent", ir.states[i].consistent}
                         );
                     ++i;
                 }                    
             }}
         );
+    define_member("const table_entry*", "entry(int n) const", entry_body.str());
 
     // parser class footer
     // namespace footer
@@ -1249,4 +2913,56 @@ $${entries}
         {"headername", {headername}},
         {"namespace_name", {options.namespace_name}}
         );
+
+    if (!split) { return; }
+
+    // split compilation units
+    //   <output>_0.cpp .. <output>_N-1.cpp, each defines a contiguous
+    //   run of the members, so that the shards compile in parallel.
+    std::string split_base = src_filename;
+    size_t dot = split_base.find_last_of('.');
+    if (dot != std::string::npos &&
+        split_base.find_first_of("/\\", dot) == std::string::npos) {
+        split_base.erase(dot);
+    }
+
+    size_t n = split_members.size();
+    size_t shards = options.split_shards;
+    for (size_t k = 0 ; k < shards ; k++) {
+        std::string path = split_base + "_" + std::to_string(k) + ".cpp";
+        std::ofstream ofs(path.c_str());
+        if (!ofs) {
+            throw cant_open_output(path);
+        }
+
+        size_t b = n * k / shards;
+        size_t e = n * (k + 1) / shards;
+        stencil(
+            ofs, R"(
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include "${include}"
+
+namespace ${namespace_name} {
+
+$${definitions}
+$${instantiations}
+
+} // namespace ${namespace_name}
+)",
+            {"include", options.split_include},
+            {"namespace_name", options.namespace_name},
+            {"definitions", [&](std::ostream& os) {
+                    for (size_t i = b ; i < e ; i++) {
+                        os << split_members[i].first;
+                    }
+                }},
+            {"instantiations", [&](std::ostream& os) {
+                    for (size_t i = b ; i < e ; i++) {
+                        os << split_members[i].second;
+                    }
+                }}
+            );
+    }
 }
@@ -15,6 +15,277 @@ struct semantic_action_entry {
         }
 };
 
+namespace {
+
+// %table: static table as ReadOnlySpan<short>, or <int> if it does not fit
+void write_csharp_table(
+        std::ostream&                   os,
+        const char*                     name,
+        const std::vector<int>&         v )
+{
+        bool fits = true;
+        for( int x: v ) {
+                if( x < -32768 || 32767 < x ) { fits = false; break; }
+        }
+        const char* type = fits ? "short" : "int";
+        os << "		private static ReadOnlySpan<" << type << "> " << name
+           << " => new " << type << "[] {";
+        for( size_t i = 0 ; i < v.size() ; i++ ) {
+                if( i % 16 == 0 ) { os << "\n			"; }
+                os << v[i] << ",";
+        }
+        os << "\n		};\n";
+}
+
+void generate_csharp_table_parser(
+        std::ostream&                           os,
+        const GenerateOptions&                  options,
+        const std::map<std::string, Type>&      nonterminal_types,
+        const TableIR&                          ir )
+{
+        // parser class
+        //   TValue is the type of the semantic values on the stack. values
+        //   of that type are not boxed when they are passed to the
+        //   semantic actions.
+        os << "	" << options.access_modifier << "class Parser<TValue> : IDisposable\n"
+           << "	{\n";
+
+        // tables
+        //   action code: shift dest << 2 | reduce rule << 2 | 1 |
+        //   accept 2 | error 3
+        std::vector<int> rule_length;
+        std::vector<int> rule_nonterminal;
+        for( const auto& rule: ir.rules ) {
+                rule_length.push_back( rule.length );
+                rule_nonterminal.push_back( rule.nonterminal );
+        }
+        write_csharp_table( os, "TokenClass", ir.token_class );
+        write_csharp_table( os, "ActionBase", ir.action_base );
+        write_csharp_table( os, "ActionCheck", ir.action_check );
+        write_csharp_table( os, "ActionNext", ir.action_next );
+        write_csharp_table( os, "ActionDefault", ir.action_default );
+        write_csharp_table( os, "GotoBase", ir.goto_base );
+        write_csharp_table( os, "GotoCheck", ir.goto_check );
+        write_csharp_table( os, "GotoNext", ir.goto_next );
+        write_csharp_table( os, "RuleLength", rule_length );
+        write_csharp_table( os, "RuleNonterminal", rule_nonterminal );
+        os << "\n";
+
+        // stack
+        //   frames are rented from ArrayPool and returned by Dispose().
+        //   committed frames are [0, mark). while posting, frames popped
+        //   from them are [gap, mark) and pushed frames are [mark, top),
+        //   so a failed post leaves the committed stack as it was.
+        os << "		private struct StackFrame\n"
+           << "		{\n"
+           << "			public int state;\n"
+           << "			public TValue value;\n"
+           << "		}\n\n"
+
+           << "		private StackFrame[] frames = ArrayPool<StackFrame>.Shared.Rent(64);\n"
+           << "		private int gap;\n"
+           << "		private int mark;\n"
+           << "		private int top;\n\n"
+
+           << "		private void push(int state, TValue value)\n"
+           << "		{\n"
+           << "			if(top == frames.Length)\n"
+           << "			{\n"
+           << "				StackFrame[] a = ArrayPool<StackFrame>.Shared.Rent(top * 2);\n"
+           << "				Array.Copy(frames, a, top);\n"
+           << "				ArrayPool<StackFrame>.Shared.Return(frames, true);\n"
+           << "				frames = a;\n"
+           << "			}\n"
+           << "			frames[top].state = state;\n"
+           << "			frames[top].value = value;\n"
+           << "			++top;\n"
+           << "		}\n\n"
+
+           << "		private void pop(int n)\n"
+           << "		{\n"
+           << "			int t = top - mark;\n"
+           << "			if(t < n)\n"
+           << "			{\n"
+           << "				top = mark;\n"
+           << "				gap -= n - t;\n"
+           << "			}else\n"
+           << "			{\n"
+           << "				top -= n;\n"
+           << "			}\n"
+           << "		}\n\n"
+
+           << "		private int state_top()\n"
+           << "		{\n"
+           << "			return mark < top ? frames[top - 1].state : frames[gap - 1].state;\n"
+           << "		}\n\n"
+
+           << "		private TValue get_arg(int b, int i)\n"
+           << "		{\n"
+           << "			int k = b - i;\n"
+           << "			int t = top - mark;\n"
+           << "			return k <= t ? frames[top - k].value : frames[gap - (k - t)].value;\n"
+           << "		}\n\n"
+
+           << "		private void commit()\n"
+           << "		{\n"
+           << "			int n = top - mark;\n"
+           << "			Array.Copy(frames, mark, frames, gap, n);\n"
+           << "			Array.Clear(frames, gap + n, top - (gap + n));\n"
+           << "			mark = gap + n;\n"
+           << "			gap = mark;\n"
+           << "			top = mark;\n"
+           << "		}\n\n"
+
+        // constructor
+           << "		public Parser(ISemanticAction sa)\n"
+           << "		{\n"
+           << "			this.sa = sa;\n"
+           << "			this.reset();\n"
+           << "		}\n\n"
+
+        // public member
+           << "		public void reset()\n"
+           << "		{\n"
+           << "			this.error = false;\n"
+           << "			this.accepted = false;\n"
+           << "			this.accepted_value = default(TValue);\n"
+           << "			Array.Clear(frames, 0, frames.Length);\n"
+           << "			gap = mark = top = 0;\n"
+           << "			push(" << ir.first_state << ", default(TValue));\n"
+           << "			commit();\n"
+           << "		}\n\n"
+
+           << "		public void Dispose()\n"
+           << "		{\n"
+           << "			if(frames != null)\n"
+           << "			{\n"
+           << "				ArrayPool<StackFrame>.Shared.Return(frames, true);\n"
+           << "				frames = null;\n"
+           << "			}\n"
+           << "		}\n\n"
+
+           << "		public bool post(Token token, TValue value)\n"
+           << "		{\n"
+           << "			System.Diagnostics.Debug.Assert(!this.error);\n"
+           << "			var token_class = TokenClass;\n"
+           << "			var action_base = ActionBase;\n"
+           << "			var action_check = ActionCheck;\n"
+           << "			var action_next = ActionNext;\n"
+           << "			var action_default = ActionDefault;\n"
+           << "			int c = token_class[(int)token];\n"
+           << "			for(;;)\n"
+           << "			{\n"
+           << "				int s = state_top();\n"
+           << "				int i = action_base[s] + c;\n"
+           << "				int code = action_check[i] == c ? action_next[i] : action_default[s];\n"
+           << "				int kind = code & 3;\n"
+           << "				if(kind == 1)\n"
+           << "				{\n"
+           << "					reduce(code >> 2);\n"
+           << "				}else if(kind == 0)\n"
+           << "				{\n"
+           << "					push(code >> 2, value);\n"
+           << "					break;\n"
+           << "				}else if(kind == 2)\n"
+           << "				{\n"
+           << "					this.accepted = true;\n"
+           << "					this.accepted_value = get_arg(1, 0);\n" // implicit root
+           << "					break;\n"
+           << "				}else\n"
+           << "				{\n"
+           << "					this.sa.syntax_error();\n"
+           << "					this.error = true;\n"
+           << "					break;\n"
+           << "				}\n"
+           << "			}\n"
+           << "			if( !this.error )\n"
+           << "			{\n"
+           << "				commit();\n"
+           << "			}else\n"
+           << "			{\n"
+           << "				gap = top = mark;\n"
+           << "			}\n"
+           << "			return this.accepted;\n"
+           << "		}\n\n"
+
+           << "		public bool accept(out TValue v)\n"
+           << "		{\n"
+           << "			System.Diagnostics.Debug.Assert(this.accepted);\n"
+           << "			if(this.error) { v = default(TValue); return false; }\n"
+           << "			v = this.accepted_value;\n"
+           << "			return true;\n"
+           << "		}\n\n"
+
+           << "		public bool Error() { return this.error; }\n\n"
+
+        // private member
+           << "		private ISemanticAction sa;\n"
+           << "		private bool accepted;\n"
+           << "		private bool error;\n"
+           << "		private TValue accepted_value;\n\n";
+
+        // reduction
+        //   one case for each rule the table reduces by. (T)(object)x is
+        //   no boxing when T is TValue.
+        std::vector<bool> reduced( ir.rules.size() );
+        for( const auto& s: ir.states ) {
+                for( const auto& c: s.cases ) {
+                        if( c.action.kind == TableIR::Reduce ) { reduced[c.action.value] = true; }
+                }
+                if( s.default_action.kind == TableIR::Reduce ) {
+                        reduced[s.default_action.value] = true;
+                }
+        }
+
+        os << "		private void reduce(int rule)\n"
+           << "		{\n"
+           << "			int b = RuleLength[rule];\n"
+           << "			TValue v = default(TValue);\n"
+           << "			switch(rule)\n"
+           << "			{\n";
+        for( size_t r = 0 ; r < ir.rules.size() ; r++ ) {
+                const TableIR::Rule& rule = ir.rules[r];
+                if( !reduced[r] || !rule.action ) { continue; }
+                const SemanticAction& sa = *rule.action;
+                os << "			case " << r << ":\n"
+                   << "				{\n";
+                for( size_t l = 0 ; l < sa.args.size() ; l++ ) {
+                        const SemanticAction::Argument& arg = sa.args[l];
+                        os << "					" << arg.type.name << " arg" << l
+                           << " = (" << arg.type.name << ")(object)get_arg(b, "
+                           << arg.source_index << ");\n";
+                }
+                os << "					"
+                   << (*nonterminal_types.find( ir.nonterminals[rule.nonterminal] )).second.name
+                   << " r; this.sa." << sa.name << "( out r";
+                for( size_t l = 0 ; l < sa.args.size() ; l++ ) {
+                        os << ", arg" << l;
+                }
+                os << " );\n"
+                   << "					v = (TValue)(object)r;\n"
+                   << "				}\n"
+                   << "				break;\n";
+        }
+        os << "			}\n"
+           << "			pop(b);\n"
+           << "			int s = state_top();\n"
+           << "			int nonterminal = RuleNonterminal[rule];\n"
+           << "			int i = GotoBase[s] + nonterminal;\n"
+           << "			System.Diagnostics.Debug.Assert(GotoCheck[i] == nonterminal);\n"
+           << "			push(GotoNext[i], v);\n"
+           << "		}\n\n"
+
+           << "	} // class Parser<TValue>\n\n"
+
+        // Parser for values of any type, as the non-table output
+           << "	" << options.access_modifier << "class Parser : Parser<object>\n"
+           << "	{\n"
+           << "		public Parser(ISemanticAction sa) : base(sa) {}\n"
+           << "	}\n\n";
+}
+
+} // unnamed namespace
+
 void generate_csharp(
     const std::string&                  src_filename,
     std::ostream&                       os,
@@ -23,16 +294,36 @@ void generate_csharp(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
     if (options.allow_ebnf) {
         throw unsupported_feature("C#", "EBNF");
     }
+    if (options.glr) {
+        throw unsupported_feature("C#", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("C#", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("C#", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("C#", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("C#", "%split");
+    }
 
         os << "// This file was automatically generated by Caper.\n"
            << "// (http://jonigata.github.io/caper/caper.html)\n\n";
 
         // using header
+        if( options.table ) {
+                os << "using System;\n"
+                   << "using System.Buffers;\n";
+        }
         os << "using System.Collections.Generic;\n\n";
 
         // namespace header
@@ -124,6 +415,12 @@ void generate_csharp(
 
         os << "\t}\n\n";
 
+        if( options.table ) {
+                generate_csharp_table_parser( os, options, nonterminal_types, ir );
+                os << "} // namespace " << options.namespace_name;
+                return;
+        }
+
         // parser class
         os << "	" << options.access_modifier << "class Parser\n"
            << "	{\n"
@@ -327,48 +624,23 @@ void generate_csharp(
                 ;
         
         // states handler
-        for( tgt::parsing_table::states_type::const_iterator i = table.states().begin();
-             i != table.states().end() ;
-             ++i) {
-                const tgt::parsing_table::state& s = *i;
-
+        for( const auto& s: ir.states ) {
                 // gotof header
                 os << "		bool gotof_" << s.no << "(int nonterminal_index, object v)\n"
                    << "		{\n";
                 
                 // gotof dispatcher
-                std::stringstream ss;
-                ss << "			switch(nonterminal_index)\n"
-                   << "			{\n";
-
-                bool output_switch = false;
-                std::set<size_t> generated;
-                for( const auto& rule: table.get_grammar() ) {
-                        size_t nonterminal_index = std::distance(
-                                nonterminal_types.begin(),
-                                nonterminal_types.find( rule.left().name() ) );
-                        
-                        if( generated.find( nonterminal_index ) != generated.end() ) {
-                                continue;
-                        }
-                        
-                        tgt::parsing_table::state::goto_table_type::const_iterator k =
-                                (*i).goto_table.find(rule.left());
-                        
-                        if( k != (*i).goto_table.end() ) {
-                                ss << "				case " << nonterminal_index
-                                   << ": return push_stack( this.state_" << (*k).second
-                                   << ", this.gotof_" << (*k).second
+                if( !s.gotos.empty() ) {
+                        os << "			switch(nonterminal_index)\n"
+                           << "			{\n";
+                        for( const auto& x: s.gotos ) {
+                                os << "				case " << x.first
+                                   << ": return push_stack( this.state_" << x.second
+                                   << ", this.gotof_" << x.second
                                    << ", v );\n";
-                                output_switch = true;
-                                generated.insert( nonterminal_index );
                         }
-                }
-                
-                ss << "				default: System.Diagnostics.Debug.Assert(false); return false;\n"; 
-                ss << "			}\n";
-                if( output_switch ) {
-                        os << ss.str();
+                        os << "				default: System.Diagnostics.Debug.Assert(false); return false;\n"; 
+                        os << "			}\n";
                 } else {
                         os << "			System.Diagnostics.Debug.Assert(false);\n"
                            << "			return true;\n";
@@ -385,39 +657,43 @@ void generate_csharp(
                 os << "			switch(token)\n"
                    << "			{\n";
                 
-                // action table
-                for( tgt::parsing_table::state::action_table_type::const_iterator j = s.action_table.begin();
-                     j != s.action_table.end();
-                     ++j) {
+                // cases (the default reduction, if any, is the last one)
+                std::vector<TableIR::Case> cases = s.cases;
+                bool default_reduce = s.default_action.kind == TableIR::Reduce;
+                if( default_reduce ) {
+                        cases.push_back( TableIR::Case() );
+                        cases.back().action = s.default_action;
+                }
+
+                for( const auto& c: cases ) {
                         // action header 
-                        os << "				case Token." << options.token_prefix
-                           << tokens[(*j).first] << ":\n";
+                        if( c.tokens.empty() ) {
+                                os << "				default:\n";
+                        }
+                        for( int token: c.tokens ) {
+                                os << "				case Token." << options.token_prefix
+                                   << tokens[token] << ":\n";
+                        }
                         
                         // action
-                        const tgt::parsing_table::action* a = &(*j).second;
-                        switch( a->type ) {
-                        case zw::gr::action_shift:
+                        const TableIR::Action& a = c.action;
+                        switch( a.kind ) {
+                        case TableIR::Shift:
                                 os << "				// shift\n"
                                    << "				push_stack( "
-                                   << "this.state_" << a->dest_index << ", "
-                                   << "this.gotof_" << a->dest_index << ", "
+                                   << "this.state_" << a.value << ", "
+                                   << "this.gotof_" << a.value << ", "
                                    << "value);\n"
                                    << "				return false;\n";
                                 break;
-                        case zw::gr::action_reduce:
+                        case TableIR::Reduce:
                                 os << "				// reduce\n";
                                 {
-                                    size_t base = a->rule.right().size();
-				        
-                                    const tgt::parsing_table::rule_type& rule = a->rule;
-                                        action_map_type::const_iterator k = actions.find( rule );
-                                        
-                                        size_t nonterminal_index = std::distance(
-                                                nonterminal_types.begin(),
-                                                nonterminal_types.find( rule.left().name() ) );
+                                        const TableIR::Rule& rule = ir.rules[a.value];
+                                        int base = rule.length;
                                         
-                                        if( k != actions.end() ) {
-                                                const SemanticAction& sa = (*k).second;
+                                        if( rule.action ) {
+                                                const SemanticAction& sa = *rule.action;
                                                 
                                                 os << "				{\n";
                                                 // automatic argument conversion
@@ -431,7 +707,7 @@ void generate_csharp(
                                                 
                                                 // semantic action
                                                 os << "					"
-                                                   << (*nonterminal_types.find( rule.left().name() )).second.name
+                                                   << (*nonterminal_types.find( ir.nonterminals[rule.nonterminal] )).second.name
                                                    << " r; " << "this.sa." << sa.name << "( out r ";
                                                 for( size_t l = 0 ; l < sa.args.size() ; l++ ) {
                                                         os << ", arg" << l;
@@ -445,7 +721,7 @@ void generate_csharp(
                                                    << base
                                                    << ");\n";
                                                 os << "					return stack_top().gotof("
-                                                   << nonterminal_index << ", v);\n";
+                                                   << rule.nonterminal << ", v);\n";
                                                 os << "				}\n";
                                         } else {
                                                 os << "				// run_semantic_action();\n";
@@ -453,18 +729,18 @@ void generate_csharp(
                                                    << base
                                                    << ");\n";
                                                 os << "				return stack_top().gotof("
-                                                   << nonterminal_index << ", new object());\n";
+                                                   << rule.nonterminal << ", new object());\n";
                                         }
                                 }
                                 break;
-                        case zw::gr::action_accept:
+                        case TableIR::Accept:
                                 os << "				// accept\n"
                                    << "				// run_semantic_action();\n"
                                    << "				this.accepted = true;\n"
                                    << "				this.accepted_value  = get_arg( 1, 0 );\n" // implicit root
                                    << "				return false;\n";
                                 break;
-                        case zw::gr::action_error:
+                        default:
                                 os << "				this.sa.syntax_error();\n";
                                 os << "				this.error = true;\n"; 
                                 os << "				return false;\n";
@@ -475,11 +751,13 @@ void generate_csharp(
                 }
                 
                 // dispatcher footer
-                os << "			default:\n"
-                   << "				this.sa.syntax_error();\n"
-                   << "				this.error = true;\n"
-                   << "				return false;\n"
-                   << "			}\n"
+                if( !default_reduce ) {
+                        os << "			default:\n"
+                           << "				this.sa.syntax_error();\n"
+                           << "				this.error = true;\n"
+                           << "				return false;\n";
+                }
+                os << "			}\n"
                         
                 // state footer
                    << "		}\n\n";
@@ -4,13 +4,12 @@
 // $Id$
 
 #include "caper_ast.hpp"
+#include "caper_error.hpp"
 #include "caper_generate_cpp.hpp"
 #include "caper_format.hpp"
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
 #include <algorithm>
-#include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 #include <boost/filesystem/path.hpp>
 
 namespace {
@@ -30,23 +29,387 @@ std::string make_type_name(const Type& x) {
             return "";
     }
 }
-        
-void make_signature(
-    const std::map<std::string, Type>&      nonterminal_types,
-    const tgt::parsing_table::rule_type&    rule,
-    const SemanticAction&                   sa,
-    std::vector<std::string>&               signature) {
-    // function name
-    signature.push_back(sa.name);
-
-    // return value
-    signature.push_back(
-        make_type_name(*finder(nonterminal_types, rule.left().name())));
-
-    // arguments
-    for (const auto& arg: sa.args) {
-        signature.push_back(make_type_name(arg.type));
+
+// %table: immutable static array, short if every value fits
+void write_d_table(
+    std::ostream&           os,
+    const char*             name,
+    const char*             fit_type,
+    const std::vector<int>& v) {
+    bool fits = true;
+    for (int x: v) {
+        if (x < -32768 || 32767 < x) { fits = false; break; }
+    }
+    stencil(
+        os, R"(
+private immutable ${type}[${size}] ${name} = [${values}
+];
+)",
+        {"type", fits ? fit_type : "int"},
+        {"size", v.size()},
+        {"name", name},
+        {"values", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < v.size() ; i++) {
+                    if (i % 16 == 0) { os << "\n    "; }
+                    os << v[i] << ",";
+                }
+            }}
+        );
+}
+
+void generate_d_table_parser(
+    std::ostream&                       os,
+    const GenerateOptions&              options,
+    const std::map<std::string, Type>&  nonterminal_types,
+    const TableIR&                      ir) {
+    // tables
+    //   module level immutables, evaluated at compile time.
+    //   action code: shift dest << 2 | reduce rule << 2 | 1 |
+    //   accept 2 | error 3
+    std::vector<int> rule_length;
+    std::vector<int> rule_nonterminal;
+    for (const auto& rule: ir.rules) {
+        rule_length.push_back(rule.length);
+        rule_nonterminal.push_back(rule.nonterminal);
+    }
+    std::vector<int> handle_error;
+    for (const auto& state: ir.states) {
+        handle_error.push_back(state.handle_error ? 1 : 0);
+    }
+    write_d_table(os, "tokenClass", "short", ir.token_class);
+    write_d_table(os, "actionBase", "short", ir.action_base);
+    write_d_table(os, "actionCheck", "short", ir.action_check);
+    write_d_table(os, "actionNext", "short", ir.action_next);
+    write_d_table(os, "actionDefault", "short", ir.action_default);
+    write_d_table(os, "gotoBase", "short", ir.goto_base);
+    write_d_table(os, "gotoCheck", "short", ir.goto_check);
+    write_d_table(os, "gotoNext", "short", ir.goto_next);
+    write_d_table(os, "ruleLength", "short", rule_length);
+    write_d_table(os, "ruleNonterminal", "short", rule_nonterminal);
+    write_d_table(os, "handleError", "ubyte", handle_error);
+
+    // parser
+    //   no allocation: the stack is a buffer given by the caller
+    //   (capacity == 0) or a member of capacity frames. the stack
+    //   operations are @nogc nothrow, post() is inferred so as long as
+    //   the semantic action is.
+    //   committed frames are [0, mark). while posting, frames popped from
+    //   them are [gap, mark) and pushed frames are [mark, top), so a
+    //   failed post leaves the committed stack as it was.
+    stencil(
+        os, R"(
+
+struct Parser(Value, SemanticAction, size_t capacity = 0) {
+    alias Token TokenType;
+    alias Value ValueType;
+
+    enum Nonterminal {
+$${nonterminals}
+    }
+
+    struct StackFrame {
+        int         state;
+        ValueType   value;
+    }
+
+    static if (capacity == 0) {
+        this(SemanticAction sa, StackFrame[] buffer) {
+            _sa = sa;
+            _frames = buffer;
+            reset();
+        }
+    } else {
+        this(SemanticAction sa) { _sa = sa; reset(); }
+    }
+
+    void reset() {
+        _error = false;
+        _accepted = false;
+        _gap = _mark = _top = 0;
+        ValueType defaultValue;
+        if (push(${first_state}, defaultValue)) {
+            commit();
+        }
+    }
+
+    bool post(TokenType token, ValueType value) {
+        _gap = _top = _mark;
+        _error = false;
+        run(token, value);
+        if (!_error) {
+            commit();
+        } else {
+            recover(token, value);
+        }
+        return _accepted || _error;
+    }
+
+    bool accept(out ValueType v) {
+        assert(_accepted);
+        if (_error) { return false; }
+        v = _accepted_value;
+        return true;
+    }
+
+    bool error() { return _error; }
+
+private:
+    bool        _accepted;
+    bool        _error;
+    ValueType   _accepted_value;
+
+    SemanticAction _sa;
+
+    static if (capacity == 0) {
+        StackFrame[] _frames;
+    } else {
+        StackFrame[capacity] _frames;
+    }
+    size_t _gap;
+    size_t _mark;
+    size_t _top;
+
+    static int action(int state, int token) @nogc nothrow {
+        int c = tokenClass[token];
+        int i = actionBase[state] + c;
+        return actionCheck[i] == c ? actionNext[i] : actionDefault[state];
+    }
+
+    static int gotof(int state, int nonterminal) @nogc nothrow {
+        int i = gotoBase[state] + nonterminal;
+        assert(gotoCheck[i] == nonterminal);
+        return gotoNext[i];
+    }
+
+    bool push(int state, ValueType value) {
+        if (_top == _frames.length) {
+            _sa.stack_overflow();
+            _error = true;
+            return false;
+        }
+        _frames[_top].state = state;
+        _frames[_top].value = value;
+        ++_top;
+        return true;
+    }
+
+    void pop(size_t n) @nogc nothrow {
+        size_t t = _top - _mark;
+        if (t < n) {
+            _top = _mark;
+            _gap -= n - t;
+        } else {
+            _top -= n;
+        }
+    }
+
+    int stateTop() @nogc nothrow {
+        return _mark < _top ? _frames[_top - 1].state : _frames[_gap - 1].state;
+    }
+
+    ref ValueType getArg(size_t base, size_t index) @nogc nothrow {
+        size_t k = base - index;
+        size_t t = _top - _mark;
+        if (k <= t) {
+            return _frames[_top - k].value;
+        } else {
+            return _frames[_gap - (k - t)].value;
+        }
+    }
+
+    size_t depth() @nogc nothrow {
+        return _gap + _top - _mark;
+    }
+
+    void commit() @nogc nothrow {
+        size_t n = _top - _mark;
+        if (_gap != _mark) {
+            foreach (i; 0 .. n) {
+                _frames[_gap + i] = _frames[_mark + i];
+            }
+            foreach (i; _gap + n .. _top) {
+                _frames[i] = StackFrame.init;
+            }
+        }
+        _mark = _gap = _top = _gap + n;
+    }
+
+    void run(TokenType token, ValueType value) {
+        for (;;) {
+            int s = stateTop();
+$${debmes:state}
+            int code = action(s, token);
+            int kind = code & 3;
+            if (kind == 1) {
+                if (!reduce(code >> 2)) { return; }
+            } else if (kind == 0) {
+                push(code >> 2, value);
+                return;
+            } else if (kind == 2) {
+                _accepted = true;
+                _accepted_value = getArg(1, 0);
+                return;
+            } else {
+                _sa.syntax_error();
+                _error = true;
+                return;
+            }
+        }
+    }
+
+)",
+        {"nonterminals", [&](std::ostream& os) {
+                for (const auto& nonterminal: ir.nonterminals) {
+                    stencil(
+                        os, R"(
+        ${nonterminal_name},
+)",
+                        {"nonterminal_name", nonterminal}
+                        );
+                }
+            }},
+        {"first_state", ir.first_state},
+        {"debmes:state", [&](std::ostream& os){
+                if (options.debug_parser) {
+                    stencil(
+                        os, R"(
+            stderr.writefln("state_%d << %s", s, tokenLabel(token));
+)"
+                        );
+                }}}
+        );
+
+    if (options.recovery) {
+        stencil(
+            os, R"(
+    void recover(TokenType token, ValueType value) {
+        _gap = _top = _mark;
+        _error = false;
+$${debmes:start}
+        while(!handleError[stateTop()]) {
+            pop(1);
+            if (depth() == 0) {
+$${debmes:failed}
+                _error = true;
+                return;
+            }
+        }
+$${debmes:done}
+        // post error_token;
+        ValueType defaultValue;
+        run(Token.${recovery_token}, defaultValue);
+        commit();
+        // repost original token
+        // if it still causes error, discard it;
+        run(token, value);
+        if (!_error) {
+            commit();
+        }
+        if (token != Token.${token_eof}) {
+            _error = false;
+        }
+    }
+
+)",
+            {"recovery_token", options.token_prefix + options.recovery_token},
+            {"token_eof", options.token_prefix + "eof"},
+            {"debmes:start", {
+                    options.debug_parser ?
+                        R"(        stderr.writefln("recover rewinding start: stack depth = %d", depth());
+)" :
+                        ""}},
+            {"debmes:failed", {
+                    options.debug_parser ?
+                        R"(                stderr.writeln("recover rewinding failed");
+)" :
+                        ""}},
+            {"debmes:done", {
+                    options.debug_parser ?
+                        R"(        stderr.writefln("recover rewinding done: stack depth = %d", depth());
+)":
+                        ""}}
+            );
+    } else {
+        stencil(
+            os, R"(
+    void recover(TokenType, ValueType) {
+    }
+
+)"
+            );
     }
+
+    // reduction
+    //   one case for each rule the table reduces by
+    std::vector<bool> reduced(ir.rules.size());
+    for (const auto& state: ir.states) {
+        for (const auto& c: state.cases) {
+            if (c.action.kind == TableIR::Reduce) {
+                reduced[c.action.value] = true;
+            }
+        }
+        if (state.default_action.kind == TableIR::Reduce) {
+            reduced[state.default_action.value] = true;
+        }
+    }
+
+    stencil(
+        os, R"(
+    bool reduce(int rule) {
+        size_t base = cast(size_t)ruleLength[rule];
+        ValueType v;
+        switch (rule) {
+$${cases}
+        default:
+            break;
+        }
+        pop(base);
+        return push(gotof(stateTop(), ruleNonterminal[rule]), v);
+    }
+};
+
+)",
+        {"cases", [&](std::ostream& os) {
+                for (size_t r = 0 ; r < ir.rules.size() ; r++) {
+                    const auto& rule = ir.rules[r];
+                    if (!reduced[r] || !rule.action) { continue; }
+                    const auto& sa = *rule.action;
+                    const auto& rule_type = *finder(
+                        nonterminal_types, ir.nonterminals[rule.nonterminal]);
+                    stencil(
+                        os, R"(
+        case ${rule}: {
+$${args}
+            ${nonterminal_type} r = _sa.${semantic_action_name}(${arg_names});
+            _sa.upcast(v, r);
+            break;
+        }
+)",
+                        {"rule", int(r)},
+                        {"args", [&](std::ostream& os) {
+                                for (size_t l = 0 ; l < sa.args.size() ; l++) {
+                                    stencil(
+                                        os, R"(
+            ${arg_type} arg${index}; _sa.downcast(arg${index}, getArg(base, ${source_index}));
+)",
+                                        {"arg_type", make_type_name(sa.args[l].type)},
+                                        {"index", l},
+                                        {"source_index", sa.args[l].source_index}
+                                        );
+                                }
+                            }},
+                        {"nonterminal_type", make_type_name(rule_type)},
+                        {"semantic_action_name", sa.name},
+                        {"arg_names", [&](std::ostream& os) {
+                                for (size_t l = 0 ; l < sa.args.size() ; l++) {
+                                    if (l != 0) { os << ", "; }
+                                    os << "arg" << l;
+                                }
+                            }}
+                        );
+                }
+            }}
+        );
 }
 
 } // unnamed namespace
@@ -59,7 +422,27 @@ void generate_d(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
+
+    if (options.glr) {
+        throw unsupported_feature("D", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("D", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("D", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("D", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("D", "%split");
+    }
+    if (options.table && options.allow_ebnf) {
+        throw unsupported_feature("D", "%table with EBNF");
+    }
 
     std::string module_name =
         boost::filesystem::path(src_filename).stem().string();
@@ -121,6 +504,11 @@ $${labels}
 
     }
 
+    if (options.table) {
+        generate_d_table_parser(os, options, nonterminal_types, ir);
+        return;
+    }
+
     // stack
     stencil(
         os, R"(
@@ -545,44 +933,14 @@ $${debmes:repost_done}
 )"
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            const auto& rule_type =
-                *finder(nonterminal_types, rule.left().name());
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            const auto& rule_type = *finder(
                 nonterminal_types,
-                rule,
-                sa,
-                signature);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+                ir.nonterminals[ir.rules[stub.rule].nonterminal]);
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -656,7 +1014,7 @@ $${debmes:repost_done}
     }
 
     // states handler
-    for (const auto& state: table.states()) {
+    for (const auto& state: ir.states) {
         // state header
         stencil(
             os, R"(
@@ -676,172 +1034,112 @@ $${debmes:state}
                     }}}
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag =
-                "Token." + options.token_prefix + tokens[token];
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "default:"
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        for (const auto& c: cases) {
+            // fall through, be aware when port to other language
+            if (c.tokens.empty()) {
+                stencil(
+                    os, R"(
+        default:
+)"
+                    );
+            }
+            for (int token: c.tokens) {
+                stencil(
+                    os, R"(
+        case Token.${case}:
+)",
+                    {"case", options.token_prefix + tokens[token]}
+                    );
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             // shift
             self.pushStack(/*state*/ ${dest_index}, value);
             return false;
 )",
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
-                        stencil(
-                            os, R"(
-        case ${case_tag}:
-)",
-                            {"case_tag", case_tag}
-                            );
-                        std::string funcname = "call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = sa.name;
-                        }
-                        stencil(
-                            os, R"(
+                case TableIR::Reduce: {
+                    const auto& rule = ir.rules[action.value];
+                    std::string funcname = "call_nothing";
+                    if (0 <= rule.stub) {
+                        funcname = "call_" +
+                            std::to_string(ir.stubs[rule.stub].index) + "_" +
+                            rule.action->name;
+                    } else if (rule.action) {
+                        funcname = rule.action->name;
+                    }
+                    stencil(
+                        os, R"(
             // reduce
-            return self.${funcname}(Nonterminal.${nonterminal}, /*pop*/ ${base});
+            return self.${funcname}(Nonterminal.${nonterminal}, /*pop*/ ${base}${args});
 )",
-                            {"funcname", funcname},
-                            {"nonterminal", rule.left().name()},
-                            {"base", base}
-                            );
-                    }
+                        {"funcname", funcname},
+                        {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                        {"base", rule.length},
+                        {"args", [&](std::ostream& os) {
+                                if (rule.stub < 0) { return; }
+                                for(const auto& x: rule.action->source_indices) {
+                                    os  << ", " << x;
+                                }
+                            }}
+                        );
                 }
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             // accept
             self._accepted = true;
             self._accepted_value = *self.getArg(1, 0);
             return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
-                case zw::gr::action_error:
+                default:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             self._sa.syntax_error();
             self._error = true;
             return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            for (size_t j = 0 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                stencil(
-                    os, R"(
-        case ${case}:
-)",
-                    {"case", cases[j]}
-                    );
-            }
-
-            int index = stub_indices[signature];
-
+        // dispatcher footer / state footer
+        if (!default_reduce) {
             stencil(
                 os, R"(
-            // reduce
-            return self.call_${index}_${sa_name}(Nonterminal.${nonterminal}, /*pop*/ ${base}${args});
-)",
-                {"index", index},
-                {"sa_name", signature[0]},
-                {"nonterminal", nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
-                );
-        }
-
-        // dispatcher footer / state footer
-        stencil(
-            os, R"(
         default:
             self._sa.syntax_error();
             self._error = true;
             return false;
+)"
+                );
+        }
+        stencil(
+            os, R"(
         }
     }
-
 )"
             );
-
+        
         // gotof header
         stencil(
             os, R"(
@@ -858,12 +1156,12 @@ $${debmes:state}
 )"
             );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
         case Nonterminal.${nonterminal}: return ${state_index};
 )",
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
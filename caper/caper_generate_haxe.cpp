@@ -4,13 +4,12 @@
 // $Id$
 
 #include "caper_ast.hpp"
+#include "caper_error.hpp"
 #include "caper_generate_haxe.hpp"
 #include "caper_format.hpp"
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
 #include <algorithm>
-#include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 #include <boost/filesystem/path.hpp>
 
 namespace {
@@ -101,7 +100,27 @@ void generate_haxe(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
+
+    if (options.glr) {
+        throw unsupported_feature("Haxe", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("Haxe", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("Haxe", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("Haxe", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("Haxe", "%split");
+    }
+    if (options.table) {
+        throw unsupported_feature("Haxe", "%table");
+    }
 
     // notice / URL / module / imports
     stencil(
@@ -688,44 +707,14 @@ $${debmes:repost_done}
 )"
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            const auto& rule_type =
-                *finder(nonterminal_types, rule.left().name());
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            const auto& rule_type = *finder(
                 nonterminal_types,
-                rule,
-                sa,
-                signature);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+                ir.nonterminals[ir.rules[stub.rule].nonterminal]);
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -797,7 +786,7 @@ $${debmes:repost_done}
     }
 
     // states handler
-    for (const auto& state: table.states()) {
+    for (const auto& state: ir.states) {
         // state header
         stencil(
             os, R"(
@@ -820,172 +809,118 @@ $${debmes:state}
 			} }
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag = capitalize_token(tokens[token]);
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "default:"
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        for (const auto& c: cases) {
+            // haxe does not fall through, tokens are or-patterns
+            if (c.tokens.empty()) {
+                stencil(
+                    os, R"(
+        default:
+)"
+                    );
+            } else {
+                stencil(
+                    os, R"(
+        case ${cases}:
+)",
+                    {"cases", [&](std::ostream& os) {
+                            bool first = true;
+                            for (int token: c.tokens) {
+                                if (first) { first = false; }
+                                else { os << " | "; }
+                                os << capitalize_token(tokens[token]);
+                            }
+                        }}
+                    );
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             // shift
             self.pushStack(/*state*/ ${dest_index}, value);
             return false;
 )",
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
-                        stencil(
-                            os, R"(
-        case ${case_tag}:
-)",
-                            {"case_tag", case_tag}
-                            );
-                        std::string funcname = "call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = sa.name;
-                        }
-                        stencil(
-                            os, R"(
+                case TableIR::Reduce: {
+                    const auto& rule = ir.rules[action.value];
+                    std::string funcname = "call_nothing";
+                    if (0 <= rule.stub) {
+                        funcname = "call_" +
+                            std::to_string(ir.stubs[rule.stub].index) + "_" +
+                            rule.action->name;
+                    } else if (rule.action) {
+                        funcname = rule.action->name;
+                    }
+                    stencil(
+                        os, R"(
             // reduce
-            return self.${funcname}(${nonterminal}, /*pop*/ ${base});
+            return self.${funcname}(Nonterminal_${nonterminal}, /*pop*/ ${base}${args});
 )",
-                            {"funcname", funcname},
-                            {"nonterminal", "Nonterminal_"+rule.left().name()},
-                            {"base", base}
-                            );
-                    }
+                        {"funcname", funcname},
+                        {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                        {"base", rule.length},
+                        {"args", [&](std::ostream& os) {
+                                if (rule.stub < 0) { return; }
+                                for(const auto& x: rule.action->source_indices) {
+                                    os  << ", " << x;
+                                }
+                            }}
+                        );
                 }
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             // accept
             self.accepted = true;
             self.acceptedValue = self.getArg(1, 0);
             return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
-                case zw::gr::action_error:
+                default:
                     stencil(
                         os, R"(
-        case ${case_tag}:
             self.sa.syntaxError();
             self.failed = true;
             return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            os << "        case ";
-            for (size_t j = 0 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                os << cases[j];
-                if (j < cases.size() -1) {
-                    os << " | ";
-                } else {
-                    os << ":\n";
-                }
-            }
-
-            int index = stub_indices[signature];
-
+        // dispatcher footer / state footer
+        if (!default_reduce) {
             stencil(
                 os, R"(
-            // reduce
-            return self.call_${index}_${sa_name}(${nonterminal}, /*pop*/ ${base}${args});
-)",
-                {"index", index},
-                {"sa_name", signature[0]},
-                {"nonterminal", "Nonterminal_"+nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
-                );
-        }
-
-        // dispatcher footer / state footer
-        stencil(
-            os, R"(
         default:
             self.sa.syntaxError();
             self.failed = true;
             return false;
+)"
+                );
+        }
+        stencil(
+            os, R"(
         }
     }
-
 )"
             );
-
+        
         // gotof header
         stencil(
             os, R"(
@@ -1002,12 +937,12 @@ $${debmes:state}
 )"
             );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
         case Nonterminal_${nonterminal}: return ${state_index};
 )",
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
@@ -10,6 +10,7 @@
 #include "caper_ast.hpp"
 #include "caper_error.hpp"
 #include "caper_generate_java.hpp"
+#include "caper_format.hpp"
 #include <algorithm>
 #include <cassert>
 
@@ -43,6 +44,266 @@ namespace {
 		return s.c_str();
 	}
 
+	// %table: packed tables are written as string constants and unpacked
+	// once at class initialization; array initializers of large grammars
+	// would exceed the 64KB limit of the class initializer.
+	bool fits_short(const std::vector<int>& v)
+	{
+		for(int x: v) {
+			if(x < -32768 || 32767 < x) return false;
+		}
+		return true;
+	}
+
+	void write_java_char(std::ostream& os, unsigned int c)
+	{
+		// unicode escapes are translated before lexing,
+		// so line terminators, quote and backslash are octal
+		if(c == '\n' || c == '\r' || c == '"' || c == '\\') {
+			os << format("\\%03o", c);
+		} else {
+			os << format("\\u%04x", c);
+		}
+	}
+
+	void write_java_table(
+		std::ostream&			os,
+		const char*				name,
+		const std::vector<int>&	v)
+	{
+		bool s = fits_short(v);
+		os << "		private static final " << (s ? "short" : "int")
+		   << "[] " << name << " = "
+		   << (s ? "unpackShort(" : "unpackInt(") << v.size();
+
+		const size_t chunk = 4096;	// values per string constant
+		for(size_t i = 0; i < v.size(); ++i) {
+			if(i % chunk == 0) {
+				os << (i == 0 ? "" : "\"") << ",\n			\"";
+			}
+			unsigned int x = (unsigned int)v[i];
+			if(s) {
+				write_java_char(os, x & 0xffff);
+			} else {
+				write_java_char(os, x >> 16);
+				write_java_char(os, x & 0xffff);
+			}
+		}
+		os << (v.empty() ? "" : "\"") << ");\n";
+	}
+
+	void generate_java_table_parser(
+		std::ostream&						os,
+		const GenerateOptions&				options,
+		const TableIR&						ir)
+	{
+		os << options.access_modifier << "	public static class Parser {\n\n";
+
+		// tables
+		//   action code: shift dest << 2 | reduce rule << 2 | 1 |
+		//   accept 2 | error 3
+		std::vector<int> rule_length;
+		std::vector<int> rule_nonterminal;
+		for(const auto& rule: ir.rules) {
+			rule_length.push_back(rule.length);
+			rule_nonterminal.push_back(rule.nonterminal);
+		}
+		write_java_table(os, "TOKEN_CLASS", ir.token_class);
+		write_java_table(os, "ACTION_BASE", ir.action_base);
+		write_java_table(os, "ACTION_CHECK", ir.action_check);
+		write_java_table(os, "ACTION_NEXT", ir.action_next);
+		write_java_table(os, "ACTION_DEFAULT", ir.action_default);
+		write_java_table(os, "GOTO_BASE", ir.goto_base);
+		write_java_table(os, "GOTO_CHECK", ir.goto_check);
+		write_java_table(os, "GOTO_NEXT", ir.goto_next);
+		write_java_table(os, "RULE_LENGTH", rule_length);
+		write_java_table(os, "RULE_NONTERMINAL", rule_nonterminal);
+		os << "\n";
+
+		os << "		private static short[] unpackShort(int n, String... chunks) {\n"
+		   << "			short[] a = new short[n];\n"
+		   << "			int k = 0;\n"
+		   << "			for(String s: chunks) {\n"
+		   << "				for(int i = 0; i < s.length(); ++i) {\n"
+		   << "					a[k++] = (short)s.charAt(i);\n"
+		   << "				}\n"
+		   << "			}\n"
+		   << "			return a;\n"
+		   << "		}\n\n"
+
+		   << "		private static int[] unpackInt(int n, String... chunks) {\n"
+		   << "			int[] a = new int[n];\n"
+		   << "			int k = 0;\n"
+		   << "			for(String s: chunks) {\n"
+		   << "				for(int i = 0; i < s.length(); i += 2) {\n"
+		   << "					a[k++] = s.charAt(i) << 16 | s.charAt(i + 1);\n"
+		   << "				}\n"
+		   << "			}\n"
+		   << "			return a;\n"
+		   << "		}\n\n";
+
+		// stack
+		//   committed frames are [0, mark). while posting, frames popped
+		//   from them are [gap, mark) and pushed frames are [mark, top),
+		//   so a failed post leaves the committed stack as it was.
+		os << "		private int[] states = new int[64];\n"
+		   << "		private Object[] values = new Object[64];\n"
+		   << "		private int gap;\n"
+		   << "		private int mark;\n"
+		   << "		private int top;\n\n"
+
+		   << "		private void push(int state, Object value) {\n"
+		   << "			if(top == states.length) {\n"
+		   << "				states = Arrays.copyOf(states, top * 2);\n"
+		   << "				values = Arrays.copyOf(values, top * 2);\n"
+		   << "			}\n"
+		   << "			states[top] = state;\n"
+		   << "			values[top] = value;\n"
+		   << "			++top;\n"
+		   << "		}\n\n"
+
+		   << "		private void pop(int n) {\n"
+		   << "			int t = top - mark;\n"
+		   << "			if(t < n) {\n"
+		   << "				top = mark;\n"
+		   << "				gap -= n - t;\n"
+		   << "			} else {\n"
+		   << "				top -= n;\n"
+		   << "			}\n"
+		   << "		}\n\n"
+
+		   << "		private int stateTop() {\n"
+		   << "			return mark < top ? states[top - 1] : states[gap - 1];\n"
+		   << "		}\n\n"
+
+		   << "		private Object get(int base, int i) {\n"
+		   << "			int k = base - i;\n"
+		   << "			int t = top - mark;\n"
+		   << "			return k <= t ? values[top - k] : values[gap - (k - t)];\n"
+		   << "		}\n\n"
+
+		   << "		private void commit() {\n"
+		   << "			int n = top - mark;\n"
+		   << "			System.arraycopy(states, mark, states, gap, n);\n"
+		   << "			System.arraycopy(values, mark, values, gap, n);\n"
+		   << "			Arrays.fill(values, gap + n, top, null);\n"
+		   << "			mark = gap + n;\n"
+		   << "			gap = mark;\n"
+		   << "			top = mark;\n"
+		   << "		}\n\n";
+
+		// constructor
+		os << "		public Parser(SemanticAction sa) {\n"
+		   << "			this.sa = sa;\n"
+		   << "			reset();\n"
+		   << "		}\n\n";
+
+		// public member
+		os << "		public void reset() {\n"
+		   << "			error = false;\n"
+		   << "			accepted = false;\n"
+		   << "			acceptedValue = null;\n"
+		   << "			Arrays.fill(values, null);\n"
+		   << "			gap = mark = top = 0;\n"
+		   << "			push(" << ir.first_state << ", null);\n"
+		   << "			commit();\n"
+		   << "		}\n\n"
+
+		   << "		public boolean post(Token token, Object value) {\n"
+		   << "			assert(!error);\n"
+		   << "			int c = TOKEN_CLASS[token.ordinal()];\n"
+		   << "			for(;;) {\n"
+		   << "				int s = stateTop();\n"
+		   << "				int i = ACTION_BASE[s] + c;\n"
+		   << "				int code = ACTION_CHECK[i] == c ? ACTION_NEXT[i] : ACTION_DEFAULT[s];\n"
+		   << "				int kind = code & 3;\n"
+		   << "				if(kind == 1) {\n"
+		   << "					reduce(code >> 2);\n"
+		   << "				} else if(kind == 0) {\n"
+		   << "					push(code >> 2, value);\n"
+		   << "					break;\n"
+		   << "				} else if(kind == 2) {\n"
+		   << "					accepted = true;\n"
+		   << "					acceptedValue = get(1, 0);\n"	// implicit root
+		   << "					break;\n"
+		   << "				} else {\n"
+		   << "					sa.syntaxError();\n"
+		   << "					error = true;\n"
+		   << "					break;\n"
+		   << "				}\n"
+		   << "			}\n"
+		   << "			if(!error) {\n"
+		   << "				commit();\n"
+		   << "			} else {\n"
+		   << "				gap = top = mark;\n"
+		   << "			}\n"
+		   << "			return accepted || error;\n"
+		   << "		}\n\n"
+
+		   << "		/**\n"
+		   << "		 * The result of isError() is returned together\n"
+		   << "		 * in the C++ version and C# version.\n"
+		   << "		 * Please call isError() to check in the Java version.\n"
+		   << "		 */\n"
+		   << "		public Object accept() {\n"
+		   << "			assert(accepted || error);\n"
+		   << "			if(error)\n"
+		   << "				return null;\n"
+		   << "			return acceptedValue;\n"
+		   << "		}\n\n"
+
+		   << "		public boolean isError() {\n"
+		   << "			return error;\n"
+		   << "		}\n\n";
+
+		// private member
+		os << "		private final SemanticAction sa;\n"
+		   << "		private boolean accepted;\n"
+		   << "		private boolean error;\n"
+		   << "		private Object acceptedValue;\n\n";
+
+		// reduction
+		//   one case for each rule the table reduces by
+		std::vector<bool> reduced(ir.rules.size());
+		for(const auto& s: ir.states) {
+			for(const auto& c: s.cases) {
+				if(c.action.kind == TableIR::Reduce) reduced[c.action.value] = true;
+			}
+			if(s.default_action.kind == TableIR::Reduce) {
+				reduced[s.default_action.value] = true;
+			}
+		}
+
+		os << "		private void reduce(int rule) {\n"
+		   << "			int base = RULE_LENGTH[rule];\n"
+		   << "			Object v = null;\n"
+		   << "			switch(rule) {\n";
+		for(size_t r = 0; r < ir.rules.size(); ++r) {
+			const TableIR::Rule& rule = ir.rules[r];
+			if(!reduced[r] || !rule.action) continue;
+			const SemanticAction& sa = *rule.action;
+			os << "			case " << r << ":\n"
+			   << "				v = sa." << sa.name << "(";
+			for(size_t l=0; l<sa.args.size(); ++l) {
+				if(l != 0) os << ", ";
+				os << "(" << wrapper_name(sa.args[l].type.name) << ")get(base, "
+				   << sa.args[l].source_index << ")";
+			}
+			os << ");\n"
+			   << "				break;\n";
+		}
+		os << "			}\n"
+		   << "			pop(base);\n"
+		   << "			int s = stateTop();\n"
+		   << "			int nonterminal = RULE_NONTERMINAL[rule];\n"
+		   << "			int i = GOTO_BASE[s] + nonterminal;\n"
+		   << "			assert(GOTO_CHECK[i] == nonterminal);\n"
+		   << "			push(GOTO_NEXT[i], v);\n"
+		   << "		}\n\n";
+
+		os << "	}  // class Parser\n\n";
+	}
+
 }  // anonymous namespace
 
 void generate_java(
@@ -53,11 +314,27 @@ void generate_java(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
     if (options.allow_ebnf) {
         throw unsupported_feature("Java", "EBNF");
     }
+    if (options.glr) {
+        throw unsupported_feature("Java", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("Java", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("Java", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("Java", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("Java", "%split");
+    }
 
 	// once header
 	os << "// This file was automatically generated by Caper.\n"
@@ -154,6 +431,13 @@ void generate_java(
 
 	os << "	}\n\n";
 
+	// Parser class
+	if(options.table) {
+		generate_java_table_parser(os, options, ir);
+		os << "}  // wrapper class\n";
+		return;
+	}
+
 	// Parser class
 	os << options.access_modifier << "	public static class Parser {\n\n";
 
@@ -303,53 +587,25 @@ void generate_java(
 	   << "		}\n\n";
 
 	// states handler
-	for(tgt::parsing_table::states_type::const_iterator
-		i = table.states().begin();
-		i != table.states().end();
-		++i)
-	{
-		const tgt::parsing_table::state& s = *i;
-
+	for(const auto& s: ir.states) {
 		os << "		private final State state" << s.no << " = new State() {\n";
 
 		// gotof header
 		os << "			public boolean gotof(int nonterminalIndex, Object v) {\n";
 
 		// gotof dispatcher
-		std::stringstream ss;
-		ss << "				switch(nonterminalIndex) {\n";
-
-		bool output_switch = false;
-		std::set<size_t> generated;
-		for(const auto& rule: table.get_grammar()) {
-			size_t nonterminal_index = std::distance(
-					nonterminal_types.begin(),
-					nonterminal_types.find(rule.left().name()));
-
-			if(generated.find(nonterminal_index) != generated.end()) {
-				continue;
-			}
-
-			tgt::parsing_table::state::goto_table_type::const_iterator k =
-				(*i).goto_table.find(rule.left());
-
-			if(k != (*i).goto_table.end()) {
-				ss << "				case " << nonterminal_index << ": "
+		if(!s.gotos.empty()) {
+			os << "				switch(nonterminalIndex) {\n";
+			for(const auto& x: s.gotos) {
+				os << "				case " << x.first << ": "
 				   << "return pushToStack("
-				   << "state" << (*k).second << ", "
+				   << "state" << x.second << ", "
 				   << "v);\n";
-				output_switch = true;
-				generated.insert(nonterminal_index);
 			}
-		}
-
-		ss << "				default:\n"
-		   << "					assert(false);\n"
-		   << "					return false;\n"
-		   << "				}\n";
-
-		if(output_switch) {
-			os << ss.str();
+			os << "				default:\n"
+			   << "					assert(false);\n"
+			   << "					return false;\n"
+			   << "				}\n";
 		} else {
 			os << "				assert(false);\n"
 			   << "				return false;\n";
@@ -364,46 +620,48 @@ void generate_java(
 		// dispatcher header
 		os << "				switch(token) {\n";
 
-		// action table
-		for(tgt::parsing_table::state::action_table_type::const_iterator
-			j = s.action_table.begin();
-			j != s.action_table.end();
-			++j)
-		{
+		// cases (the default reduction, if any, is the last one)
+		std::vector<TableIR::Case> cases = s.cases;
+		bool default_reduce = s.default_action.kind == TableIR::Reduce;
+		if(default_reduce) {
+			cases.push_back(TableIR::Case());
+			cases.back().action = s.default_action;
+		}
+
+		for(const auto& c: cases) {
 			// action header
-			os << "				case " << options.token_prefix
-			   << tokens[(*j).first] << ":\n";
+			if(c.tokens.empty()) {
+				os << "				default:\n";
+			}
+			for(int token: c.tokens) {
+				os << "				case " << options.token_prefix
+				   << tokens[token] << ":\n";
+			}
 
 			// action
-			const tgt::parsing_table::action* a = &(*j).second;
-			switch(a->type) {
-			case zw::gr::action_shift:
+			const TableIR::Action& a = c.action;
+			switch(a.kind) {
+			case TableIR::Shift:
 				os << "					// shift\n"
 				   << "					pushToStack("
-				   << "state" << a->dest_index << ", "
+				   << "state" << a.value << ", "
 				   << "value);\n"
 				   << "					return false;\n";
 				break;
-			case zw::gr::action_reduce:
+			case TableIR::Reduce:
 				{
-                                    size_t base = a->rule.right().size();
-
-                                    const tgt::parsing_table::rule_type& rule = a->rule;
-					action_map_type::const_iterator k = actions.find(rule);
-
-					size_t nonterminal_index = std::distance(
-							nonterminal_types.begin(),
-							nonterminal_types.find(rule.left().name()));
+					const TableIR::Rule& rule = ir.rules[a.value];
+					int base = rule.length;
 
-					if(k != actions.end()) {
-						const SemanticAction& sa = (*k).second;
+					if(rule.action) {
+						const SemanticAction& sa = *rule.action;
 
 						os << "				{\n"
 						   << "					// reduce\n";
 
 						// automatic argument conversion
 						for(size_t l=0; l<sa.args.size(); ++l) {
-                                                    const SemanticAction::Argument& arg =
+							const SemanticAction::Argument& arg =
 								sa.args[l];
 							os << "					" << arg.type.name << " arg" << l
 							   << " = (" << wrapper_name(arg.type.name) << ")getFromStack(" << base
@@ -412,7 +670,7 @@ void generate_java(
 
 						// semantic action
 						const std::string& rtype =
-							(*nonterminal_types.find(rule.left().name())).second.name;
+							(*nonterminal_types.find(ir.nonterminals[rule.nonterminal])).second.name;
 						os << "					"
 						   << rtype
 						   << " r = sa." << sa.name << "(";
@@ -425,25 +683,23 @@ void generate_java(
 						// automatic return value conversion
 						os << "					stack.pop(" << base << ");\n"
 						   << "					return stack.peek().state.gotof("
-						   << nonterminal_index << ", r);\n"
+						   << rule.nonterminal << ", r);\n"
 						   << "				}\n";
 					} else {
 						os << "					// reduce\n"
-						// << "					// run_semantic_action();\n"
 						   << "					stack.pop(" << base << ");\n"
 						   << "					return stack.peek().state.gotof("
-						   << nonterminal_index << ", null);\n";
+						   << rule.nonterminal << ", null);\n";
 					}
 				}
 				break;
-			case zw::gr::action_accept:
+			case TableIR::Accept:
 				os << "					// accept\n"
-				// << "					// run_semantic_action();\n"
 				   << "					accepted = true;\n"
 				   << "					acceptedValue = getFromStack(1, 0);\n"  // implicit root
 				   << "					return false;\n";
 				break;
-			case zw::gr::action_error:
+			default:
 				os << "					sa.syntaxError();\n"
 				   << "					error = true;\n"
 				   << "					return false;\n";
@@ -453,11 +709,13 @@ void generate_java(
 		}
 
 		// dispatcher footer
-		os << "				default:\n"
-		   << "					sa.syntaxError();\n"
-		   << "					error = true;\n"
-		   << "					return false;\n"
-		   << "				}\n";
+		if(!default_reduce) {
+			os << "				default:\n"
+			   << "					sa.syntaxError();\n"
+			   << "					error = true;\n"
+			   << "					return false;\n";
+		}
+		os << "				}\n";
 
 		// state footer
 		os << "			}\n";
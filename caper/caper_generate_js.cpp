@@ -4,52 +4,316 @@
 // $Id$
 
 #include "caper_ast.hpp"
+#include "caper_error.hpp"
 #include "caper_generate_cpp.hpp"
 #include "caper_format.hpp"
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
 #include <algorithm>
-#include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 
 namespace {
 
-std::string make_type_name(const Type& x) {
-    switch(x.extension) {
-        case Extension::None:
-            return x.name;
-        case Extension::Star:
-        case Extension::Plus:
-        case Extension::Slash:
-            return "Sequence<" + x.name + ">";
-        case Extension::Question:
-            return "Optional<" + x.name + ">";
-        default:
-            assert(0);
-            return "";
+// %table: typed array literal, Int16Array if every value fits
+void write_typed_array(
+    std::ostream&           os,
+    const char*             name,
+    const std::vector<int>& v) {
+    bool fits = true;
+    for (int x: v) {
+        if (x < -32768 || 32767 < x) { fits = false; break; }
     }
+    stencil(
+        os, R"(
+    var ${name} = new ${type}([${values}
+    ]);
+)",
+        {"name", name},
+        {"type", fits ? "Int16Array" : "Int32Array"},
+        {"values", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < v.size() ; i++) {
+                    if (i % 16 == 0) { os << "\n        "; }
+                    os << v[i] << ",";
+                }
+            }}
+        );
 }
-        
-void make_signature(
-    const std::map<std::string, Type>&      nonterminal_types,
-    const tgt::parsing_table::rule_type&    rule,
-    const SemanticAction&                   sa,
-    std::vector<std::string>&               signature) {
-    // function name
-    signature.push_back(sa.name);
-
-    // return value
-    signature.push_back(
-        make_type_name(*finder(nonterminal_types, rule.left().name())));
-
-    // arguments
-    for (const auto& arg: sa.args) {
-        signature.push_back(make_type_name(arg.type));
+
+void generate_javascript_table_parser(
+    std::ostream&                       os,
+    const GenerateOptions&              options,
+    const TableIR&                      ir) {
+    // tables
+    //   action code: shift dest << 2 | reduce rule << 2 | 1 |
+    //   accept 2 | error 3
+    std::vector<int> rule_length;
+    std::vector<int> rule_nonterminal;
+    for (const auto& rule: ir.rules) {
+        rule_length.push_back(rule.length);
+        rule_nonterminal.push_back(rule.nonterminal);
     }
-}
+    std::vector<int> handle_error;
+    for (const auto& state: ir.states) {
+        handle_error.push_back(state.handle_error ? 1 : 0);
+    }
+    os << "\n";
+    write_typed_array(os, "tokenClass", ir.token_class);
+    write_typed_array(os, "actionBase", ir.action_base);
+    write_typed_array(os, "actionCheck", ir.action_check);
+    write_typed_array(os, "actionNext", ir.action_next);
+    write_typed_array(os, "actionDefault", ir.action_default);
+    write_typed_array(os, "gotoBase", ir.goto_base);
+    write_typed_array(os, "gotoCheck", ir.goto_check);
+    write_typed_array(os, "gotoNext", ir.goto_next);
+    write_typed_array(os, "ruleLength", rule_length);
+    write_typed_array(os, "ruleNonterminal", rule_nonterminal);
+    write_typed_array(os, "handleError", handle_error);
+
+    // parser
+    //   committed frames are [0, mark). while posting, frames popped from
+    //   them are [gap, mark) and pushed frames are [mark, top), so a
+    //   failed post leaves the committed stack as it was.
+    stencil(
+        os, R"(
 
+    function Parser(sa) {
+        this.sa = sa;
+        this.states = new Int32Array(64);
+        this.values = new Array(64);
+        this.gap = 0;
+        this.mark = 0;
+        this.top = 0;
+        this.reset();
+    }
+    exports.Parser = Parser;
+
+    Parser.prototype = {
+        reset : function() {
+            this.accepted = false;
+            this.error = false;
+            this.acceptedValue = null;
+            this.values.fill(null);
+            this.gap = this.mark = this.top = 0;
+            this.push(${first_state}, null);
+            this.commit();
+        },
+        post : function(token, value) {
+            this.gap = this.top = this.mark;
+            this.error = false;
+            this.run(token, value);
+            if (!this.error) {
+                this.commit();
+            } else {
+                this.recover(token, value);
+            }
+            return this.accepted || this.error;
+        },
+        accept : function() {
+            if (this.error) { return null; }
+            return this.acceptedValue;
+        },
+        gotError : function() {
+            return this.error;
+        },
+
+        run : function(token, value) {
+            for (;;) {
+                var s = this.stateTop();
+$${debmes:state}
+                var c = tokenClass[token];
+                var i = actionBase[s] + c;
+                var code = actionCheck[i] === c ? actionNext[i] : actionDefault[s];
+                var kind = code & 3;
+                if (kind === 1) {
+                    this.reduce(code >> 2);
+                } else if (kind === 0) {
+                    this.push(code >> 2, value);
+                    return;
+                } else if (kind === 2) {
+                    this.accepted = true;
+                    this.acceptedValue = this.getArg(1, 0);
+                    return;
+                } else {
+                    this.sa.syntaxError();
+                    this.error = true;
+                    return;
+                }
+            }
+        },
+
+        push : function(state, value) {
+            var top = this.top;
+            if (top === this.states.length) {
+                var states = new Int32Array(top * 2);
+                states.set(this.states);
+                this.states = states;
+                this.values.length = top * 2;
+            }
+            this.states[top] = state;
+            this.values[top] = value;
+            this.top = top + 1;
+        },
+        pop : function(n) {
+            var t = this.top - this.mark;
+            if (t < n) {
+                this.top = this.mark;
+                this.gap -= n - t;
+            } else {
+                this.top -= n;
+            }
+        },
+        stateTop : function() {
+            return this.mark < this.top ?
+                this.states[this.top - 1] : this.states[this.gap - 1];
+        },
+        getArg : function(base, index) {
+            var k = base - index;
+            var t = this.top - this.mark;
+            return k <= t ?
+                this.values[this.top - k] : this.values[this.gap - (k - t)];
+        },
+        depth : function() {
+            return this.gap + this.top - this.mark;
+        },
+        commit : function() {
+            var n = this.top - this.mark;
+            this.states.copyWithin(this.gap, this.mark, this.top);
+            for (var i = 0 ; i < n ; i++) {
+                this.values[this.gap + i] = this.values[this.mark + i];
+            }
+            for (var j = this.gap + n ; j < this.top ; j++) {
+                this.values[j] = null;
+            }
+            this.mark = this.gap = this.top = this.gap + n;
+        },
+
+)",
+        {"first_state", ir.first_state},
+        {"debmes:state", [&](std::ostream& os){
+                if (options.debug_parser) {
+                    stencil(
+                        os, R"(
+                console.log("state_" + s + " << " + getTokenLabel(token));
+)"
+                        );
+                }}}
+        );
+
+    if (options.recovery) {
+        stencil(
+            os, R"(
+        recover : function(token, value) {
+            this.gap = this.top = this.mark;
+            this.error = false;
+$${debmes:start}
+            while(!handleError[this.stateTop()]) {
+                this.pop(1);
+                if (this.depth() === 0) {
+$${debmes:failed}
+                    this.error = true;
+                    return;
+                }
+            }
+$${debmes:done}
+            // post error_token;
+            this.run(Token.${recovery_token}, null);
+            this.commit();
+            // repost original token
+            // if it still causes error, discard it;
+            this.run(token, value);
+            if (!this.error) {
+                this.commit();
+            }
+            if (token != Token.${token_eof}) {
+                this.error = false;
+            }
+        },
+
+)",
+            {"recovery_token", options.token_prefix + options.recovery_token},
+            {"token_eof", options.token_prefix + "eof"},
+            {"debmes:start", {
+                    options.debug_parser ?
+                        R"(            console.log("recover rewinding start: stack depth = " + this.depth());
+)" :
+                        ""}},
+            {"debmes:failed", {
+                    options.debug_parser ?
+                        R"(                    console.log("recover rewinding failed");
+)" :
+                        ""}},
+            {"debmes:done", {
+                    options.debug_parser ?
+                        R"(            console.log("recover rewinding done: stack depth = " + this.depth());
+)" :
+                        ""}}
+            );
+    } else {
+        stencil(
+            os, R"(
+        recover : function(token, value) {
+        },
+
+)"
+            );
+    }
+
+    // reduction
+    //   one case for each rule the table reduces by
+    std::vector<bool> reduced(ir.rules.size());
+    for (const auto& state: ir.states) {
+        for (const auto& c: state.cases) {
+            if (c.action.kind == TableIR::Reduce) {
+                reduced[c.action.value] = true;
+            }
+        }
+        if (state.default_action.kind == TableIR::Reduce) {
+            reduced[state.default_action.value] = true;
+        }
+    }
+
+    stencil(
+        os, R"(
+        reduce : function(rule) {
+            var base = ruleLength[rule];
+            var v = null;
+            switch (rule) {
+$${cases}
+            }
+            this.pop(base);
+            var s = this.stateTop();
+            this.push(gotoNext[gotoBase[s] + ruleNonterminal[rule]], v);
+        }
+    };
+
+)",
+        {"cases", [&](std::ostream& os) {
+                for (size_t r = 0 ; r < ir.rules.size() ; r++) {
+                    const auto& rule = ir.rules[r];
+                    if (!reduced[r] || !rule.action) { continue; }
+                    const auto& sa = *rule.action;
+                    stencil(
+                        os, R"(
+            case ${rule}:
+                v = this.sa.${sa_name}(${args});
+                break;
+)",
+                        {"rule", int(r)},
+                        {"sa_name", sa.name},
+                        {"args", [&](std::ostream& os) {
+                                for (size_t l = 0 ; l < sa.args.size() ; l++) {
+                                    if (l != 0) { os << ", "; }
+                                    os << "this.getArg(base, "
+                                       << sa.args[l].source_index << ")";
+                                }
+                            }}
+                        );
+                }
+            }}
+        );
 }
 
+} // unnamed namespace
+
 void generate_javascript(
     const std::string&                  src_filename,
     std::ostream&                       os,
@@ -58,7 +322,27 @@ void generate_javascript(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
+
+    if (options.glr) {
+        throw unsupported_feature("JavaScript", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("JavaScript", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("JavaScript", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("JavaScript", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("JavaScript", "%split");
+    }
+    if (options.table && options.allow_ebnf) {
+        throw unsupported_feature("JavaScript", "%table with EBNF");
+    }
 
     // notice / URL
     stencil(
@@ -149,6 +433,17 @@ $${labels}
     };
 )"
         );
+
+    if (options.table) {
+        generate_javascript_table_parser(os, options, ir);
+        stencil(os, R"(
+    return exports;
+})();
+
+)"
+            );
+        return;
+    }
     
     stencil(
         os, R"(
@@ -173,6 +468,7 @@ $${labels}
             this.stack.splice(this.gap, this.stack.length - this.gap);
             this.stack = this.stack.concat(this.tmp);
             this.tmp = [];
+            this.gap = this.stack.length;
         },
         push : function(x) {
             this.tmp.push(x);
@@ -528,41 +824,11 @@ $${debmes:repost_done}
 )"
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
-                nonterminal_types,
-                rule,
-                sa,
-                signature);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -632,7 +898,7 @@ $${debmes:repost_done}
     }
 
     // states handler
-    for (const auto& state: table.states()) {
+    for (const auto& state: ir.states) {
         // state header
         stencil(
             os, R"(
@@ -652,166 +918,107 @@ $${debmes:state}
                     }}}
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag =
-                "Token." + options.token_prefix + tokens[token];
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "default:"
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        for (const auto& c: cases) {
+            // fall through, be aware when port to other language
+            if (c.tokens.empty()) {
+                stencil(
+                    os, R"(
+            default:
+)"
+                    );
+            }
+            for (int token: c.tokens) {
+                stencil(
+                    os, R"(
+            case Token.${token}:
+)",
+                    {"token", options.token_prefix + tokens[token]}
+                    );
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
                         os, R"(
-            case ${case_tag}:
                 // shift
                 this.pushStack(/*state*/ ${dest_index}, value, 0);
                 return false;
 )",
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
-                        stencil(
-                            os, R"(
-            case ${case_tag}:
-)",
-                            {"case_tag", case_tag}
-                            );
-                        std::string funcname = "this.call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = "this." + sa.name;
-                        }
-                        stencil(
-                            os, R"(
+                case TableIR::Reduce: {
+                    const auto& rule = ir.rules[action.value];
+                    std::string funcname = "this.call_nothing";
+                    if (0 <= rule.stub) {
+                        funcname = "this.call_" +
+                            std::to_string(ir.stubs[rule.stub].index) + "_" +
+                            rule.action->name;
+                    } else if (rule.action) {
+                        funcname = "this." + rule.action->name;
+                    }
+                    stencil(
+                        os, R"(
                 // reduce
-                return ${funcname}(Nonterminal.${nonterminal}, /*pop*/ ${base});
+                return ${funcname}(Nonterminal.${nonterminal}, /*pop*/ ${base}${args});
 )",
-                            {"funcname", funcname},
-                            {"nonterminal", rule.left().name()},
-                            {"base", base}
-                            );
-                    }
+                        {"funcname", funcname},
+                        {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                        {"base", rule.length},
+                        {"args", [&](std::ostream& os) {
+                                if (rule.stub < 0) { return; }
+                                for(const auto& x: rule.action->source_indices) {
+                                    os  << ", " << x;
+                                }
+                            }}
+                        );
                 }
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
                         os, R"(
-            case ${case_tag}:
                 // accept
                 this.accepted = true;
                 this.acceptedValue = this.getArg(1, 0);
                 return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
-                case zw::gr::action_error:
+                default:
                     stencil(
                         os, R"(
-            case ${case_tag}:
                 this.sa.syntaxError();
                 this.error = true;
                 return false;
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            for (size_t j = 0 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                stencil(
-                    os, R"(
-            case ${case}:
-)",
-                    {"case", cases[j]}
-                    );
-            }
-
-            int index = stub_indices[signature];
-
+        // dispatcher footer / state footer
+        if (!default_reduce) {
             stencil(
                 os, R"(
-                // reduce
-                return this.call_${index}_${sa_name}(Nonterminal.${nonterminal}, /*pop*/ ${base}${args});
-)",
-                {"index", index},
-                {"sa_name", signature[0]},
-                {"nonterminal", nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
-                );
-        }
-
-        // dispatcher footer / state footer
-        stencil(
-            os, R"(
             default:
                 this.sa.syntaxError();
                 this.error = true;
                 return false;
+)"
+                );
+        }
+        stencil(
+            os, R"(
             }
         },
 
@@ -834,12 +1041,12 @@ $${debmes:state}
 )"
             );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
             case Nonterminal.${nonterminal}: return ${state_index};
 )",
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
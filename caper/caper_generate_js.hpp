@@ -1,7 +1,7 @@
 #ifndef CAPER_GENERATE_JS_HPP
 #define CAPER_GENERATE_JS_HPP
 
-#include "caper_ast.hpp"
+#include "caper_ir.hpp"
 
 void generate_javascript(
     const std::string&                  src_filename,
@@ -11,6 +11,7 @@ void generate_javascript(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table);
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir);
 
 #endif // CAPER_GENERATE_JS_HPP
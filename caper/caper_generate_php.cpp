@@ -10,47 +10,345 @@
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
 #include <algorithm>
-#include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 
 namespace {
 
-std::string make_type_name(const Type& x) {
-    switch(x.extension) {
-        case Extension::None:
-            return x.name;
-        case Extension::Star:
-        case Extension::Plus:
-        case Extension::Slash:
-            return "Sequence<" + x.name + ">";
-        case Extension::Question:
-            return "Optional<" + x.name + ">";
-        default:
-            assert(0);
-            return "";
-    }
+// %table: class constant integer array
+void write_php_table(
+    std::ostream&           os,
+    const char*             name,
+    const std::vector<int>& v) {
+    stencil(
+        os, R"(
+    const ${name} = array(${values}
+    );
+)",
+        {"name", name},
+        {"values", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < v.size() ; i++) {
+                    if (i % 16 == 0) { os << "\n        "; }
+                    os << v[i] << ",";
+                }
+            }}
+        );
 }
-        
-void make_signature(
-    const std::map<std::string, Type>&      nonterminal_types,
-    const tgt::parsing_table::rule_type&    rule,
-    const SemanticAction&                   sa,
-    std::vector<std::string>&               signature) {
-    // function name
-    signature.push_back(sa.name);
-
-    // return value
-    signature.push_back(
-        make_type_name(*finder(nonterminal_types, rule.left().name())));
-
-    // arguments
-    for (const auto& arg: sa.args) {
-        signature.push_back(make_type_name(arg.type));
+
+void generate_php_table_parser(
+    std::ostream&                       os,
+    const GenerateOptions&              options,
+    const TableIR&                      ir) {
+    std::string namespace_name(options.namespace_name);
+
+    stencil(
+        os, R"(
+
+class Parser
+{
+)"
+        );
+
+    // tables
+    //   action code: shift dest << 2 | reduce rule << 2 | 1 |
+    //   accept 2 | error 3
+    std::vector<int> rule_length;
+    std::vector<int> rule_nonterminal;
+    for (const auto& rule: ir.rules) {
+        rule_length.push_back(rule.length);
+        rule_nonterminal.push_back(rule.nonterminal);
+    }
+    std::vector<int> handle_error;
+    for (const auto& state: ir.states) {
+        handle_error.push_back(state.handle_error ? 1 : 0);
+    }
+    write_php_table(os, "TOKEN_CLASS", ir.token_class);
+    write_php_table(os, "ACTION_BASE", ir.action_base);
+    write_php_table(os, "ACTION_CHECK", ir.action_check);
+    write_php_table(os, "ACTION_NEXT", ir.action_next);
+    write_php_table(os, "ACTION_DEFAULT", ir.action_default);
+    write_php_table(os, "GOTO_BASE", ir.goto_base);
+    write_php_table(os, "GOTO_CHECK", ir.goto_check);
+    write_php_table(os, "GOTO_NEXT", ir.goto_next);
+    write_php_table(os, "RULE_LENGTH", rule_length);
+    write_php_table(os, "RULE_NONTERMINAL", rule_nonterminal);
+    write_php_table(os, "HANDLE_ERROR", handle_error);
+
+    // semantic actions indexed by rule
+    //   one closure for each rule the table reduces by
+    std::vector<bool> reduced(ir.rules.size());
+    for (const auto& state: ir.states) {
+        for (const auto& c: state.cases) {
+            if (c.action.kind == TableIR::Reduce) {
+                reduced[c.action.value] = true;
+            }
+        }
+        if (state.default_action.kind == TableIR::Reduce) {
+            reduced[state.default_action.value] = true;
+        }
+    }
+
+    // parser
+    //   committed frames are [0, mark). while posting, frames popped from
+    //   them are [gap, mark) and pushed frames are [mark, top), so a
+    //   failed post leaves the committed stack as it was.
+    stencil(
+        os, R"(
+
+    public ${d}sa;
+    public ${d}accepted;
+    public ${d}error;
+    public ${d}accepted_value;
+    private ${d}states;
+    private ${d}values;
+    private ${d}gap;
+    private ${d}mark;
+    private ${d}top;
+    private ${d}reductions;
+
+    function __construct(${d}sa)
+    {
+        ${d}this->sa = ${d}sa;
+        ${d}this->reductions = array(
+$${reductions}
+        );
+        ${d}this->do_reset();
+    }
+
+    function do_reset()
+    {
+        ${d}this->error = FALSE;
+        ${d}this->accepted = FALSE;
+        ${d}this->accepted_value = NULL;
+        ${d}this->states = array();
+        ${d}this->values = array();
+        ${d}this->gap = ${d}this->mark = ${d}this->top = 0;
+        ${d}this->push(${first_state}, NULL);
+        ${d}this->commit();
+    }
+
+    function post(${d}token, ${d}value)
+    {
+        ${d}this->gap = ${d}this->top = ${d}this->mark;
+        ${d}this->error = FALSE;
+        ${d}this->run(${d}token, ${d}value);
+        if (!${d}this->error) {
+            ${d}this->commit();
+        } else {
+            ${d}this->recover(${d}token, ${d}value);
+        }
+        return ${d}this->accepted || ${d}this->error;
+    }
+
+    function accept(&${d}v)
+    {
+        if (${d}this->error) {
+            return FALSE;
+        }
+        ${d}v = ${d}this->accepted_value;
+        return TRUE;
+    }
+
+    private function run(${d}token, ${d}value)
+    {
+        for (;;) {
+            ${d}s = ${d}this->state_top();
+$${debmes:state}
+            ${d}c = self::TOKEN_CLASS[${d}token];
+            ${d}i = self::ACTION_BASE[${d}s] + ${d}c;
+            ${d}code = self::ACTION_CHECK[${d}i] == ${d}c ? self::ACTION_NEXT[${d}i] : self::ACTION_DEFAULT[${d}s];
+            ${d}kind = ${d}code & 3;
+            if (${d}kind == 1) {
+                ${d}this->reduce(${d}code >> 2);
+            } elseif (${d}kind == 0) {
+                ${d}this->push(${d}code >> 2, ${d}value);
+                return;
+            } elseif (${d}kind == 2) {
+                ${d}this->accepted = TRUE;
+                ${d}this->accepted_value = ${d}this->get_arg(1, 0);
+                return;
+            } else {
+                ${d}this->sa->syntax_error();
+                ${d}this->error = TRUE;
+                return;
+            }
+        }
+    }
+
+    private function reduce(${d}rule)
+    {
+        ${d}base = self::RULE_LENGTH[${d}rule];
+        ${d}v = NULL;
+        if (isset(${d}this->reductions[${d}rule])) {
+            ${d}f = ${d}this->reductions[${d}rule];
+            ${d}v = ${d}f(${d}base);
+        }
+        ${d}this->pop(${d}base);
+        ${d}s = ${d}this->state_top();
+        ${d}this->push(self::GOTO_NEXT[self::GOTO_BASE[${d}s] + self::RULE_NONTERMINAL[${d}rule]], ${d}v);
+    }
+
+    private function push(${d}state, ${d}value)
+    {
+        ${d}this->states[${d}this->top] = ${d}state;
+        ${d}this->values[${d}this->top] = ${d}value;
+        ${d}this->top++;
+    }
+
+    private function pop(${d}n)
+    {
+        ${d}t = ${d}this->top - ${d}this->mark;
+        if (${d}t < ${d}n) {
+            ${d}this->top = ${d}this->mark;
+            ${d}this->gap -= ${d}n - ${d}t;
+        } else {
+            ${d}this->top -= ${d}n;
+        }
+    }
+
+    private function state_top()
+    {
+        return ${d}this->mark < ${d}this->top ?
+            ${d}this->states[${d}this->top - 1] : ${d}this->states[${d}this->gap - 1];
+    }
+
+    private function get_arg(${d}base, ${d}index)
+    {
+        ${d}k = ${d}base - ${d}index;
+        ${d}t = ${d}this->top - ${d}this->mark;
+        return ${d}k <= ${d}t ?
+            ${d}this->values[${d}this->top - ${d}k] : ${d}this->values[${d}this->gap - (${d}k - ${d}t)];
+    }
+
+    private function depth()
+    {
+        return ${d}this->gap + ${d}this->top - ${d}this->mark;
+    }
+
+    private function commit()
+    {
+        ${d}n = ${d}this->top - ${d}this->mark;
+        if (${d}this->gap != ${d}this->mark) {
+            for (${d}i = 0; ${d}i < ${d}n; ${d}i++) {
+                ${d}this->states[${d}this->gap + ${d}i] = ${d}this->states[${d}this->mark + ${d}i];
+                ${d}this->values[${d}this->gap + ${d}i] = ${d}this->values[${d}this->mark + ${d}i];
+            }
+            for (${d}i = ${d}this->gap + ${d}n; ${d}i < ${d}this->top; ${d}i++) {
+                ${d}this->values[${d}i] = NULL;
+            }
+        }
+        ${d}this->mark = ${d}this->gap = ${d}this->top = ${d}this->gap + ${d}n;
+    }
+)",
+        {"d", "$"},
+        {"first_state", ir.first_state},
+        {"reductions", [&](std::ostream& os) {
+                for (size_t r = 0 ; r < ir.rules.size() ; r++) {
+                    const auto& rule = ir.rules[r];
+                    if (!reduced[r] || !rule.action) { continue; }
+                    const auto& sa = *rule.action;
+                    stencil(
+                        os, R"(
+            ${rule} => function(${d}base) {
+                return ${d}this->sa->upcast(${d}this->sa->${semantic_action_name}(${args}));
+            },
+)",
+                        {"d", "$"},
+                        {"rule", int(r)},
+                        {"semantic_action_name", sa.name},
+                        {"args", [&](std::ostream& os) {
+                                for (size_t l = 0 ; l < sa.args.size() ; l++) {
+                                    if (l != 0) { os << ", "; }
+                                    os << "$this->sa->downcast($this->get_arg($base, "
+                                       << sa.args[l].source_index << "))";
+                                }
+                            }}
+                        );
+                }
+            }},
+        {"debmes:state", [&](std::ostream& os){
+                if (options.debug_parser) {
+                    stencil(
+                        os, R"(
+            trigger_error(sprintf("state_%d << %s", ${d}s, token_label(${d}token)));
+)",
+                        {"d", "$"}
+                        );
+                }}}
+        );
+
+    if (options.recovery) {
+        stencil(
+            os, R"(
+
+    private function recover(${d}token, ${d}value)
+    {
+        ${d}this->gap = ${d}this->top = ${d}this->mark;
+        ${d}this->error = FALSE;
+$${debmes:start}
+        while (!self::HANDLE_ERROR[${d}this->state_top()]) {
+            ${d}this->pop(1);
+            if (${d}this->depth() == 0) {
+$${debmes:failed}
+                ${d}this->error = TRUE;
+                return;
+            }
+        }
+$${debmes:done}
+        // post error_token;
+        ${d}this->run(\${namespace_name}\Token::${recovery_token}, NULL);
+        ${d}this->commit();
+        // repost original token
+        // if it still causes error, discard it;
+        ${d}this->run(${d}token, ${d}value);
+        if (!${d}this->error) {
+            ${d}this->commit();
+        }
+        if (${d}token != \${namespace_name}\Token::${token_eof}) {
+            ${d}this->error = FALSE;
+        }
+    }
+)",
+            {"d", "$"},
+            {"namespace_name", namespace_name},
+            {"recovery_token", options.token_prefix + options.recovery_token},
+            {"token_eof", options.token_prefix + "eof"},
+            {"debmes:start", {
+                    options.debug_parser ?
+                        R"(        trigger_error(sprintf("recover rewinding start: stack depth = %d", $this->depth()));
+)" :
+                        ""}},
+            {"debmes:failed", {
+                    options.debug_parser ?
+                        R"(                trigger_error("recover rewinding failed");
+)" :
+                        ""}},
+            {"debmes:done", {
+                    options.debug_parser ?
+                        R"(        trigger_error(sprintf("recover rewinding done: stack depth = %d", $this->depth()));
+)" :
+                        ""}}
+            );
+    } else {
+        stencil(
+            os, R"(
+
+    private function recover(${d}token, ${d}value)
+    {
+        ;
+    }
+)",
+            {"d", "$"}
+            );
     }
-}
 
+    stencil(
+        os, R"(
+}
+)"
+        );
 }
 
+} // unnamed namespace
+
 void generate_php(
     const std::string&                  src_filename,
     std::ostream&                       os,
@@ -59,11 +357,27 @@ void generate_php(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
     if (options.allow_ebnf) {
         throw unsupported_feature("PHP", "EBNF");
     }
+    if (options.glr) {
+        throw unsupported_feature("PHP", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("PHP", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("PHP", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("PHP", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("PHP", "%split");
+    }
 
     std::string namespace_name(options.namespace_name);
 
@@ -157,6 +471,11 @@ class Nonterminal
 }
 )"
         );
+
+    if (options.table) {
+        generate_php_table_parser(os, options, ir);
+        return;
+    }
     
     stencil(
         os, R"(
@@ -185,6 +504,7 @@ class Stack
         array_splice(${d}this->stack, ${d}this->gap, count(${d}this->stack) - ${d}this->gap);
         ${d}this->stack = array_merge(${d}this->stack, ${d}this->tmp);
         ${d}this->tmp = array();
+        ${d}this->gap = count(${d}this->stack);
     }
 
     function push(${d}x)
@@ -657,41 +977,11 @@ $${debmes:repost_done}
             {"d", "$"}
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
-                nonterminal_types,
-                rule,
-                sa,
-                signature);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -767,7 +1057,7 @@ $${debmes:repost_done}
     }
 
     // states handler
-    for (const auto& state: table.states()) {
+    for (const auto& state: ir.states) {
         // state header
         stencil(
             os, R"(
@@ -792,83 +1082,68 @@ $${debmes:state}
                     }}}
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag =
-                options.token_prefix + tokens[token];
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "default:"
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        for (const auto& c: cases) {
+            // fall through, be aware when port to other language
+            if (c.tokens.empty()) {
+                stencil(
+                    os, R"(
+        default:
+)"
+                    );
+            }
+            for (int token: c.tokens) {
+                stencil(
+                    os, R"(
+        case \${namespace_name}\Token::${case}:
+)",
+                    {"namespace_name", namespace_name},
+                    {"case", options.token_prefix + tokens[token]}
+                    );
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
                         os, R"(
-        case \${namespace_name}\Token::${case_tag}:
             // shift
             ${d}this->push_stack(${dest_index}, ${d}value, 0);
             return FALSE;
 )",
                         {"d", "$"},
-                        {"namespace_name", namespace_name},
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
+                case TableIR::Reduce: {
+                    const auto& rule = ir.rules[action.value];
+                    if (0 <= rule.stub) {
                         stencil(
                             os, R"(
-        case \${namespace_name}\Token::${case_tag}:
+            // reduce
+            return ${d}this->call_${index}_${sa_name}(\${namespace_name}\Nonterminal::${nonterminal}, ${base}${args});
 )",
+                            {"d", "$"},
                             {"namespace_name", namespace_name},
-                            {"case_tag", case_tag}
+                            {"index", ir.stubs[rule.stub].index},
+                            {"sa_name", rule.action->name},
+                            {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                            {"base", rule.length},
+                            {"args", [&](std::ostream& os) {
+                                    for(const auto& x: rule.action->source_indices) {
+                                        os  << ", " << x;
+                                    }
+                                }}
                             );
-                        std::string funcname = "call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = sa.name;
-                        }
+                    } else {
                         stencil(
                             os, R"(
             // reduce
@@ -876,100 +1151,55 @@ $${debmes:state}
 )",
                             {"d", "$"},
                             {"namespace_name", namespace_name},
-                            {"funcname", funcname},
-                            {"nonterminal", rule.left().name()},
-                            {"base", base}
+                            {"funcname", rule.action ? rule.action->name : "call_nothing"},
+                            {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                            {"base", rule.length}
                             );
                     }
                 }
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
                         os, R"(
-        case \${namespace_name}\Token::${case_tag}:
             // accept
             ${d}this->accepted = TRUE;
             ${d}this->accepted_value = ${d}this->get_arg(1, 0);
             return FALSE;
 )",
-                        {"d", "$"},
-                        {"namespace_name", namespace_name},
-                        {"case_tag", case_tag}
+                        {"d", "$"}
                         );
                     break;
-                case zw::gr::action_error:
+                default:
                     stencil(
                         os, R"(
-        case \${namespace_name}\Token::${case_tag}:
             assert(FALSE);
             ${d}this->sa->syntax_error();
             ${d}this->error = TRUE;
             return FALSE;
 )",
-                        {"d", "$"},
-                        {"namespace_name", namespace_name},
-                        {"case_tag", case_tag},
-                        {"namespace_name", namespace_name}
+                        {"d", "$"}
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            for (size_t j = 0 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                stencil(
-                    os, R"(
-        case \${namespace_name}\Token::${case}:
-)",
-                    {"namespace_name", namespace_name},
-                    {"case", cases[j]}
-                    );
-            }
-
-            int index = stub_indices[signature];
-
+        // dispatcher footer / state footer
+        if (!default_reduce) {
             stencil(
                 os, R"(
-            // reduce
-            return ${d}this->call_${index}_${sa_name}(\${namespace_name}\Nonterminal::${nonterminal}, ${base}${args});
+        default:
+            ${d}this->sa->syntax_error();
+            ${d}this->error = TRUE;
+            return FALSE;
 )",
-                {"d", "$"},
-                {"namespace_name", namespace_name},
-                {"index", index},
-                {"sa_name", signature[0]},
-                {"nonterminal", nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
+                {"d", "$"}
                 );
         }
-
-        // dispatcher footer / state footer
         stencil(
             os, R"(
-        default:
-            ${d}this->sa->syntax_error();
-            ${d}this->error = TRUE;
-            return FALSE;
         }
     }
-)",
-                {"d", "$"}
+)"
             );
         
         // gotof header
@@ -993,7 +1223,7 @@ $${debmes:state}
                 {"d", "$"}
         );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
         case \${namespace_name}\Nonterminal::${nonterminal}:
@@ -1001,7 +1231,7 @@ $${debmes:state}
 )",
                 {"d", "$"},
                 {"namespace_name", namespace_name},
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
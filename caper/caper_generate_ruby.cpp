@@ -10,47 +10,309 @@
 #include "caper_stencil.hpp"
 #include "caper_finder.hpp"
 #include <algorithm>
-#include <boost/tuple/tuple.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
 
 namespace {
 
-std::string make_type_name(const Type& x) {
-    switch(x.extension) {
-        case Extension::None:
-            return x.name;
-        case Extension::Star:
-        case Extension::Plus:
-        case Extension::Slash:
-            return "Sequence<" + x.name + ">";
-        case Extension::Question:
-            return "Optional<" + x.name + ">";
-        default:
-            assert(0);
-            return "";
-    }
+// %table: frozen integer array constant
+void write_ruby_table(
+    std::ostream&           os,
+    const char*             name,
+    const std::vector<int>& v) {
+    stencil(
+        os, R"(
+        ${name} = [${values}
+        ].freeze
+)",
+        {"name", name},
+        {"values", [&](std::ostream& os) {
+                for (size_t i = 0 ; i < v.size() ; i++) {
+                    if (i % 16 == 0) { os << "\n            "; }
+                    os << v[i] << ",";
+                }
+            }}
+        );
 }
-        
-void make_signature(
-    const std::map<std::string, Type>&      nonterminal_types,
-    const tgt::parsing_table::rule_type&    rule,
-    const SemanticAction&                   sa,
-    std::vector<std::string>&               signature) {
-    // function name
-    signature.push_back(sa.name);
-
-    // return value
-    signature.push_back(
-        make_type_name(*finder(nonterminal_types, rule.left().name())));
-
-    // arguments
-    for (const auto& arg: sa.args) {
-        signature.push_back(make_type_name(arg.type));
+
+void generate_ruby_table_parser(
+    std::ostream&                       os,
+    const GenerateOptions&              options,
+    const TableIR&                      ir) {
+    stencil(
+        os, R"(
+
+    class Parser
+        attr_accessor :sa, :accepted, :error, :accepted_value
+
+)"
+        );
+
+    // tables
+    //   action code: shift dest << 2 | reduce rule << 2 | 1 |
+    //   accept 2 | error 3
+    std::vector<int> rule_length;
+    std::vector<int> rule_nonterminal;
+    for (const auto& rule: ir.rules) {
+        rule_length.push_back(rule.length);
+        rule_nonterminal.push_back(rule.nonterminal);
+    }
+    std::vector<int> handle_error;
+    for (const auto& state: ir.states) {
+        handle_error.push_back(state.handle_error ? 1 : 0);
+    }
+    write_ruby_table(os, "TokenClass", ir.token_class);
+    write_ruby_table(os, "ActionBase", ir.action_base);
+    write_ruby_table(os, "ActionCheck", ir.action_check);
+    write_ruby_table(os, "ActionNext", ir.action_next);
+    write_ruby_table(os, "ActionDefault", ir.action_default);
+    write_ruby_table(os, "GotoBase", ir.goto_base);
+    write_ruby_table(os, "GotoCheck", ir.goto_check);
+    write_ruby_table(os, "GotoNext", ir.goto_next);
+    write_ruby_table(os, "RuleLength", rule_length);
+    write_ruby_table(os, "RuleNonterminal", rule_nonterminal);
+    write_ruby_table(os, "HandleError", handle_error);
+
+    // semantic actions indexed by rule
+    //   one lambda for each rule the table reduces by, nil for the others
+    std::vector<bool> reduced(ir.rules.size());
+    for (const auto& state: ir.states) {
+        for (const auto& c: state.cases) {
+            if (c.action.kind == TableIR::Reduce) {
+                reduced[c.action.value] = true;
+            }
+        }
+        if (state.default_action.kind == TableIR::Reduce) {
+            reduced[state.default_action.value] = true;
+        }
     }
-}
 
+    stencil(
+        os, R"(
+        Reductions = [
+$${reductions}
+        ].freeze
+
+)",
+        {"reductions", [&](std::ostream& os) {
+                for (size_t r = 0 ; r < ir.rules.size() ; r++) {
+                    const auto& rule = ir.rules[r];
+                    if (!reduced[r] || !rule.action) {
+                        stencil(
+                            os, R"(
+            nil,
+)"
+                            );
+                        continue;
+                    }
+                    const auto& sa = *rule.action;
+                    stencil(
+                        os, R"(
+            ->(sa, parser, base) { sa.upcast(sa.${semantic_action_name}(${args})) },
+)",
+                        {"semantic_action_name", sa.name},
+                        {"args", [&](std::ostream& os) {
+                                for (size_t l = 0 ; l < sa.args.size() ; l++) {
+                                    if (l != 0) { os << ", "; }
+                                    os << "sa.downcast(parser.get_arg(base, "
+                                       << sa.args[l].source_index << "))";
+                                }
+                            }}
+                        );
+                }
+            }}
+        );
+
+    // parser
+    //   committed frames are [0, mark). while posting, frames popped from
+    //   them are [gap, mark) and pushed frames are [mark, top), so a
+    //   failed post leaves the committed stack as it was.
+    stencil(
+        os, R"(
+        def initialize sa
+            @sa = sa
+            reset
+        end
+
+        def reset
+            @error = @accepted = false
+            @accepted_value = nil
+            @states = []
+            @values = []
+            @gap = @mark = @top = 0
+            push ${first_state}, nil
+            commit
+        end
+
+        def post token, value
+            @gap = @top = @mark
+            @error = false
+            run Token[token], value
+            if !@error
+                commit
+            else
+                recover token, value
+            end
+            @accepted || @error
+        end
+
+        def accept
+            return nil if @error
+            return true if @accepted_value == nil
+            @accepted_value
+        end
+
+        def get_arg base, index
+            k = base - index
+            t = @top - @mark
+            k <= t ? @values[@top - k] : @values[@gap - (k - t)]
+        end
+
+        private
+
+        def run t, value
+            while true
+                s = state_top
+$${debmes:state}
+                c = TokenClass[t]
+                i = ActionBase[s] + c
+                code = ActionCheck[i] == c ? ActionNext[i] : ActionDefault[s]
+                case code & 3
+                when 1
+                    reduce code >> 2
+                when 0
+                    push code >> 2, value
+                    return
+                when 2
+                    @accepted = true
+                    @accepted_value = get_arg(1, 0)
+                    return
+                else
+                    @sa.syntax_error
+                    @error = true
+                    return
+                end
+            end
+        end
+
+        def reduce rule
+            base = RuleLength[rule]
+            action = Reductions[rule]
+            v = action ? action.call(@sa, self, base) : nil
+            pop base
+            push GotoNext[GotoBase[state_top] + RuleNonterminal[rule]], v
+        end
+
+        def push state, value
+            @states[@top] = state
+            @values[@top] = value
+            @top += 1
+        end
+
+        def pop n
+            t = @top - @mark
+            if t < n
+                @top = @mark
+                @gap -= n - t
+            else
+                @top -= n
+            end
+        end
+
+        def state_top
+            @mark < @top ? @states[@top - 1] : @states[@gap - 1]
+        end
+
+        def depth
+            @gap + @top - @mark
+        end
+
+        def commit
+            n = @top - @mark
+            if @gap != @mark
+                n.times do |i|
+                    @states[@gap + i] = @states[@mark + i]
+                    @values[@gap + i] = @values[@mark + i]
+                end
+                @values.fill nil, @gap + n, @top - (@gap + n)
+            end
+            @mark = @gap = @top = @gap + n
+        end
+
+)",
+        {"first_state", ir.first_state},
+        {"debmes:state", [&](std::ostream& os){
+                if (options.debug_parser) {
+                    stencil(
+                        os, R"(
+                $stderr.print("state_#{s} << #{Token.key(t)}\n")
+)"
+                        );
+                }}}
+        );
+
+    if (options.recovery) {
+        stencil(
+            os, R"(
+        def recover token, value
+            @gap = @top = @mark
+            @error = false
+$${debmes:start}
+            while HandleError[state_top] == 0
+                pop 1
+                if depth == 0
+$${debmes:failed}
+                    @error = true
+                    return
+                end
+            end
+$${debmes:done}
+            # post error_token;
+            run Token[:${recovery_token}], nil
+            commit
+            # repost original token
+            # if it still causes error, discard it;
+            run Token[token], value
+            commit if !@error
+            @error = false if token != :${token_eof}
+        end
+)",
+            {"recovery_token", options.token_prefix + options.recovery_token},
+            {"token_eof", options.token_prefix + "eof"},
+            {"debmes:start", {
+                    options.debug_parser ?
+                        R"(            $stderr.print "recover rewinding start: stack depth = #{depth}\n"
+)" :
+                        ""}},
+            {"debmes:failed", {
+                    options.debug_parser ?
+                        R"(                    $stderr.print "recover rewinding failed\n"
+)" :
+                        ""}},
+            {"debmes:done", {
+                    options.debug_parser ?
+                        R"(            $stderr.print "recover rewinding done: stack depth = #{depth}\n"
+)" :
+                        ""}}
+            );
+    } else {
+        stencil(
+            os, R"(
+        def recover token, value
+            ;
+        end
+)"
+            );
+    }
+
+    stencil(
+        os, R"(
+    end
+end
+)"
+        );
 }
 
+} // unnamed namespace
+
 void generate_ruby(
     const std::string&                  src_filename,
     std::ostream&                       os,
@@ -59,11 +321,27 @@ void generate_ruby(
     const std::map<std::string, Type>&  nonterminal_types,
     const std::vector<std::string>&     tokens,
     const action_map_type&              actions,
-    const tgt::parsing_table&           table) {
+    const tgt::parsing_table&           table,
+    const TableIR&                      ir) {
 
     if (options.allow_ebnf) {
         throw unsupported_feature("Ruby", "EBNF");
     }
+    if (options.glr) {
+        throw unsupported_feature("Ruby", "%glr");
+    }
+    if (options.snapshot) {
+        throw unsupported_feature("Ruby", "%snapshot");
+    }
+    if (!options.sync_symbol.empty()) {
+        throw unsupported_feature("Ruby", "%sync");
+    }
+    if (!options.lexer_rules.empty()) {
+        throw unsupported_feature("Ruby", "%lexer");
+    }
+    if (!options.split_include.empty()) {
+        throw unsupported_feature("Ruby", "%split");
+    }
 
     std::string namespace_name(options.namespace_name);
     if ('a' <= namespace_name[0] && namespace_name[0] <= 'z')
@@ -147,6 +425,11 @@ $${tokens}
     }
 )"
         );
+
+    if (options.table) {
+        generate_ruby_table_parser(os, options, ir);
+        return;
+    }
     
     stencil(
         os, R"(
@@ -169,6 +452,7 @@ $${tokens}
             @stack.slice! @gap, @stack.size - @gap
             @stack.concat @tmp
             @tmp = []
+            @gap = @stack.size
         end
 
         def push x
@@ -567,41 +851,11 @@ $${debmes:repost_done}
 )"
         );
 
-    // member function signature -> index
-    std::map<std::vector<std::string>, int> stub_indices;
+    // action handler stub
     {
-        // member function name -> count
-        std::unordered_map<std::string, int> stub_counts; 
-
-        // action handler stub
-        for (const auto& pair: actions) {
-            const auto& rule = pair.first;
-            const auto& sa = pair.second;
-
-            if (sa.special) {
-                continue;
-            }
-
-            // make signature
-            std::vector<std::string> signature;
-            make_signature(
-                nonterminal_types,
-                rule,
-                sa,
-                signature);
-
-            // skip duplicated
-            if (0 < stub_indices.count(signature)) {
-                continue;
-            }
-
-            // make function name
-            if (stub_counts.count(sa.name) == 0) {
-                stub_counts[sa.name] = 0;
-            }
-            int stub_index = stub_counts[sa.name];
-            stub_indices[signature] = stub_index;
-            stub_counts[sa.name] = stub_index+1;
+        for (const auto& stub: ir.stubs) {
+            const auto& sa = *stub.action;
+            int stub_index = stub.index;
 
             // header
             stencil(
@@ -671,13 +925,12 @@ $${debmes:repost_done}
     }
 
     // states handler
-    for (const auto& state: table.states()) {
+    for (const auto& state: ir.states) {
         // state header
         stencil(
             os, R"(
         def state_${state_no} token, value
 $${debmes:state}
-            case token
 )",
             {"state_no", state.no},
             {"debmes:state", [&](std::ostream& os){
@@ -691,181 +944,139 @@ $${debmes:state}
                     }}}
             );
 
-        // reduce action cache
-        typedef boost::tuple<
-            std::vector<std::string>,
-            std::string,
-            size_t,
-            std::vector<int>>
-            reduce_action_cache_key_type;
-        typedef 
-            std::map<reduce_action_cache_key_type,
-                     std::vector<std::string>>
-            reduce_action_cache_type;
-        reduce_action_cache_type reduce_action_cache;
-
-        // action table
-        for (const auto& pair: state.action_table) {
-            const auto& token = pair.first;
-            const auto& action = pair.second;
-
-            const auto& rule = action.rule;
-
-            // action header 
-            std::string case_tag =
-                options.token_prefix + tokens[token];
-
-            // action
-            switch (action.type) {
-                case zw::gr::action_shift:
+        // cases
+        //   the default reduction, if any, is the last one as "else".
+        //   a state with nothing else reduces without "case" (ruby
+        //   requires at least one "when").
+        std::vector<TableIR::Case> cases = state.cases;
+        bool default_reduce = state.default_action.kind == TableIR::Reduce;
+        bool dispatch = !cases.empty() || !default_reduce;
+        if (default_reduce) {
+            cases.push_back(TableIR::Case());
+            cases.back().action = state.default_action;
+        }
+
+        if (dispatch) {
+            stencil(
+                os, R"(
+            case token
+)"
+                );
+        }
+
+        for (const auto& c: cases) {
+            if (c.tokens.empty()) {
+                if (dispatch) {
+                    stencil(
+                        os, R"(
+            else
+)"
+                        );
+                }
+            } else {
+                stencil(
+                    os, R"(
+            when ${cases}
+)",
+                    {"cases", [&](std::ostream& os) {
+                            bool first = true;
+                            for (int token: c.tokens) {
+                                if (first) { first = false; }
+                                else { os << ", "; }
+                                os << ":" << options.token_prefix << tokens[token];
+                            }
+                        }}
+                    );
+            }
+
+            const TableIR::Action& action = c.action;
+            switch (action.kind) {
+                case TableIR::Shift:
                     stencil(
                         os, R"(
-            when :${case_tag}
                 # shift
                 push_stack ${dest_index}, value, 0
                 false
 )",
-                        {"case_tag", case_tag},
-                        {"dest_index", action.dest_index}
+                        {"dest_index", action.value}
                         );
                     break;
-                case zw::gr::action_reduce: {
-                    size_t base = rule.right().size();
-                    const std::string& rule_name = rule.left().name();
-
-                    auto k = finder(actions, rule);
-                    if (k && !(*k).special) {
-                        const auto& sa = *k;
-
-                        std::vector<std::string> signature;
-                        make_signature(
-                            nonterminal_types,
-                            rule,
-                            sa,
-                            signature);
-
-                        reduce_action_cache_key_type key =
-                            boost::make_tuple(
-                                signature,
-                                rule_name,
-                                base,
-                                sa.source_indices);
-
-                        reduce_action_cache[key].push_back(case_tag);
-                    } else {
+                case TableIR::Reduce: {
+                    const auto& rule = ir.rules[action.value];
+                    if (0 <= rule.stub) {
                         stencil(
                             os, R"(
-            when :${case_tag}
+                # reduce
+                call_${index}_${sa_name} :${nonterminal}, ${base}${args}
 )",
-                            {"case_tag", case_tag}
+                            {"index", ir.stubs[rule.stub].index},
+                            {"sa_name", rule.action->name},
+                            {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                            {"base", rule.length},
+                            {"args", [&](std::ostream& os) {
+                                    for(const auto& x: rule.action->source_indices) {
+                                        os  << ", " << x;
+                                    }
+                                }}
                             );
-                        std::string funcname = "call_nothing";
-                        if (k) {
-                            const auto& sa = *k;
-                            assert(sa.special);
-                            funcname = sa.name;
-                        }
+                    } else {
                         stencil(
                             os, R"(
                 # reduce
                 return ${funcname}(:${nonterminal}, ${base})
 )",
-                            {"funcname", funcname},
-                            {"nonterminal", rule.left().name()},
-                            {"base", base}
+                            {"funcname", rule.action ? rule.action->name : "call_nothing"},
+                            {"nonterminal", ir.nonterminals[rule.nonterminal]},
+                            {"base", rule.length}
                             );
                     }
                 }
                     break;
-                case zw::gr::action_accept:
+                case TableIR::Accept:
                     stencil(
                         os, R"(
-            when :${case_tag}
                 # accept
                 @accepted = true
                 @accepted_value = get_arg(1, 0)
                 false
-)",
-                        {"case_tag", case_tag}
+)"
                         );
                     break;
-                case zw::gr::action_error:
+                default:
                     stencil(
                         os, R"(
-            when :${case_tag}
                 ${namespace_name}::assert false
                 @sa.syntax_error
                 @error = true
                 false
 )",
-                        {"case_tag", case_tag},
                         {"namespace_name", namespace_name}
                         );
                     break;
             }
-
-            // action footer
         }
 
-        // flush reduce action cache
-        for(const auto& pair: reduce_action_cache) {
-            const reduce_action_cache_key_type& key = pair.first;
-            const std::vector<std::string>& cases = pair.second;
-
-            const std::vector<std::string>& signature = key.get<0>();
-            const std::string& nonterminal_name = key.get<1>();
-            size_t base = key.get<2>();
-            const std::vector<int>& arg_indices = key.get<3>();
-
-            stencil(
-                os, R"(
-            when :${case})",
-                    {"case", cases[0]}
-            );
-
-            for (size_t j = 1 ; j < cases.size() ; j++){
-                // fall through, be aware when port to other language
-                stencil(
-                    os, R"(, :${case})",
-                    {"case", cases[j]}
-                    );
-            }
-
+        // dispatcher footer / state footer
+        if (!default_reduce) {
             stencil(
                 os, R"(
-
+            else
+                @sa.syntax_error
+                @error = true
+                false
 )"
-            );
-
-            int index = stub_indices[signature];
-
+                );
+        }
+        if (dispatch) {
             stencil(
                 os, R"(
-                # reduce
-                call_${index}_${sa_name} :${nonterminal}, ${base}${args}
-)",
-                {"index", index},
-                {"sa_name", signature[0]},
-                {"nonterminal", nonterminal_name},
-                {"base", base},
-                {"args", [&](std::ostream& os) {
-                        for(const auto& x: arg_indices) {
-                            os  << ", " << x;
-                        }
-                    }}
+            end
+)"
                 );
         }
-
-        // dispatcher footer / state footer
         stencil(
             os, R"(
-            else
-                @sa.syntax_error
-                @error = true
-                false
-            end
         end
-
 )"
             );
         
@@ -885,13 +1096,13 @@ $${debmes:state}
 )"
             );
         bool output_switch = false;
-        for (const auto& pair: state.goto_table) {
+        for (const auto& pair: state.gotos) {
             stencil(
                 ss, R"(
             when :${nonterminal}
                 ${state_index}
 )",
-                {"nonterminal", pair.first.name()},
+                {"nonterminal", ir.nonterminals[pair.first]},
                 {"state_index", pair.second}
                 );
             output_switch = true;
@@ -0,0 +1,317 @@
+// tgt::parsing_table -> TableIR
+
+#include <algorithm>
+#include <set>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include "caper_ir.hpp"
+#include "caper_finder.hpp"
+
+namespace {
+
+// Sequence<T> and Optional<T> are the same type however they are written
+int type_kind(const Type& x) {
+    switch (x.extension) {
+        case Extension::None:       return 0;
+        case Extension::Question:   return 2;
+        default:                    return 1;
+    }
+}
+
+typedef std::vector<std::pair<std::string, int>> type_list;
+
+void add_type(type_list& v, const Type& x) {
+    v.push_back(std::make_pair(x.name, type_kind(x)));
+}
+
+int raw_action_code(const tgt::parsing_table::action& action) {
+    switch (action.type) {
+        case zw::gr::action_shift:
+            return action.dest_index << 2;
+        case zw::gr::action_reduce:
+            return int(action.rule.id()) << 2 | 1;
+        case zw::gr::action_accept:
+            return 2;
+        default:
+            return 3;
+    }
+}
+
+// row displacement
+//   a row is placed at the first base that no other row uses and where
+//   its columns are free; check holds the column of the occupant.
+//   identical rows with the same default get the same base.
+typedef std::vector<std::pair<int, int>> sparse_row;    // column -> value
+
+void pack_rows(
+    const std::vector<sparse_row>&  rows,
+    const std::vector<int>&         defaults,
+    int                             width,
+    std::vector<int>&               base,
+    std::vector<int>&               check,
+    std::vector<int>&               next) {
+    std::map<std::pair<sparse_row, int>, int> placed;
+    std::set<int> used;
+    int top = 0;
+
+    base.clear();
+    check.clear();
+    next.clear();
+    for (size_t r = 0 ; r < rows.size() ; r++) {
+        const sparse_row& row = rows[r];
+        auto key = std::make_pair(row, defaults[r]);
+        auto i = placed.find(key);
+        if (i != placed.end()) {
+            base.push_back(i->second);
+            continue;
+        }
+
+        int b = 0;
+        for (;; b++) {
+            if (used.count(b)) { continue; }
+            bool fit = true;
+            for (const auto& x: row) {
+                size_t k = size_t(b + x.first);
+                if (k < check.size() && check[k] != -1) {
+                    fit = false;
+                    break;
+                }
+            }
+            if (fit) { break; }
+        }
+
+        for (const auto& x: row) {
+            size_t k = size_t(b + x.first);
+            if (check.size() <= k) {
+                check.resize(k + 1, -1);
+                next.resize(k + 1, -1);
+            }
+            check[k] = x.first;
+            next[k] = x.second;
+        }
+        used.insert(b);
+        placed[key] = b;
+        base.push_back(b);
+        top = (std::max)(top, b);
+    }
+
+    // every base + column is in range
+    check.resize(size_t(top + width), -1);
+    next.resize(size_t(top + width), -1);
+}
+
+} // unnamed namespace
+
+int TableIR::nonterminal_index(const std::string& name) const {
+    auto i = std::lower_bound(nonterminals.begin(), nonterminals.end(), name);
+    if (i == nonterminals.end() || *i != name) { return -1; }
+    return int(i - nonterminals.begin());
+}
+
+int action_code(const TableIR::Action& action) {
+    switch (action.kind) {
+        case TableIR::Shift:    return action.value << 2;
+        case TableIR::Reduce:   return action.value << 2 | 1;
+        case TableIR::Accept:   return 2;
+        default:                return 3;
+    }
+}
+
+void make_table_ir(
+    TableIR&                            ir,
+    const GenerateOptions&              options,
+    const std::map<std::string, Type>&  nonterminal_types,
+    const std::vector<std::string>&     tokens,
+    const action_map_type&              actions,
+    const tgt::parsing_table&           table) {
+    ir = TableIR();
+    ir.tokens = tokens;
+    for (const auto& x: nonterminal_types) {
+        ir.nonterminals.push_back(x.first);
+    }
+    ir.first_state = table.first_state();
+
+    // rules and stubs
+    //   rules whose reductions make the same call get the same key
+    typedef boost::tuple<int, std::string, int, int, std::vector<int>, int>
+        call_key_type;
+    std::map<call_key_type, int> calls;
+    std::vector<int> call_of_rule;
+
+    typedef boost::tuple<std::string, type_list> stub_key_type;
+    std::map<stub_key_type, int> stub_of_key;
+    std::map<std::string, int> stub_counts;
+
+    const auto& grammar = table.get_grammar();
+    ir.rules.resize(grammar.size());
+    call_of_rule.resize(grammar.size());
+    for (const auto& rule: grammar) {
+        TableIR::Rule& r = ir.rules[rule.id()];
+        r.nonterminal = rule == grammar.root_rule() ?
+            -1 : ir.nonterminal_index(rule.left().name());
+        r.length = int(rule.right().size());
+
+        auto k = finder(actions, rule);
+        if (k) {
+            r.action = &*k;
+        }
+
+        if (r.action && !r.action->special && 0 <= r.nonterminal) {
+            const SemanticAction& sa = *r.action;
+            type_list types;
+            add_type(types, *finder(nonterminal_types, rule.left().name()));
+            for (const auto& arg: sa.args) {
+                add_type(types, arg.type);
+            }
+            stub_key_type key(sa.name, types);
+            auto i = stub_of_key.find(key);
+            if (i == stub_of_key.end()) {
+                TableIR::Stub stub;
+                stub.action = &sa;
+                stub.rule = int(rule.id());
+                stub.index = stub_counts[sa.name]++;
+                i = stub_of_key.insert(
+                    std::make_pair(key, int(ir.stubs.size()))).first;
+                ir.stubs.push_back(stub);
+            }
+            r.stub = i->second;
+        }
+
+        call_key_type key(
+            r.stub,
+            r.action && r.stub < 0 ? r.action->name : "",
+            r.nonterminal,
+            r.length,
+            r.action ? r.action->source_indices : std::vector<int>(),
+            options.profile ? int(rule.id()) : -1);
+        call_of_rule[rule.id()] = calls.insert(
+            std::make_pair(key, int(rule.id()))).first->second;
+    }
+
+    // states
+    std::vector<std::vector<int>> action_codes;     // state, token -> code
+    std::vector<sparse_row> goto_rows;
+    for (const auto& state: table.states()) {
+        TableIR::State s;
+        s.no = state.no;
+        s.handle_error = state.handle_error;
+
+        std::vector<std::pair<int, TableIR::Action>> entries;
+        for (const auto& pair: state.action_table) {
+            const auto& action = pair.second;
+            TableIR::Action a;
+            if (options.glr && 0 < state.conflict_table.count(pair.first)) {
+                a = TableIR::Action(TableIR::Conflict, -1);
+            } else {
+                switch (action.type) {
+                    case zw::gr::action_shift:
+                        a = TableIR::Action(TableIR::Shift, action.dest_index);
+                        break;
+                    case zw::gr::action_reduce:
+                        a = TableIR::Action(
+                            TableIR::Reduce, call_of_rule[action.rule.id()]);
+                        break;
+                    case zw::gr::action_accept:
+                        a = TableIR::Action(TableIR::Accept, -1);
+                        break;
+                    case zw::gr::action_error:
+                        a = TableIR::Action(TableIR::Error, -1);
+                        break;
+                }
+            }
+            entries.push_back(std::make_pair(pair.first, a));
+        }
+
+        // default reduction
+        //   the one make_lalr_table chose, taken on every lookahead
+        //   without an action. errors are detected in the state reached
+        //   after the reduction instead, except explicit ones (%nonassoc)
+        //   that must not be reduced over.
+        int default_rule = -1;
+        if (0 <= state.default_rule) {
+            default_rule = call_of_rule[state.default_rule];
+            s.default_action = TableIR::Action(TableIR::Reduce, default_rule);
+        }
+
+        // cases
+        //   reductions making the default call are left to the default,
+        //   so are explicit errors if there is no default reduction
+        std::map<std::pair<int, int>, size_t> case_of_action;
+        for (const auto& x: entries) {
+            const TableIR::Action& a = x.second;
+            if (a.kind == TableIR::Error && default_rule < 0) { continue; }
+            if (a.kind == TableIR::Reduce && a.value == default_rule) {
+                continue;
+            }
+            auto key = std::make_pair(int(a.kind), a.value);
+            auto i = case_of_action.find(key);
+            if (i == case_of_action.end()) {
+                i = case_of_action.insert(
+                    std::make_pair(key, s.cases.size())).first;
+                s.cases.push_back(TableIR::Case());
+                s.cases.back().action = a;
+            }
+            s.cases[i->second].tokens.push_back(x.first);
+        }
+        s.consistent = 0 <= default_rule && s.cases.empty();
+
+        // gotos
+        for (const auto& pair: state.goto_table) {
+            s.gotos.push_back(
+                std::make_pair(
+                    ir.nonterminal_index(pair.first.name()), pair.second));
+        }
+        std::sort(s.gotos.begin(), s.gotos.end());
+
+        // action codes
+        //   conflicts are packed as the action the table adopted
+        int default_code = action_code(s.default_action);
+        std::vector<int> codes(tokens.size(), default_code);
+        for (const auto& x: entries) {
+            codes[x.first] = x.second.kind == TableIR::Conflict ?
+                raw_action_code(state.action_table.at(x.first)) :
+                action_code(x.second);
+        }
+        action_codes.push_back(codes);
+        ir.action_default.push_back(default_code);
+        goto_rows.push_back(s.gotos);
+
+        ir.states.push_back(s);
+    }
+
+    // token classes
+    //   tokens with the same action code in every state are one column
+    //   of the packed action table, numbered in token order
+    std::map<std::vector<int>, int> class_of_column;
+    for (size_t t = 0 ; t < tokens.size() ; t++) {
+        std::vector<int> column;
+        for (const auto& codes: action_codes) {
+            column.push_back(codes[t]);
+        }
+        ir.token_class.push_back(
+            class_of_column.insert(
+                std::make_pair(column, ir.class_count)).first->second);
+        if (ir.token_class.back() == ir.class_count) { ir.class_count++; }
+    }
+
+    // packed rows
+    std::vector<sparse_row> action_rows;
+    for (size_t i = 0 ; i < action_codes.size() ; i++) {
+        sparse_row action_row;
+        int c = 0;
+        for (size_t t = 0 ; t < tokens.size() ; t++) {
+            if (ir.token_class[t] != c) { continue; }
+            if (action_codes[i][t] != ir.action_default[i]) {
+                action_row.push_back(std::make_pair(c, action_codes[i][t]));
+            }
+            c++;
+        }
+        action_rows.push_back(action_row);
+    }
+
+    pack_rows(action_rows, ir.action_default, ir.class_count,
+              ir.action_base, ir.action_check, ir.action_next);
+    pack_rows(goto_rows, std::vector<int>(goto_rows.size(), -1),
+              int(ir.nonterminals.size()),
+              ir.goto_base, ir.goto_check, ir.goto_next);
+}
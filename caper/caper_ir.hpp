@@ -0,0 +1,109 @@
+#ifndef CAPER_IR_HPP
+#define CAPER_IR_HPP
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "caper_ast.hpp"
+
+////////////////////////////////////////////////////////////////
+// TableIR
+//   language neutral form of the parsing table. it is made once after
+//   make_target_parser and every generator emits from it.
+//   tokens and nonterminals are numbered densely, nonterminals in name
+//   order (the order of the generated Nonterminal enumerations).
+//   the root rule has nonterminal -1.
+struct TableIR {
+    enum ActionKind {
+        Shift,      // value: destination state
+        Reduce,     // value: rule
+        Accept,
+        Error,
+        Conflict,   // %glr: decided at runtime
+    };
+
+    struct Action {
+        ActionKind  kind    = Error;
+        int         value   = -1;
+
+        Action() {}
+        Action(ActionKind k, int v) : kind(k), value(v) {}
+    };
+
+    struct Rule {
+        int                     nonterminal = -1;
+        int                     length      = 0;
+        const SemanticAction*   action      = nullptr;  // none: nullptr
+        int                     stub        = -1;       // special/none: -1
+    };
+
+    // reduction stub
+    //   non-special semantic actions with the same name, result type and
+    //   argument types share one stub, called as call_<index>_<name>.
+    struct Stub {
+        const SemanticAction*   action  = nullptr;
+        int                     rule    = -1;   // first rule using it
+        int                     index   = 0;
+    };
+
+    // tokens that lead to the same code. reductions of different rules
+    // that make the same call (stub, nonterminal, length, arguments) are
+    // one case; with --profile every rule is a case of its own.
+    struct Case {
+        std::vector<int>    tokens;
+        Action              action;
+    };
+
+    // a consistent state reduces by the default whatever the lookahead
+    // is, so a parser may reduce it before the next token arrives.
+    struct State {
+        int                 no              = -1;
+        bool                handle_error    = false;
+        std::vector<Case>   cases;          // in token order
+        Action              default_action; // Error, or the default reduction
+        bool                consistent      = false;
+        std::vector<std::pair<int, int>>    gotos;  // nonterminal -> state
+    };
+
+    std::vector<std::string>    tokens;
+    std::vector<std::string>    nonterminals;
+    std::vector<Rule>           rules;
+    std::vector<Stub>           stubs;
+    std::vector<State>          states;
+    int                         first_state = 0;
+
+    // token classes
+    //   tokens that have the same action in every state share a class.
+    //   classes are numbered in the order of their first token.
+    std::vector<int>    token_class;    // token -> class
+    int                 class_count = 0;
+
+    // packed tables (row displacement, identical rows share their slots)
+    //   action code of (state, token), c = token_class[token]:
+    //     i = action_base[state] + c
+    //     action_check[i] == c ? action_next[i] : action_default[state]
+    //   code: shift dest << 2 | reduce rule << 2 | 1 | accept 2 | error 3
+    //   destination of (state, nonterminal) likewise from goto_*, -1 if none
+    std::vector<int>    action_base;
+    std::vector<int>    action_check;
+    std::vector<int>    action_next;
+    std::vector<int>    action_default;
+    std::vector<int>    goto_base;
+    std::vector<int>    goto_check;
+    std::vector<int>    goto_next;
+
+    int nonterminal_index(const std::string& name) const;
+};
+
+int action_code(const TableIR::Action& action);
+
+void make_table_ir(
+    TableIR&                            ir,
+    const GenerateOptions&              options,
+    const std::map<std::string, Type>&  nonterminal_types,
+    const std::vector<std::string>&     tokens,
+    const action_map_type&              actions,
+    const tgt::parsing_table&           table);
+
+#endif // CAPER_IR_HPP
@@ -0,0 +1,508 @@
+// %lexer patterns -> minimized DFA
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <set>
+#include "caper_lexer.hpp"
+#include "caper_error.hpp"
+
+namespace {
+
+typedef std::bitset<256> charset;
+
+struct nfa_state {
+    std::vector<std::pair<charset, int>>    edges;
+    std::vector<int>                        epsilons;
+    int                                     accept = -1;
+};
+
+typedef std::vector<nfa_state>  nfa_type;
+typedef std::pair<int, int>     fragment;   // (start, end)
+
+////////////////////////////////////////////////////////////////
+// regex_parser
+//   a|b  ab  a*  a+  a?  (a)  [a-z]  [^a-z]  .
+//   \n \t \r \f \v \0 \xHH \d \D \w \W \s \S, other \c is c itself
+class regex_parser {
+public:
+    regex_parser(nfa_type& nfa, const LexerRule& rule)
+        : nfa_(nfa), rule_(rule), s_(rule.pattern), p_(0), literal_(true) {}
+
+    fragment parse() {
+        fragment f = alternation();
+        if (p_ != s_.size()) { fail("unbalanced ')'"); }
+        return f;
+    }
+
+    // the pattern has no operators, text() is the string it matches
+    bool literal() const { return literal_; }
+    const std::string& text() const { return text_; }
+
+private:
+    int new_state() {
+        nfa_.push_back(nfa_state());
+        return int(nfa_.size() - 1);
+    }
+
+    void epsilon(int from, int to) {
+        nfa_[from].epsilons.push_back(to);
+    }
+
+    fragment single(const charset& cs) {
+        int s = new_state();
+        int e = new_state();
+        nfa_[s].edges.push_back(std::make_pair(cs, e));
+        return fragment(s, e);
+    }
+
+    bool eos() const { return s_.size() <= p_; }
+    int peek() const { return eos() ? -1 : (unsigned char)s_[p_]; }
+    int next() { return (unsigned char)s_[p_++]; }
+
+    [[noreturn]] void fail(const std::string& m) {
+        throw bad_regex(rule_.addr, rule_.pattern, m);
+    }
+
+    fragment alternation() {
+        fragment f = concatenation();
+        while (peek() == '|') {
+            literal_ = false;
+            p_++;
+            fragment g = concatenation();
+            int s = new_state();
+            int e = new_state();
+            epsilon(s, f.first);
+            epsilon(s, g.first);
+            epsilon(f.second, e);
+            epsilon(g.second, e);
+            f = fragment(s, e);
+        }
+        return f;
+    }
+
+    fragment concatenation() {
+        int s = new_state();
+        fragment f(s, s);
+        while (!eos() && peek() != '|' && peek() != ')') {
+            fragment g = repetition();
+            epsilon(f.second, g.first);
+            f.second = g.second;
+        }
+        return f;
+    }
+
+    fragment repetition() {
+        fragment f = atom();
+        for (;;) {
+            int c = peek();
+            if (c != '*' && c != '+' && c != '?') { break; }
+            literal_ = false;
+            p_++;
+            int s = new_state();
+            int e = new_state();
+            epsilon(s, f.first);
+            epsilon(f.second, e);
+            if (c != '+') { epsilon(s, e); }
+            if (c != '?') { epsilon(f.second, f.first); }
+            f = fragment(s, e);
+        }
+        return f;
+    }
+
+    fragment atom() {
+        int c = next();
+        switch (c) {
+            case '(': {
+                literal_ = false;
+                fragment f = alternation();
+                if (peek() != ')') { fail("missing ')'"); }
+                p_++;
+                return f;
+            }
+            case '[':
+                literal_ = false;
+                return single(bracket());
+            case '.': {
+                literal_ = false;
+                charset cs;
+                cs.set();
+                cs.reset('\n');
+                return single(cs);
+            }
+            case '*': case '+': case '?':
+                fail("nothing to repeat");
+            case '\\': {
+                int k;
+                charset cs = escape(k);
+                if (k < 0) {
+                    literal_ = false;
+                } else {
+                    text_ += char(k);
+                }
+                return single(cs);
+            }
+            default: {
+                charset cs;
+                cs.set(c);
+                text_ += char(c);
+                return single(cs);
+            }
+        }
+    }
+
+    // after '\'. k is the character, or -1 for a class escape
+    charset escape(int& k) {
+        if (eos()) { fail("trailing '\\'"); }
+        charset cs;
+        int c = next();
+        k = -1;
+        switch (c) {
+            case 'd': case 'D':
+                for (int i = '0' ; i <= '9' ; i++) { cs.set(i); }
+                break;
+            case 'w': case 'W':
+                for (int i = 0 ; i < 256 ; i++) {
+                    if (i < 128 && (isalnum(i) || i == '_')) { cs.set(i); }
+                }
+                break;
+            case 's': case 'S':
+                for (const char* p = " \t\r\n\f\v" ; *p ; p++) { cs.set(*p); }
+                break;
+            case 'n': k = '\n'; break;
+            case 't': k = '\t'; break;
+            case 'r': k = '\r'; break;
+            case 'f': k = '\f'; break;
+            case 'v': k = '\v'; break;
+            case '0': k = '\0'; break;
+            case 'x': {
+                k = 0;
+                for (int i = 0 ; i < 2 ; i++) {
+                    int h = peek();
+                    if (h < 0 || !isxdigit(h)) { fail("bad \\x escape"); }
+                    p_++;
+                    k = k * 16 + (isdigit(h) ? h - '0' : tolower(h) - 'a' + 10);
+                }
+                break;
+            }
+            default: k = c; break;
+        }
+        if (0 <= k) {
+            cs.set(k);
+        } else if (isupper(c)) {
+            cs.flip();
+        }
+        return cs;
+    }
+
+    // after '['
+    charset bracket() {
+        charset cs;
+        bool negate = false;
+        if (peek() == '^') { negate = true; p_++; }
+        bool first = true;
+        for (;;) {
+            if (eos()) { fail("missing ']'"); }
+            int c = next();
+            if (c == ']' && !first) { break; }
+            first = false;
+
+            int lo = c;
+            if (c == '\\') {
+                charset x = escape(lo);
+                if (lo < 0) { cs |= x; continue; }
+            }
+            if (peek() == '-' && p_ + 1 < s_.size() && s_[p_ + 1] != ']') {
+                p_++;
+                int hi = next();
+                if (hi == '\\') {
+                    escape(hi);
+                    if (hi < 0) { fail("bad range"); }
+                }
+                if (hi < lo) { fail("bad range"); }
+                for (int i = lo ; i <= hi ; i++) { cs.set(i); }
+            } else {
+                cs.set(lo);
+            }
+        }
+        if (negate) { cs.flip(); }
+        return cs;
+    }
+
+private:
+    nfa_type&           nfa_;
+    const LexerRule&    rule_;
+    const std::string&  s_;
+    size_t              p_;
+    bool                literal_;
+    std::string         text_;
+
+};
+
+void closure(const nfa_type& nfa, std::vector<int>& states) {
+    std::vector<bool> visited(nfa.size());
+    std::vector<int> stack(states);
+    for (int s: states) { visited[s] = true; }
+    while (!stack.empty()) {
+        int s = stack.back();
+        stack.pop_back();
+        for (int t: nfa[s].epsilons) {
+            if (!visited[t]) {
+                visited[t] = true;
+                states.push_back(t);
+                stack.push_back(t);
+            }
+        }
+    }
+    std::sort(states.begin(), states.end());
+}
+
+// partitions the bytes by membership in the edge labels
+void make_char_classes(LexerTable& table, const nfa_type& nfa) {
+    std::vector<int> classes(256, 0);
+    int count = 1;
+    std::set<std::string> seen;
+    for (const auto& state: nfa) {
+        for (const auto& edge: state.edges) {
+            if (!seen.insert(edge.first.to_string()).second) { continue; }
+            std::map<std::pair<int, bool>, int> split;
+            for (int c = 0 ; c < 256 ; c++) {
+                auto key = std::make_pair(classes[c], bool(edge.first[c]));
+                auto i = split.find(key);
+                if (i == split.end()) {
+                    i = split.insert(
+                        std::make_pair(key, int(split.size()))).first;
+                }
+                classes[c] = (*i).second;
+            }
+            count = int(split.size());
+        }
+    }
+    table.char_classes = classes;
+    table.class_count = count;
+}
+
+// subset construction, dead state 0, start state 1
+void make_dfa(LexerTable& table, const nfa_type& nfa, int start) {
+    std::vector<int> representatives(table.class_count, -1);
+    for (int c = 255 ; 0 <= c ; c--) {
+        representatives[table.char_classes[c]] = c;
+    }
+
+    std::map<std::vector<int>, int> ids;
+    std::vector<std::vector<int>> sets;
+    auto add = [&](const std::vector<int>& s) -> int {
+        auto i = ids.find(s);
+        if (i != ids.end()) { return (*i).second; }
+        int id = int(sets.size());
+        ids[s] = id;
+        sets.push_back(s);
+        return id;
+    };
+
+    add(std::vector<int>());
+    std::vector<int> s0(1, start);
+    closure(nfa, s0);
+    add(s0);
+
+    table.transitions.clear();
+    table.accepts.clear();
+    for (size_t i = 0 ; i < sets.size() ; i++) {
+        std::vector<int> row(table.class_count, 0);
+        for (int c = 0 ; c < table.class_count ; c++) {
+            int b = representatives[c];
+            std::vector<int> t;
+            for (int s: sets[i]) {
+                for (const auto& edge: nfa[s].edges) {
+                    if (edge.first[b]) { t.push_back(edge.second); }
+                }
+            }
+            if (t.empty()) { continue; }
+            std::sort(t.begin(), t.end());
+            t.erase(std::unique(t.begin(), t.end()), t.end());
+            closure(nfa, t);
+            row[c] = add(t);
+        }
+        int accept = -1;
+        for (int s: sets[i]) {
+            int a = nfa[s].accept;
+            if (0 <= a && (accept < 0 || a < accept)) { accept = a; }
+        }
+        table.transitions.push_back(row);
+        table.accepts.push_back(accept);
+    }
+}
+
+// moore's partition refinement, then merges equal columns
+void minimize(LexerTable& table) {
+    size_t n = table.transitions.size();
+
+    // the dead state stays alone, states differing in accept never merge
+    std::vector<int> block(n);
+    {
+        std::map<int, int> ids;
+        for (size_t s = 0 ; s < n ; s++) {
+            int key = s == 0 ? -2 : table.accepts[s];
+            auto i = ids.insert(std::make_pair(key, int(ids.size()))).first;
+            block[s] = (*i).second;
+        }
+    }
+
+    size_t count = 0;
+    for (;;) {
+        std::map<std::vector<int>, int> ids;
+        std::vector<int> next(n);
+        for (size_t s = 0 ; s < n ; s++) {
+            std::vector<int> key(1, block[s]);
+            for (int t: table.transitions[s]) { key.push_back(block[t]); }
+            auto i = ids.insert(std::make_pair(key, int(ids.size()))).first;
+            next[s] = (*i).second;
+        }
+        block.swap(next);
+        if (ids.size() == count) { break; }
+        count = ids.size();
+    }
+
+    // renumber in order of the lowest member, keeps 0 and 1 in place
+    std::vector<int> number(count, -1);
+    int m = 0;
+    for (size_t s = 0 ; s < n ; s++) {
+        if (number[block[s]] < 0) { number[block[s]] = m++; }
+    }
+
+    std::vector<std::vector<int>> transitions(m);
+    std::vector<int> accepts(m);
+    for (size_t s = 0 ; s < n ; s++) {
+        int d = number[block[s]];
+        transitions[d] = table.transitions[s];
+        for (int& t: transitions[d]) { t = number[block[t]]; }
+        accepts[d] = table.accepts[s];
+    }
+
+    // classes that behave the same in every state
+    std::map<std::vector<int>, int> columns;
+    std::vector<int> remap(table.class_count);
+    for (int c = 0 ; c < table.class_count ; c++) {
+        std::vector<int> column;
+        for (const auto& row: transitions) { column.push_back(row[c]); }
+        auto i = columns.insert(
+            std::make_pair(column, int(columns.size()))).first;
+        remap[c] = (*i).second;
+    }
+    for (auto& row: transitions) {
+        std::vector<int> r(columns.size());
+        for (int c = 0 ; c < table.class_count ; c++) { r[remap[c]] = row[c]; }
+        row.swap(r);
+    }
+    for (int& c: table.char_classes) { c = remap[c]; }
+    table.class_count = int(columns.size());
+
+    table.transitions.swap(transitions);
+    table.accepts.swap(accepts);
+}
+
+void build(LexerTable& table,
+           const std::vector<LexerRule>& rules,
+           const std::vector<bool>& excluded) {
+    nfa_type nfa;
+    int start = 0;
+    nfa.push_back(nfa_state());
+    for (size_t i = 0 ; i < rules.size() ; i++) {
+        if (excluded[i]) { continue; }
+        regex_parser parser(nfa, rules[i]);
+        fragment f = parser.parse();
+        nfa[f.second].accept = int(i);
+        nfa[start].epsilons.push_back(f.first);
+    }
+    make_char_classes(table, nfa);
+    make_dfa(table, nfa, start);
+}
+
+int run(const LexerTable& table, const std::string& s) {
+    int state = 1;
+    for (char c: s) {
+        state = table.transitions[state][table.char_classes[(unsigned char)c]];
+        if (state == 0) { return -1; }
+    }
+    return table.accepts[state];
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////
+// make_lexer_table
+void make_lexer_table(LexerTable& table, const std::vector<LexerRule>& rules) {
+    size_t n = rules.size();
+    table.literals.assign(n, "");
+    table.keywords.assign(n, std::vector<int>());
+
+    // syntax check, empty matches would never advance the input
+    std::vector<bool> literal(n);
+    for (size_t i = 0 ; i < n ; i++) {
+        nfa_type nfa;
+        regex_parser parser(nfa, rules[i]);
+        fragment f = parser.parse();
+        std::vector<int> s(1, f.first);
+        closure(nfa, s);
+        if (std::binary_search(s.begin(), s.end(), f.second)) {
+            throw bad_regex(rules[i].addr, rules[i].pattern,
+                            "matches the empty string");
+        }
+        literal[i] = parser.literal();
+        if (literal[i]) { table.literals[i] = parser.text(); }
+    }
+
+    // literals fully matched by a non-literal token pattern declared
+    // after them are keywords. one declared after the pattern stays in
+    // the DFA, where it loses the tie as any other pattern would
+    std::vector<bool> excluded(literal);
+    build(table, rules, excluded);
+    for (size_t i = 0 ; i < n ; i++) {
+        excluded[i] = false;
+        if (!literal[i] || rules[i].name.empty()) { continue; }
+        int a = run(table, table.literals[i]);
+        if (int(i) < a && !rules[a].name.empty()) {
+            // a repeated keyword is unreachable, as in the DFA
+            excluded[i] = true;
+            bool repeated = false;
+            for (int k: table.keywords[a]) {
+                repeated |= table.literals[k] == table.literals[i];
+            }
+            if (!repeated) { table.keywords[a].push_back(int(i)); }
+        }
+    }
+    for (size_t i = 0 ; i < n ; i++) {
+        if (!excluded[i]) { table.literals[i] = ""; }
+    }
+
+    build(table, rules, excluded);
+    minimize(table);
+}
+
+////////////////////////////////////////////////////////////////
+// perfect hash
+unsigned perfect_hash(unsigned multiplier, unsigned size, const std::string& s) {
+    unsigned h = unsigned(s.size());
+    for (char c: s) { h = h * multiplier + (unsigned char)c; }
+    return h % size;
+}
+
+void make_perfect_hash(PerfectHash& hash, const std::vector<std::string>& keys) {
+    for (unsigned size = unsigned(keys.size()) ; ; size++) {
+        for (unsigned multiplier = 1 ; multiplier <= 256 ; multiplier++) {
+            std::vector<int> slots(size, -1);
+            bool ok = true;
+            for (size_t i = 0 ; i < keys.size() && ok ; i++) {
+                unsigned h = perfect_hash(multiplier, size, keys[i]);
+                ok = slots[h] < 0;
+                slots[h] = int(i);
+            }
+            if (ok) {
+                hash.multiplier = multiplier;
+                hash.size = size;
+                hash.slots.swap(slots);
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef CAPER_LEXER_HPP
+#define CAPER_LEXER_HPP
+
+#include <string>
+#include <vector>
+#include "caper_ast.hpp"
+
+////////////////////////////////////////////////////////////////
+// LexerTable
+//   minimized DFA for the %lexer patterns. state 0 is the dead state,
+//   state 1 is the start state. bytes are mapped to equivalence classes
+//   first, so that a state has one transition per class.
+//   longest match wins, ties go to the pattern declared first.
+struct LexerTable {
+    std::vector<int>                char_classes;   // byte -> class
+    int                             class_count = 0;
+    std::vector<std::vector<int>>   transitions;    // state -> class -> state
+    std::vector<int>                accepts;        // state -> rule or -1
+
+    // literal patterns that a pattern declared after them also matches
+    // (keywords).
+    // they are not part of the DFA, the generated lexer looks them up
+    // by perfect hash after the pattern they collide with has matched.
+    std::vector<std::string>        literals;       // rule -> text or ""
+    std::vector<std::vector<int>>   keywords;       // rule -> keyword rules
+};
+
+void make_lexer_table(LexerTable& table, const std::vector<LexerRule>& rules);
+
+////////////////////////////////////////////////////////////////
+// PerfectHash
+//   h = length; for each byte: h = h * multiplier + byte (32bit unsigned)
+//   slot = h % size. multiplier and size are searched so that the keys
+//   do not collide.
+struct PerfectHash {
+    unsigned            multiplier = 1;
+    unsigned            size = 1;
+    std::vector<int>    slots;  // slot -> key index or -1
+};
+
+unsigned perfect_hash(unsigned multiplier, unsigned size, const std::string& s);
+void make_perfect_hash(PerfectHash& hash, const std::vector<std::string>& keys);
+
+#endif // CAPER_LEXER_HPP
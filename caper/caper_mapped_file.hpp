@@ -0,0 +1,56 @@
+#ifndef CAPER_MAPPED_FILE_HPP
+#define CAPER_MAPPED_FILE_HPP
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+////////////////////////////////////////////////////////////////
+// mapped_file
+//   the whole input file as one contiguous read-only buffer. the file is
+//   memory mapped; empty files and files that cannot be mapped are read
+//   into memory instead.
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& path) : open_(false) {
+        namespace ip = boost::interprocess;
+        try {
+            ip::file_mapping mapping(path.c_str(), ip::read_only);
+            ip::mapped_region region(mapping, ip::read_only);
+            region_.swap(region);
+            open_ = true;
+            return;
+        }
+        catch (ip::interprocess_exception&) {
+        }
+
+        std::ifstream ifs(path.c_str(), std::ios::in | std::ios::binary);
+        if (!ifs) { return; }
+        buffer_.assign(std::istreambuf_iterator<char>(ifs),
+                       std::istreambuf_iterator<char>());
+        open_ = true;
+    }
+
+    bool is_open() const { return open_; }
+
+    const char* begin() const {
+        return region_.get_size() ?
+            static_cast<const char*>(region_.get_address()) :
+            buffer_.data();
+    }
+    const char* end() const {
+        return begin() + (region_.get_size() ?
+                          region_.get_size() : buffer_.size());
+    }
+
+private:
+    bool                                    open_;
+    boost::interprocess::mapped_region      region_;
+    std::vector<char>                       buffer_;
+
+};
+
+#endif // CAPER_MAPPED_FILE_HPP
@@ -5,7 +5,8 @@
 
 ////////////////////////////////////////////////////////////////
 // scanner
-template <class It>
+//   scans a contiguous buffer, token values are views into it.
+//   the buffer must outlive the values (get_symbol() copies).
 class scanner {
 public:
     typedef int char_type;
@@ -14,7 +15,7 @@ public:
     static const char_type eof = -1;
     
 public:
-    scanner(It b, It e) : b_(b), e_(e), c_(b), unget_(eof) {
+    scanner(const char* b, const char* e) : b_(b), e_(e), c_(b) {
         addr_ = 0;
         dirdic_["token"] = token_directive_token;
         dirdic_["token_prefix"] = token_directive_token_prefix;
@@ -25,18 +26,29 @@ public:
         dirdic_["access_modifier"] = token_directive_access_modifier;
         dirdic_["dont_use_stl"] = token_directive_dont_use_stl;
         dirdic_["smart_pointer"] = token_directive_smart_pointer;
-        lines_.push_back(0);
+        dirdic_["glr"] = token_directive_glr;
+        dirdic_["snapshot"] = token_directive_snapshot;
+        dirdic_["sync"] = token_directive_sync;
+        dirdic_["lexer"] = token_directive_lexer;
+        dirdic_["split"] = token_directive_split;
+        dirdic_["table"] = token_directive_table;
+        dirdic_["left"] = token_directive_left;
+        dirdic_["right"] = token_directive_right;
+        dirdic_["nonassoc"] = token_directive_nonassoc;
+        dirdic_["prec"] = token_directive_prec;
     }
     ~scanner() {}
 
     int addr() { return addr_; }
 
     int lineno(int addr) {
+        make_lines();
         auto i = std::upper_bound(lines_.cbegin(), lines_.cend(), addr);
         assert(i != lines_.begin());
         return int(i - lines_.begin());
     }
     int column(int addr) {
+        make_lines();
         auto i = std::upper_bound(lines_.cbegin(), lines_.cend(), addr);
         assert(i != lines_.begin());
         --i;
@@ -57,7 +69,7 @@ public:
             int k = sgetc();
             if (k == '/') {
                 // C++ comment //...
-                while ((k = sgetc()) != '\n')
+                while ((k = sgetc()) != '\n' && k != eof)
                     ;
                 goto retry;
             } else if (k == '*') {
@@ -92,14 +104,13 @@ public:
 
         // ʎq
         if (isalpha(c)) {
-            std::stringstream ss;
+            const char* s = c_ - 1;
             while (c != eof &&
                    (isalpha(c) || isdigit(c) || c == '_' || c == '.')) {
-                ss << (char)c;
                 c = sgetc();
             }
             sungetc(c);
-            v = value(b, Identifier(ss.str()));
+            v = value(b, Identifier(view(s)));
             return token_identifier;
         }
 
@@ -118,57 +129,72 @@ public:
 
         //fBNeBu
         if (c == '%') {
-            std::stringstream ss;
+            const char* s = c_;
             c = sgetc();
             while (c != eof &&(isalpha(c)|| isdigit(c)|| c == '_')) {
-                ss <<(char)c;
                 c = sgetc();
             }
             sungetc(c);
 
-            dirdic_type::const_iterator  i = dirdic_.find(ss.str());
+            std::string name(s, c_);
+            dirdic_type::const_iterator  i = dirdic_.find(name);
             if (i != dirdic_.end()) {
-                v = value(b, Directive(ss.str()));
+                v = value(b, Directive(view(s)));
                 return(*i).second;
             }
-            throw bad_directive(addr_, ss.str());
+            throw bad_directive(addr_, name);
+        }
+
+        // (%lexer̃p^[)
+        if (c == '"') {
+            const char* s = c_;
+            for (;;) {
+                c = sgetc();
+                if (c == eof || c == '\n') {
+                    throw unexpected_char(addr_, c);
+                }
+                if (c == '"') { break; }
+                if (c == '\\') {
+                    // GXP[v͂̂܂܎c
+                    c = sgetc();
+                    if (c == eof || c == '\n') {
+                        throw unexpected_char(addr_, c);
+                    }
+                }
+            }
+            v = value(b, String(symbol_type(s, c_ - 1 - s)));
+            return token_string;
         }
 
         // ^^O
         if (c == '<') {
             std::vector<char> stack;
             stack.push_back('<');
-            std::stringstream ss;
+            const char* s = c_;
 
             while (!stack.empty()) {
                 c = sgetc();
                 switch (c) {
-                    case '<': push_paren(stack, c); ss << char(c); break;
-                    case '(': push_paren(stack, c); ss << char(c); break;
-                    case '[': push_paren(stack, c); ss << char(c); break;
-                    case '>':
-                        pop_paren(stack, c);
-                        if (!stack.empty()) {
-                            ss << char(c);
-                        }
-                        break;
-                    case ')': pop_paren(stack, c); ss << char(c); break;
-                    case ']': pop_paren(stack, c); ss << char(c); break;
+                    case '<': push_paren(stack, c); break;
+                    case '(': push_paren(stack, c); break;
+                    case '[': push_paren(stack, c); break;
+                    case '>': pop_paren(stack, c); break;
+                    case ')': pop_paren(stack, c); break;
+                    case ']': pop_paren(stack, c); break;
                     case eof: throw mismatch_paren(addr_, c);
                     default:
                         if (c == '*' || c == ':' || c == ',' || c == '_' || c == '.' ||
                             isspace(c)|| isalpha(c)|| isdigit(c)) {
-                            ss << char(c);
                             break;
                         } else {
                             throw unexpected_char(addr_, c);
                         }
                 }
             }
-            if (ss.str() == "") {
+            if (c_ - 1 == s) {
                 throw empty_type_tag(addr_);
             }
-            v = value(b, TypeTag(ss.str()));
+            v = value(b, TypeTag(symbol_type(s, c_ - 1 - s)));
             return token_typetag;
         }
 
@@ -177,26 +203,33 @@ public:
 
 private:
     char_type sgetc() {
-        int c;
-        if (unget_ != eof) {
-            c = unget_;
-            unget_ = eof;
-        } else if (c_ == e_) {
-            c = eof; 
-        } else {
-            c = *c_++;
-            if (c == '\n') {
-                lines_.push_back(addr_+1);
-            }
-        }
         addr_++;
-        return c;
+        if (c_ == e_) {
+            return eof;
+        }
+        return (unsigned char)*c_++;
     }
 
     void sungetc(char_type c) {
         if (c != eof) {
             addr_--;
-            unget_ = c;
+            c_--;
+        }
+    }
+
+    // [s, current position)
+    symbol_type view(const char* s) {
+        return symbol_type(s, c_ - s);
+    }
+
+    // sAhX̕\(G[̂ݕKvȂ̂Œxč)
+    void make_lines() {
+        if (!lines_.empty()) { return; }
+        lines_.push_back(0);
+        for (const char* p = b_ ; p != e_ ; ++p) {
+            if (*p == '\n') {
+                lines_.push_back(int(p - b_) + 1);
+            }
         }
     }
 
@@ -229,10 +262,9 @@ private:
     }
 
 private:
-    It              b_;
-    It              e_;
-    It              c_;
-    char_type       unget_;
+    const char*     b_;
+    const char*     e_;
+    const char*     c_;
     int             addr_;
 
     typedef std::unordered_map<std::string, Token> dirdic_type;
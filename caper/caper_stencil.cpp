@@ -1,52 +1,108 @@
 // 2014/03/21 Naoyuki Hirayama
 
 #include <iostream>
-#include <sstream>
-#include <cassert>
-#include <exception>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 #include "caper_stencil.hpp"
 #include "caper_format.hpp"
 
+namespace {
+
+struct segment {
+    const char*         text;   // literal text before the slot
+    size_t              length;
+    std::string         name;   // slot name, empty after the last slot
+    mutable const char* key;    // name pointer of the binding last bound
+    mutable size_t      index;  // and its position
+
+    segment(const char* t, size_t l, const std::string& n)
+        : text(t), length(l), name(n), key(nullptr), index(0) {}
+};
+
+typedef std::vector<segment> compiled_template;
+
+const compiled_template& compile(const char* t) {
+    // per thread, generators may run concurrently
+    static thread_local std::unordered_map<const char*, compiled_template> cache;
+
+    auto i = cache.find(t);
+    if (i != cache.end()) {
+        return (*i).second;
+    }
+
+    compiled_template& segments = cache[t];
+    const char* p = t;
+    if (*p == '\n') {
+        p++;
+    }
+    const char* b = p;
+    for (;;) {
+        while (*p != '\0' && *p != '$') {
+            p++;
+        }
+        if (*p == '\0') {
+            segments.push_back(segment(b, p - b, ""));
+            break;
+        }
+
+        const char* e = p++;
+        bool chomp = false;
+        if (*p == '$') {
+            chomp = true;
+            p++;
+        }
+        if (*p != '{') {
+            cache.erase(t);
+            throw std::runtime_error(
+                format("stencil: unexpected char: %c", *p));
+        }
+        const char* n = ++p;
+        while (*p != '\0' && *p != '}') {
+            p++;
+        }
+        if (*p == '\0') {
+            cache.erase(t);
+            throw std::runtime_error("stencil: unterminated template parameter");
+        }
+        segments.push_back(segment(b, e - b, std::string(n, p)));
+        p++;
+        if (chomp && *p != '\0') {
+            p++;
+        }
+        b = p;
+    }
+    return segments;
+}
+
+} // unnamed namespace
+
 void stencil_output(
     std::ostream& os,
     const char* t,
-    const std::map<std::string, StencilCallback>& m) {
+    const StencilBinding* const* bindings,
+    size_t n) {
 
-    std::stringstream ss(t);
-    int c = ss.get();
-    if (c != '\n') {
-        ss.unget();
-    }
-    
-    while((c = ss.get()) != std::char_traits<char>::eof()) {
-        if (c == '$') {
-            bool chomp = false;
-            c = ss.get();
-            if (c == '$') {
-                chomp = true;
-                c = ss.get();
-            }
-            if (c != '{') {
-                throw std::runtime_error(
-                    format("stencil: unexpected char: %c", char(c)));
-            }
-            assert(c == '{');
-            std::stringstream k;
-            while ((c = ss.get()) != '}') {
-                k << char(c);
+    for (const auto& x: compile(t)) {
+        os.write(x.text, x.length);
+        if (x.name.empty()) {
+            continue;
+        }
+
+        // same call site as last time: the binding is at the same position
+        if (!(x.index < n && bindings[x.index]->name == x.key)) {
+            size_t i = 0;
+            while (i < n && x.name != bindings[i]->name) {
+                i++;
             }
-            auto f = m.find(k.str());
-            if (f == m.end()) {
+            if (i == n) {
                 throw std::runtime_error(
-                    "undefined template parameter: " + k.str());
-            }
-            (*f).second(os);
-            if (chomp) {
-                ss.get();
+                    "undefined template parameter: " + x.name);
             }
-        } else {
-            os << char(c);
+            x.key = bindings[i]->name;
+            x.index = i;
         }
+        bindings[x.index]->callback(os);
     }
 }
 
@@ -11,100 +11,104 @@
 #define CAPER_STENCIL_HPP_
 
 #include <iostream>
-#include <functional>
+#include <cstring>
 #include <string>
-#include <map>
 
+////////////////////////////////////////////////////////////////
+// StencilCallback
+//   refers to its argument without copying it. bindings are temporaries
+//   of the stencil() call, so everything they refer to outlives them.
 class StencilCallback {
 public:
-    StencilCallback() {}
-    StencilCallback(bool n) {
-        f_ = [=](std::ostream& os){ os << (n ? "true" : "false"); };
+    StencilCallback() : kind_(kind_text), text_(""), length_(0) {}
+    StencilCallback(bool n)
+        : kind_(kind_text), text_(n ? "true" : "false"),
+          length_(n ? 4 : 5) {
     }
-    StencilCallback(int n) {
-        f_ = [=](std::ostream& os){ os << std::to_string(n); };
+    StencilCallback(int n) : kind_(kind_int), int_(n) {}
+    StencilCallback(size_t n) : kind_(kind_size), size_(n) {}
+    StencilCallback(const char* s)
+        : kind_(kind_text), text_(s), length_(strlen(s)) {
     }
-    StencilCallback(size_t n) {
-        f_ = [=](std::ostream& os){ os << std::to_string(n); };
-    }
-    StencilCallback(const char* ss) {
-        std::string s(ss);
-        f_ = [=](std::ostream& os){ os << s; };
-    }
-    StencilCallback(const std::string& s) {
-        f_ = [=](std::ostream& os){ os << s; };
+    StencilCallback(const std::string& s)
+        : kind_(kind_text), text_(s.data()), length_(s.size()) {
     }
     template <class F>
-    StencilCallback(F f) {
-        f_ = f;
+    StencilCallback(const F& f)
+        : kind_(kind_function), function_(&f), invoke_(&invoke<F>) {
     }
 
     void operator()(std::ostream& os) const {
-        f_(os);
+        switch (kind_) {
+            case kind_text:     os.write(text_, length_); break;
+            case kind_int:      os << int_; break;
+            case kind_size:     os << size_; break;
+            case kind_function: invoke_(function_, os); break;
+        }
     }
 
 private:
-    std::function<void (std::ostream&)> f_;
+    template <class F>
+    static void invoke(const void* f, std::ostream& os) {
+        (*static_cast<const F*>(f))(os);
+    }
+
+private:
+    enum { kind_text, kind_int, kind_size, kind_function } kind_;
+    const char* text_ = nullptr;
+    size_t      length_ = 0;
+    int         int_ = 0;
+    size_t      size_ = 0;
+    const void* function_ = nullptr;
+    void        (*invoke_)(const void*, std::ostream&) = nullptr;
     
 };
 
-void stencil_output(
-    std::ostream& os,
-    const char* t,
-    const std::map<std::string, StencilCallback>& m);
-
 struct StencilBinding {
-    std::string     name;
+    const char*     name;
     StencilCallback callback;
 
-    StencilBinding(const std::string& n, StencilCallback cb)
-        : name(n), callback{ cb } {}
+    StencilBinding(const char* n, StencilCallback cb)
+        : name(n), callback(cb) {}
 private:
     StencilBinding& operator=(const StencilBinding&) = delete;
     StencilBinding(const StencilBinding&) = delete;
 };
 
-inline
-void stencil_setup(std::map<std::string, StencilCallback>&) {
-}
-
-template <class ...T>
-void stencil_setup(
-    std::map<std::string, StencilCallback>& m,
-    const StencilBinding& b,
-    T... args) {
-    assert(!b.name.empty());
-    m[b.name] = b.callback;
-    stencil_setup(m, args...);
-}
+////////////////////////////////////////////////////////////////
+// stencil
+//   templates are parsed once per thread (keyed by address, they are
+//   literals) into
+//   text segments and slots. a slot remembers the position of the binding
+//   it was bound to, so later calls from the same site skip the lookup.
+//   ${name} is replaced by the binding, $${name} also eats the newline
+//   after it. a newline at the beginning of the template is dropped.
+void stencil_output(
+    std::ostream& os,
+    const char* t,
+    const StencilBinding* const* bindings,
+    size_t n);
 
 inline
-void stencil(
-    std::ostream& os, const char* t
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_output(os, t, m);
+void stencil(std::ostream& os, const char* t) {
+    stencil_output(os, t, nullptr, 0);
 }
 
 inline
 void stencil(
     std::ostream& os, const char* t,
-    const StencilBinding& b0
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0));
-    stencil_output(os, t, m);
+    const StencilBinding& b0) {
+    const StencilBinding* b[] = { &b0 };
+    stencil_output(os, t, b, 1);
 }
 
 inline
 void stencil(
     std::ostream& os, const char* t,
     const StencilBinding& b0,
-    const StencilBinding& b1
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1));
-    stencil_output(os, t, m);
+    const StencilBinding& b1) {
+    const StencilBinding* b[] = { &b0, &b1 };
+    stencil_output(os, t, b, 2);
 }
 
 inline
@@ -112,11 +116,9 @@ void stencil(
     std::ostream& os, const char* t,
     const StencilBinding& b0,
     const StencilBinding& b1,
-    const StencilBinding& b2
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2));
-    stencil_output(os, t, m);
+    const StencilBinding& b2) {
+    const StencilBinding* b[] = { &b0, &b1, &b2 };
+    stencil_output(os, t, b, 3);
 }
 
 inline
@@ -125,11 +127,9 @@ void stencil(
     const StencilBinding& b0,
     const StencilBinding& b1,
     const StencilBinding& b2,
-    const StencilBinding& b3
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2), std::cref(b3));
-    stencil_output(os, t, m);
+    const StencilBinding& b3) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3 };
+    stencil_output(os, t, b, 4);
 }
 
 inline
@@ -139,12 +139,9 @@ void stencil(
     const StencilBinding& b1,
     const StencilBinding& b2,
     const StencilBinding& b3,
-    const StencilBinding& b4
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4));
-    stencil_output(os, t, m);
+    const StencilBinding& b4) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4 };
+    stencil_output(os, t, b, 5);
 }
 
 inline
@@ -155,12 +152,9 @@ void stencil(
     const StencilBinding& b2,
     const StencilBinding& b3,
     const StencilBinding& b4,
-    const StencilBinding& b5
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5));
-    stencil_output(os, t, m);
+    const StencilBinding& b5) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5 };
+    stencil_output(os, t, b, 6);
 }
 
 inline
@@ -172,13 +166,9 @@ void stencil(
     const StencilBinding& b3,
     const StencilBinding& b4,
     const StencilBinding& b5,
-    const StencilBinding& b6
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5),
-                  std::cref(b6));
-    stencil_output(os, t, m);
+    const StencilBinding& b6) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5, &b6 };
+    stencil_output(os, t, b, 7);
 }
 
 inline
@@ -191,13 +181,9 @@ void stencil(
     const StencilBinding& b4,
     const StencilBinding& b5,
     const StencilBinding& b6,
-    const StencilBinding& b7
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5),
-                  std::cref(b6), std::cref(b7));
-    stencil_output(os, t, m);
+    const StencilBinding& b7) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5, &b6, &b7 };
+    stencil_output(os, t, b, 8);
 }
 
 inline
@@ -211,13 +197,9 @@ void stencil(
     const StencilBinding& b5,
     const StencilBinding& b6,
     const StencilBinding& b7,
-    const StencilBinding& b8
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5),
-                  std::cref(b6), std::cref(b7), std::cref(b8));
-    stencil_output(os, t, m);
+    const StencilBinding& b8) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5, &b6, &b7, &b8 };
+    stencil_output(os, t, b, 9);
 }
 
 inline
@@ -232,14 +214,9 @@ void stencil(
     const StencilBinding& b6,
     const StencilBinding& b7,
     const StencilBinding& b8,
-    const StencilBinding& b9
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5),
-                  std::cref(b6), std::cref(b7), std::cref(b8),
-                  std::cref(b9));
-    stencil_output(os, t, m);
+    const StencilBinding& b9) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5, &b6, &b7, &b8, &b9 };
+    stencil_output(os, t, b, 10);
 }
 
 inline
@@ -255,14 +232,9 @@ void stencil(
     const StencilBinding& b7,
     const StencilBinding& b8,
     const StencilBinding& b9,
-    const StencilBinding& b10
-    ) {
-    std::map<std::string, StencilCallback> m;
-    stencil_setup(m, std::cref(b0), std::cref(b1), std::cref(b2),
-                  std::cref(b3), std::cref(b4), std::cref(b5),
-                  std::cref(b6), std::cref(b7), std::cref(b8),
-                  std::cref(b9), std::cref(b10));
-    stencil_output(os, t, m);
+    const StencilBinding& b10) {
+    const StencilBinding* b[] = { &b0, &b1, &b2, &b3, &b4, &b5, &b6, &b7, &b8, &b9, &b10 };
+    stencil_output(os, t, b, 11);
 }
 
 #endif // CAPER_STENCIL_HPP_
@@ -7,7 +7,12 @@
 struct sr_conflict_reporter {
     typedef tgt::rule rule_type;
 
+    int* count;     // Ƃ͋̐
+
+    sr_conflict_reporter(int* n = nullptr) : count(n) {}
+
     void operator()(const rule_type& x, const rule_type& y) {
+        if (count) { ++*count; }
         std::cerr << "shift/reduce conflict: " << x << " vs " << y
                   << std::endl;
     }
@@ -16,7 +21,12 @@ struct sr_conflict_reporter {
 struct rr_conflict_reporter {
     typedef tgt::rule rule_type;
 
+    int* count;     // Ƃ͋̐
+
+    rr_conflict_reporter(int* n = nullptr) : count(n) {}
+
     void operator()(const rule_type& x, const rule_type& y) {
+        if (count) { ++*count; }
         std::cerr << "reduce/reduce conflict: " << x << " vs " << y
                   << std::endl;
     }
@@ -35,6 +45,7 @@ void collect_informations(
     auto doc = get_node<Document>(ast);
 
     std::string recover_token = "";
+    std::unordered_set<std::string> precedences;    // D揇ʐ錾ς
 
     // 錾
     for(const auto& x: doc->declarations->declarations) {
@@ -46,7 +57,7 @@ void collect_informations(
                     throw duplicated_symbol(tokendecl->range.beg,y->name);
                 }
                 known.insert(y->name);
-                terminal_types[y->name] = Type{y->type.s, Extension::None};
+                terminal_types[y->name] = Type{y->type.s.to_string(), Extension::None};
             }
         }
         if (auto tokenprefixdecl = downcast<TokenPrefixDecl>(x)) {
@@ -87,6 +98,50 @@ void collect_informations(
             // %dont_use_stl錾
             options.dont_use_stl = true;
         }
+        if (auto glrdecl = downcast<GLRDecl>(x)) {
+            // %glr錾
+            options.glr = true;
+        }
+        if (auto snapshotdecl = downcast<SnapshotDecl>(x)) {
+            // %snapshot錾
+            options.snapshot = true;
+        }
+        if (auto syncdecl = downcast<SyncDecl>(x)) {
+            // %sync錾
+            options.sync_symbol = syncdecl->symbol;
+            options.sync_merge = syncdecl->merge;
+            unknown.insert(syncdecl->symbol);
+        }
+        if (auto lexerdecl = downcast<LexerDecl>(x)) {
+            // %lexer錾
+            options.lexer_rules.push_back(
+                LexerRule(lexerdecl->name, lexerdecl->pattern,
+                          lexerdecl->range.beg));
+            if (!lexerdecl->name.empty()) {
+                unknown.insert(lexerdecl->name);
+            }
+        }
+        if (auto splitdecl = downcast<SplitDecl>(x)) {
+            // %split錾
+            options.split_include = splitdecl->include;
+            options.split_value = splitdecl->value_type;
+            options.split_action = splitdecl->semantic_action;
+            options.split_shards = (std::max)(1, splitdecl->shards);
+        }
+        if (auto tabledecl = downcast<TableDecl>(x)) {
+            // %table錾
+            options.table = true;
+        }
+        if (auto precdecl = downcast<PrecedenceDecl>(x)) {
+            // %left/%right/%nonassoc錾
+            for (const auto& y: precdecl->names) {
+                if (0 < precedences.count(y)) {
+                    throw duplicated_symbol(precdecl->range.beg, y);
+                }
+                precedences.insert(y);
+                unknown.insert(y);
+            }
+        }
     }
 
     // K
@@ -95,12 +150,15 @@ void collect_informations(
             throw duplicated_symbol(rule->range.beg, rule->name);
         }
         known.insert(rule->name);
-        nonterminal_types[rule->name] = Type{rule->type.s, Extension::None};
+        nonterminal_types[rule->name] = Type{rule->type.s.to_string(), Extension::None};
 
         for (const auto& choise: rule->choises->choises) {
             for(const auto& term: choise->elements) {
                 unknown.insert(term->item->name);
             }
+            if (!choise->prec.empty()) {
+                unknown.insert(choise->prec);
+            }
         }
     }
 
@@ -263,6 +321,15 @@ void make_target_rule(
         throw duplicated_rule(choise->range.beg, r);
     }
 
+    // %prec
+    if (!choise->prec.empty()) {
+        auto l = finder(terminals, choise->prec);
+        if (!l) {
+            throw nonterminal_precedence(choise->range.beg, choise->prec);
+        }
+        r.set_precedence(g.get_precedence((*l).token()));
+    }
+
     if (!choise->action_name.empty()) {
         SemanticAction sa(choise->action_name, false);
         for (int k = 0 ; k <= max_index ; k++) {
@@ -274,11 +341,324 @@ void make_target_rule(
     g << r;
 }
 
+////////////////////////////////////////////////////////////////
+// simplify_grammar
+//   ӖςȂ@̊Ȗ
+//   1. IłȂL܂ދKƁAœBs\ɂȂK
+//   2. KЂƂŃZ}eBbNANV̂ȂI[LWJ
+//      (gpӏЂƂK̂ƂBlɂȂӏƂA
+//       D揇ʂG[񕜂̈ʒuςƂAEBNF̋KɌ
+//       Ƃ͓WJȂ)
+//   3. ^ƋK(ANV܂)I[LЂƂɂ܂Ƃ߂
+struct SimplifyStats {
+    int removed = 0;    // K
+    int inlined = 0;    // WJI[L
+    int merged  = 0;    // ܂Ƃ߂I[L
+};
+
+struct conflict_counter {
+    typedef tgt::rule rule_type;
+
+    int* count;
+
+    void operator()(const rule_type&, const rule_type&) {
+        ++*count;
+    }
+};
+
+// rulẻEӂnaměꂼtoŒuK
+tgt::rule substitute_symbol(
+    const tgt::grammar&                 g,
+    const tgt::rule&                    rule,
+    const std::string&                  name,
+    const tgt::rule::elements_type&     to) {
+    tgt::rule r(rule.left());
+    for (const auto& x: rule.right()) {
+        if (x.is_nonterminal() && x.name() == name) {
+            for (const auto& y: to) { r << y; }
+        } else {
+            r << x;
+        }
+    }
+    r.set_precedence(g.get_precedence(rule));
+    return r;
+}
+
+// uKɃANVڂÄʒu炷
+void move_action(
+    action_map_type&                    actions,
+    const tgt::rule&                    from,
+    const tgt::rule&                    to,
+    const std::string&                  name,
+    size_t                              length) {
+    auto i = actions.find(from);
+    if (i == actions.end()) { return; }
+
+    std::vector<int> position;
+    int n = 0;
+    for (const auto& x: from.right()) {
+        position.push_back(n);
+        n += x.is_nonterminal() && x.name() == name ? int(length) : 1;
+    }
+
+    SemanticAction sa = (*i).second;
+    for (auto& arg: sa.args) {
+        arg.source_index = position[arg.source_index];
+    }
+    for (auto& k: sa.source_indices) {
+        k = position[k];
+    }
+    actions.erase(i);
+    actions[to] = sa;
+}
+
+bool simplify_grammar(
+    tgt::grammar&                       g,
+    action_map_type&                    actions,
+    const std::map<std::string, Type>&  nonterminal_types,
+    const std::set<std::string>&        pinned,
+    int                                 error_token,
+    SimplifyStats&                      stats) {
+    std::vector<tgt::rule> rules(g.begin(), g.end()); // 0 = root
+    std::vector<bool> live(rules.size(), true);
+    const std::string root = rules[0].left().name();
+
+    auto rules_of_live = [&]() {
+        std::map<std::string, std::vector<size_t>> m;
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            if (live[i]) { m[rules[i].left().name()].push_back(i); }
+        }
+        return m;
+    };
+
+    // 1. IȔI[L
+    //   KƂɖm̋L𐔂A0ɂȂ獶ӂm肷
+    {
+        std::map<std::string, std::vector<size_t>> users;
+        std::vector<int> pending(rules.size());
+        std::set<std::string> productive;
+        std::vector<std::string> work;
+        auto produce = [&](size_t i) {
+            if (productive.insert(rules[i].left().name()).second) {
+                work.push_back(rules[i].left().name());
+            }
+        };
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            for (const auto& x: rules[i].right()) {
+                if (!x.is_nonterminal()) { continue; }
+                pending[i]++;
+                users[x.name()].push_back(i);
+            }
+            if (pending[i] == 0) { produce(i); }
+        }
+        while (!work.empty()) {
+            std::string n = work.back();
+            work.pop_back();
+            for (size_t i: users[n]) {
+                if (--pending[i] == 0) { produce(i); }
+            }
+        }
+        if (productive.count(root) == 0) {
+            // 󌾌͂̂܂
+            return false;
+        }
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            if (pending[i] != 0) {
+                live[i] = false;
+                stats.removed++;
+            }
+        }
+    }
+
+    // ...B\ȔI[L
+    {
+        auto rules_of = rules_of_live();
+        std::set<std::string> reached { root };
+        std::vector<std::string> work { root };
+        while (!work.empty()) {
+            std::string n = work.back();
+            work.pop_back();
+            for (size_t i: rules_of[n]) {
+                for (const auto& x: rules[i].right()) {
+                    if (x.is_nonterminal() && reached.insert(x.name()).second) {
+                        work.push_back(x.name());
+                    }
+                }
+            }
+        }
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            if (live[i] && reached.count(rules[i].left().name()) == 0) {
+                live[i] = false;
+                stats.removed++;
+            }
+        }
+    }
+
+    // namětoŒu
+    //   ̋KƏdȂƂ͉Ȃ
+    auto replace = [&](const std::string& name,
+                       const tgt::rule::elements_type& to,
+                       bool keep_arguments) -> bool {
+        std::set<tgt::rule> others;
+        std::vector<std::pair<size_t, tgt::rule>> rewrites;
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            if (!live[i] || rules[i].left().name() == name) { continue; }
+
+            std::vector<int> positions;
+            for (size_t k = 0 ; k < rules[i].right().size() ; k++) {
+                const auto& x = rules[i].right()[k];
+                if (x.is_nonterminal() && x.name() == name) {
+                    positions.push_back(int(k));
+                }
+            }
+            if (positions.empty()) {
+                others.insert(rules[i]);
+                continue;
+            }
+
+            if (auto l = finder(actions, rules[i])) {
+                // EBNF̓ANV͉Eӂ̒܂Ă
+                if ((*l).special) { return false; }
+            }
+            if (!keep_arguments) {
+                if (auto l = finder(actions, rules[i])) {
+                    for (int k: positions) {
+                        const auto& v = (*l).source_indices;
+                        if (std::find(v.begin(), v.end(), k) != v.end()) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            rewrites.push_back(
+                std::make_pair(i, substitute_symbol(g, rules[i], name, to)));
+        }
+        for (const auto& x: rewrites) {
+            if (!others.insert(x.second).second) { return false; }
+        }
+
+        for (const auto& x: rewrites) {
+            move_action(actions, rules[x.first], x.second, name, to.size());
+            rules[x.first] = x.second;
+        }
+        for (size_t i = 0 ; i < rules.size() ; i++) {
+            if (live[i] && rules[i].left().name() == name) { live[i] = false; }
+        }
+        return true;
+    };
+
+    bool iterate = true;
+    while (iterate) {
+        iterate = false;
+
+        auto rules_of = rules_of_live();
+        std::map<std::string, int> uses;
+        for (const auto& p: rules_of) {
+            for (size_t i: p.second) {
+                for (const auto& x: rules[i].right()) {
+                    if (x.is_nonterminal()) { uses[x.name()]++; }
+                }
+            }
+        }
+
+        // 2. WJ
+        for (const auto& p: rules_of) {
+            const std::string& name = p.first;
+            if (name == root || 0 < pinned.count(name)) { continue; }
+            if (p.second.size() != 1) { continue; }
+
+            const tgt::rule& rule = rules[p.second[0]];
+            if (0 < actions.count(rule)) { continue; }
+            if (0 < rule.get_precedence().level) { continue; }
+            if (uses[name] != 1 && !rule.right().empty()) { continue; }
+
+            bool ok = true;
+            for (const auto& x: rule.right()) {
+                if (x.is_nonterminal() && x.name() == name) { ok = false; }
+                if (x.is_terminal() &&
+                    (x.token() == error_token ||
+                     0 < g.get_precedence(x.token()).level)) {
+                    ok = false;
+                }
+            }
+            if (ok && replace(name, tgt::rule::elements_type(rule.right()),
+                              false)) {
+                stats.inlined++;
+                iterate = true;
+                break;
+            }
+        }
+        if (iterate) { continue; }
+
+        // 3. ܂Ƃ߂
+        std::map<std::string, std::string> first_of_key;
+        for (const auto& p: rules_of) {
+            const std::string& name = p.first;
+            if (name == root || 0 < pinned.count(name)) { continue; }
+
+            const Type& type = *finder(nonterminal_types, name);
+            std::set<std::string> shapes;
+            for (size_t i: p.second) {
+                std::stringstream ss;
+                for (const auto& x: rules[i].right()) {
+                    if (x.is_terminal()) {
+                        ss << "t" << x.token() << " ";
+                    } else {
+                        ss << "n" << x.name() << " ";
+                    }
+                }
+                zw::gr::precedence prec = g.get_precedence(rules[i]);
+                ss << "/" << prec.level << "/" << int(prec.assoc);
+                if (auto l = finder(actions, rules[i])) {
+                    const SemanticAction& sa = *l;
+                    ss << "/" << sa.name << "/" << sa.special;
+                    for (const auto& arg: sa.args) {
+                        ss << "/" << arg.source_index << ":"
+                           << arg.type.name << ":" << int(arg.type.extension);
+                    }
+                }
+                shapes.insert(ss.str());
+            }
+            std::stringstream key;
+            key << type.name << ":" << int(type.extension);
+            for (const auto& x: shapes) { key << "|" << x; }
+
+            auto f = first_of_key.find(key.str());
+            if (f == first_of_key.end()) {
+                first_of_key[key.str()] = name;
+                continue;
+            }
+            tgt::rule::elements_type to {
+                tgt::symbol(tgt::nonterminal((*f).second)) };
+            if (replace(name, to, true)) {
+                stats.merged++;
+                iterate = true;
+                break;
+            }
+        }
+    }
+
+    if (stats.removed + stats.inlined + stats.merged == 0) {
+        return false;
+    }
+
+    tgt::grammar simplified;
+    for (const auto& x: g.precedences()) {
+        simplified.set_precedence(x.first, x.second);
+    }
+    for (size_t i = 0 ; i < rules.size() ; i++) {
+        if (live[i]) { simplified << rules[i]; }
+    }
+    g = simplified;
+    return true;
+}
+
 void make_target_parser(
     tgt::parsing_table&             table,
     std::map<std::string, size_t>&  token_id_map,
     action_map_type&                actions,
     const value_type&               ast,
+    const GenerateOptions&          options,
     std::map<std::string, Type>&    terminal_types,
     std::map<std::string, Type>&    nonterminal_types) {
 
@@ -316,6 +696,23 @@ void make_target_parser(
 
     // K
     tgt::grammar g;
+
+    // D揇(̐錾قǋ)
+    int level = 0;
+    for (const auto& x: doc->declarations->declarations) {
+        if (auto precdecl = downcast<PrecedenceDecl>(x)) {
+            level++;
+            for (const auto& y: precdecl->names) {
+                auto l = finder(terminals, y);
+                if (!l) {
+                    throw nonterminal_precedence(precdecl->range.beg, y);
+                }
+                g.set_precedence(
+                    (*l).token(), zw::gr::precedence(level, precdecl->assoc));
+            }
+        }
+    }
+
     for (const auto& rule: doc->rules->rules) {
         const tgt::nonterminal& rule_left = nonterminals[rule->name];
         if (g.size() == 0) {
@@ -374,10 +771,61 @@ void make_target_parser(
         }
     }
 
+    // p҂̏Bs\K̓G[
+    zw::gr::check_reachable(g);
+
+    // @̊Ȗ
+    //   ̕@̕\ɍA͂ŕ񍐂B̕@ɂ
+    //   Ȗ񂵂@ɂȂƂȖ񂵂@g
+    //   (̉Ŏ󗝂͂ςȂ悤)
+    int conflicts = 0;
     zw::gr::make_lalr_table(
         table,
         g,
         error_token,
-        sr_conflict_reporter(),
-        rr_conflict_reporter());
+        sr_conflict_reporter(&conflicts),
+        rr_conflict_reporter(&conflicts));
+
+    std::set<std::string> pinned;
+    pinned.insert(g.root_rule().right()[0].name());
+    if (!options.sync_symbol.empty()) {
+        pinned.insert(options.sync_symbol);
+    }
+
+    tgt::grammar simplified = g;
+    action_map_type simplified_actions = actions;
+    SimplifyStats stats;
+    if (options.simplify && conflicts == 0 &&
+        simplify_grammar(simplified, simplified_actions, nonterminal_types,
+                         pinned, error_token, stats)) {
+        tgt::parsing_table simplified_table;
+        zw::gr::make_lalr_table(
+            simplified_table,
+            simplified,
+            error_token,
+            conflict_counter { &conflicts },
+            conflict_counter { &conflicts });
+        if (conflicts == 0) {
+            if (options.stats) {
+                std::cerr << "simplified grammar: "
+                          << stats.removed << " rules removed, "
+                          << stats.inlined << " nonterminals inlined, "
+                          << stats.merged << " nonterminals merged, "
+                          << table.states().size() << " -> "
+                          << simplified_table.states().size() << " states"
+                          << std::endl;
+            }
+            table = simplified_table;
+            actions = simplified_actions;
+        }
+    }
+
+    // ȏԂ̕
+    size_t state_count = table.states().size();
+    zw::gr::minimize_lalr_table(table);
+    if (options.stats) {
+        std::cerr << "minimized table: "
+                  << state_count << " -> " << table.states().size()
+                  << " states" << std::endl;
+    }
 }
@@ -18,6 +18,7 @@ void make_target_parser(
     std::map<std::string, size_t>&  token_id_map,
     action_map_type&                actions,
     const value_type&               ast,
+    const GenerateOptions&          options,
     std::map<std::string, Type>&    terminal_types,
     std::map<std::string, Type>&    nonterminal_types);
 
@@ -1,6 +1,7 @@
 #ifndef CAPER_TOKEN_HPP_
 #define CAPER_TOKEN_HPP_
 
+#include <ostream>
 #include <boost/variant.hpp>
 
 ////////////////////////////////////////////////////////////////
@@ -11,6 +12,7 @@ enum Token {
     token_identifier,
     token_integer,
     token_typetag,
+    token_string,
     token_colon,
     token_semicolon,
     token_pipe,
@@ -32,6 +34,16 @@ enum Token {
     token_directive_access_modifier,
     token_directive_dont_use_stl,
     token_directive_smart_pointer,
+    token_directive_glr,
+    token_directive_snapshot,
+    token_directive_sync,
+    token_directive_lexer,
+    token_directive_split,
+    token_directive_table,
+    token_directive_left,
+    token_directive_right,
+    token_directive_nonassoc,
+    token_directive_prec,
     token_eof,
 };
 
@@ -47,6 +59,7 @@ const char* token_labels(Token op) {
         "IDENT",
         "number",
         "<type>",
+        "\"string\"",
         ":",
         ";",
         "|",
@@ -69,6 +82,16 @@ const char* token_labels(Token op) {
         "%access_modifier",
         "%dont_use_stl",
         "%smart_pointer",
+        "%glr",
+        "%snapshot",
+        "%sync",
+        "%lexer",
+        "%split",
+        "%table",
+        "%left",
+        "%right",
+        "%nonassoc",
+        "%prec",
         "$"
     };
 
@@ -17,6 +17,7 @@
 #include <vector>
 #include <sstream>
 #include <stdexcept>
+#include <functional>
 #include "grammar.hpp"
 #include "lr.hpp"
 
@@ -66,38 +67,33 @@ public:
  *==========================================================================*/
 template <class Token, class Traits>
 void check_reachable(const grammar<Token, Traits>& g) {
-    typedef symbol<Token, Traits>         symbol_type; 
     typedef rule<Token, Traits>           rule_type; 
-    typedef symbol_set<Token, Traits>     symbol_set_type;
 
-    symbol_set_type symbols;
-
-    typedef std::set<rule_type> remains_type;
-    remains_type remains;
-    for (const rule_type& rule: g) {
-        remains.insert(rule);
-    }
-    symbols.insert(symbol_type(g.root_rule().left()));
-
-    bool iterate = true;
-    while (iterate) {
-        iterate = false;
-
-        typedef std::vector<typename std::set<rule_type>::iterator> erased_type;
-        erased_type erased;
-
-        for (auto i = remains.begin(); i != remains.end(); ++i) {
-            const rule_type& rule = *i;
-
-            if (symbols.find(symbol_type(rule.left())) != symbols.end()) {
-                symbols.insert(rule.right().begin(), rule.right().end());
-                erased.push_back(i);
-                iterate = true;
+    // ӁK̎ǂ(eI[L͈x)
+    std::unordered_set<const std::string*> reached;
+    std::vector<const std::string*> work;
+    reached.insert(g.root_rule().left().identity());
+    work.push_back(g.root_rule().left().identity());
+    while (!work.empty()) {
+        const std::string* n = work.back();
+        work.pop_back();
+
+        auto i = g.dictionary().find(n);
+        if (i == g.dictionary().end()) { continue; }
+        for (const rule_type& rule: (*i).second) {
+            for (const auto& x: rule.right()) {
+                if (!x.is_nonterminal()) { continue; }
+                if (reached.insert(x.identity()).second) {
+                    work.push_back(x.identity());
+                }
             }
         }
+    }
 
-        for (const auto& x: erased) {
-            remains.erase(x);
+    std::set<rule_type> remains;
+    for (const rule_type& rule: g) {
+        if (reached.count(rule.left().identity()) == 0) {
+            remains.insert(rule);
         }
     }
 
@@ -345,38 +341,70 @@ make_lalr_table(
 
             // conflictłacceptreducëƂ݂Ȃ
             bool add_action = true;
+            bool conflicted = false;
+
+            action_type new_action;
+            if (x.rule() == g.root_rule()) {
+                // c)[S'SE, $]Ji̗vfȂ΁A
+                // action[i, $]"accept"B
+                new_action = action_type(
+                    action_accept, 0xdeadbeaf, g.root_rule());
+            } else {
+                // b)[AE, a]Ji̗vfłA
+                // ASȂ΁Aaction[i, a]
+                // "reduce A"B
+                new_action = action_type(
+                    action_reduce, 0xdeadbeaf, x.rule());
+            }
 
-            auto k = s.action_table.find(x.lookahead().token());
+            Token token = x.lookahead().token();
+            auto k = s.action_table.find(token);
             if (k != s.action_table.end()) {
                 const rule_type& krule = (*k).second.rule;
+                if ((*k).second.type == action_error) {
+                    // %nonassocŉς
+                    continue;
+                }
                 if ((*k).second.type == action_shift) {
+                    // ɗD揇ʂ΋Ƃ݂͂ȂȂ
+                    //   K/ōȂreduceA
+                    //   Ŕ񌋍ȂerrorAȊOshift
+                    precedence tp = g.get_precedence(token);
+                    precedence rp = g.get_precedence(x.rule());
+                    if (0 < tp.level && 0 < rp.level) {
+                        if (tp.level < rp.level ||
+                            (tp.level == rp.level && tp.assoc == assoc_left)) {
+                            s.action_table[token] = new_action;
+                        } else if (tp.level == rp.level &&
+                                   tp.assoc == assoc_nonassoc) {
+                            s.action_table[token] = action_type(
+                                action_error, 0xdeadbeaf, x.rule());
+                        }
+                        continue;
+                    }
+
                     srr(krule, x.rule());
                     add_action = false; // shiftD
+                    conflicted = true;
                 }
                 if ((*k).second.type == action_reduce &&
                     !(krule == x.rule())) {
                     rrr(krule, x.rule());
                     // ႢD
                     add_action = x.rule().id() < (*k).second.rule.id(); 
+                    conflicted = true;
                 }
             }
 
-            if (!add_action) { continue; }
-
-            if (x.rule() == g.root_rule()) {
-                // c)[S'SE, $]Ji̗vfȂ΁A
-                // action[i, $]"accept"B
+            if (conflicted) {
+                // ̗pȂGLRpɕۑ
+                s.conflict_table[token].push_back(
+                    add_action ? (*k).second : new_action);
+            }
 
-                s.action_table[Traits::eof()] = action_type(
-                    action_accept, 0xdeadbeaf, g.root_rule());
-            } else {
-                // b)[AE, a]Ji̗vfłA
-                // ASȂ΁Aaction[i, a]
-                // "reduce A"B
+            if (!add_action) { continue; }
 
-                s.action_table[x.lookahead().token()] = action_type(
-                    action_reduce, 0xdeadbeaf, x.rule());
-            }                    
+            s.action_table[token] = new_action;
         }
 
         // iɑ΂s֐́A
@@ -416,6 +444,31 @@ make_lalr_table(
         }
     }
 
+    // ̊Ҍ
+    // ł̐ǂ݂ōsҌÂȂǂ݂łsB
+    // G[͊Ҍ̏ԂŌo(x邪Ȃ)B
+    // IȃG[(%nonassoc)͂̂܂܎cB
+    // ׂĂ̓삪̊ҌłԂ͐ǂ݂ɊҌłB
+    // G[Ԃɂ͕tȂB񕜂 error 𓯂Ԃɗ߁A
+    // ǂ݂ŊҌƈӖ삪xsB
+    for (auto& s: table.states()) {
+        if (s.handle_error) { continue; }
+        std::map<int, int> counts;
+        for (const auto& pair: s.action_table) {
+            if (pair.second.type == action_reduce) {
+                counts[int(pair.second.rule.id())]++;
+            }
+        }
+        int n = 0;
+        for (const auto& pair: counts) {
+            if (n < pair.second) {
+                s.default_rule = pair.first;
+                n = pair.second;
+            }
+        }
+        s.consistent = 0 <= s.default_rule &&
+            n == int(s.action_table.size()) && s.conflict_table.empty();
+    }
 }
 
 template <class Token, class Traits>
@@ -432,6 +485,103 @@ make_lalr_table(
         null_reporter<Token, Traits>());
 }
 
+/*============================================================================
+ *
+ * minimize_lalr_table
+ *
+ * ȏԂ̕
+ *
+ *==========================================================================*/
+// jĂA\Es\EG[̗L(s̓lނ܂
+// ܂߂)Ԃ͋ʂłȂBωȂȂ܂ōׂA
+// lނƂɂЂƂ̏Ԃɂ܂Ƃ߂ĔԍU蒼B
+template <class Token, class Traits>
+void minimize_lalr_table(parsing_table<Token, Traits>& table) {
+    typedef symbol<Token, Traits>                       symbol_type;
+    typedef parsing_table<Token, Traits>                parsing_table_type;
+    typedef typename parsing_table_type::state          state_type;
+    typedef typename parsing_table_type::states_type    states_type;
+    typedef typename parsing_table_type::action         action_type;
+    typedef std::pair<std::vector<int>,
+                      std::vector<std::pair<symbol_type, int>>> signature_type;
+
+    const states_type& states = table.states();
+    size_t n = states.size();
+
+    // ̍ו
+    std::vector<int> block(n, 0);
+    size_t count = 1;
+    auto add_action = [&](std::vector<int>& v, const action_type& a) {
+        v.push_back(int(a.type));
+        v.push_back(a.type == action_shift ?
+                    block[a.dest_index] : int(a.rule.id()));
+    };
+    for (;;) {
+        std::map<signature_type, int> ids;
+        std::vector<int> next(n);
+        for (size_t i = 0 ; i < n ; i++) {
+            const state_type& s = states[i];
+
+            signature_type sig;
+            std::vector<int>& v = sig.first;
+            v.push_back(block[i]);
+            v.push_back(s.handle_error ? 1 : 0);
+            for (const auto& pair: s.action_table) {
+                v.push_back(int(pair.first));
+                add_action(v, pair.second);
+            }
+            for (const auto& pair: s.conflict_table) {
+                v.push_back(int(pair.first));
+                v.push_back(int(pair.second.size()));
+                for (const auto& a: pair.second) { add_action(v, a); }
+            }
+            for (const auto& pair: s.goto_table) {
+                sig.second.push_back(
+                    std::make_pair(pair.first, block[pair.second]));
+            }
+
+            next[i] = ids.insert(
+                std::make_pair(sig, int(ids.size()))).first->second;
+        }
+        if (ids.size() == count) { break; }
+        count = ids.size();
+        block.swap(next);
+    }
+    if (count == n) { return; }
+
+    // lނ̍ŏ̏Ԃc
+    std::vector<int> renumber(count, -1);
+    states_type merged;
+    for (size_t i = 0 ; i < n ; i++) {
+        if (0 <= renumber[block[i]]) { continue; }
+        renumber[block[i]] = int(merged.size());
+        merged.push_back(states[i]);
+        merged.back().no = int(merged.size()) - 1;
+    }
+    for (auto& s: merged) {
+        for (auto& pair: s.action_table) {
+            if (pair.second.type == action_shift) {
+                pair.second.dest_index =
+                    renumber[block[pair.second.dest_index]];
+            }
+        }
+        for (auto& pair: s.conflict_table) {
+            for (auto& a: pair.second) {
+                if (a.type == action_shift) {
+                    a.dest_index = renumber[block[a.dest_index]];
+                }
+            }
+        }
+        for (auto& pair: s.goto_table) {
+            pair.second = renumber[block[pair.second]];
+        }
+    }
+
+    int first = renumber[block[table.first_state()]];
+    table.states().swap(merged);
+    table.first_state(first);
+}
+
 /*============================================================================
  *
  * class parser
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <algorithm>
 #include <memory>
+#include <map>
 #include <set>
 #include <unordered_set>
 #include <unordered_map>
@@ -385,6 +386,29 @@ std::ostream& operator<<(std::ostream& os, const symbol<Token, Traits>& r) {
     }
 }
 
+/*============================================================================
+ *
+ * struct precedence
+ *
+ * D揇ʂƌi%left, %right, %nonassocj
+ *
+ *==========================================================================*/
+
+enum associativity {
+    assoc_none,
+    assoc_left,
+    assoc_right,
+    assoc_nonassoc,
+};
+
+struct precedence {
+    int             level = 0;  // 0: 錾ȂA傫قǋ
+    associativity   assoc = assoc_none;
+
+    precedence() {}
+    precedence(int l, associativity a) : level(l), assoc(a) {}
+};
+
 /*============================================================================
  *
  * class rule
@@ -417,11 +441,12 @@ private:
         nonterminal_type    left;
         elements_type       elements;
         size_t              id = size_t(-1);
+        precedence          prec;   // %prec
 
         rule_imp() {}
         rule_imp(const nonterminal_type& n) : left(n) {}
         rule_imp(const rule_imp& r)
-        : left(r.left), elements(r.elements), id(r.id) {}
+        : left(r.left), elements(r.elements), id(r.id), prec(r.prec) {}
     };
 
     typedef std::shared_ptr<rule_imp> imp_ptr;
@@ -450,6 +475,12 @@ public:
 
     size_t id() const { return imp->id; }
 
+    void set_precedence(const precedence& p) {
+        enunique();
+        imp->prec = p;
+    }
+    const precedence& get_precedence() const { return imp->prec; }
+
     const nonterminal< Token, Traits >& left() const  {
         return imp->left;
     }
@@ -538,17 +569,20 @@ public:
 
     typedef std::unordered_map<const std::string*, std::vector<rule_type>>
         dictionary_type;
+    typedef std::map<Token, precedence> precedences_type;
 
 private:
     struct grammar_imp {
-        elements_type   elements;   // 0 = root
-        dictionary_type dictionary;
+        elements_type       elements;   // 0 = root
+        dictionary_type     dictionary;
+        precedences_type    precedences;
 
         grammar_imp() {} 
         grammar_imp(const rule_type& x)
             : elements { x } {}
         grammar_imp(const grammar_imp& x)
-            : elements(x.elements), dictionary(x.dictionary) {}
+            : elements(x.elements), dictionary(x.dictionary),
+              precedences(x.precedences) {}
 
         void add(const rule_type& x) {
             rule_type y(x);
@@ -595,6 +629,31 @@ public:
             imp->elements.end();
     }
 
+    void set_precedence(Token token, const precedence& p) {
+        enunique();
+        imp->precedences[token] = p;
+    }
+
+    const precedences_type& precedences() const { return imp->precedences; }
+
+    precedence get_precedence(Token token) const {
+        auto i = imp->precedences.find(token);
+        if (i == imp->precedences.end()) { return precedence(); }
+        return (*i).second;
+    }
+
+    // K̗D揇
+    //   %precȂΉEӂ̍Ō̏I[L̂
+    precedence get_precedence(const rule_type& rule) const {
+        if (0 < rule.get_precedence().level) {
+            return rule.get_precedence();
+        }
+        for (auto i = rule.right().rbegin() ; i != rule.right().rend() ; ++i) {
+            if ((*i).is_terminal()) { return get_precedence((*i).token()); }
+        }
+        return precedence();
+    }
+
 private:
     void enunique() {
         if (!imp.unique()) { imp = std::make_shared<grammar_imp>(*imp); }
@@ -850,6 +850,7 @@ public:
         typedef std::map<core_type, terminal_set_type>  generate_map_type;
         typedef std::set<std::pair<int, core_type>>     propagate_type;
         typedef std::map<core_type, propagate_type>     propagate_map_type;
+        typedef std::map<Token, std::vector<action>>    conflict_table_type;
 
         int                     no              = -1;
         core_set_type           cores;
@@ -860,7 +861,10 @@ public:
 
         goto_table_type         goto_table;
         action_table_type       action_table;
+        conflict_table_type     conflict_table; // ō̗pȂ
         bool                    handle_error    = false;
+        int                     default_rule    = -1;   // ̊ҌK
+        bool                    consistent      = false;// ǂݕsv
 
         state(int n) : no(n) {}
     };
@@ -0,0 +1,215 @@
+// runtime benchmark harness
+//   each bench_*.cpp defines its SemanticAction and workloads and is
+//   compiled once per grammar variant (-DBENCH_IPP, -DBENCH_GRAMMAR,
+//   -DBENCH_VARIANT), twice:
+//     -DBENCH_PROFILE  parser generated with --profile, prints
+//                      "workload reductions recoveries peak_stack_depth"
+//                      per line, from stats(), without timing
+//     (otherwise)      plain parser, times the workloads and reads the
+//                      lines above from stdin for the counts
+//   output: one JSON object per workload and line.
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef CAPER_VERSION
+#define CAPER_VERSION "unknown"
+#endif
+
+// allocation counter
+//   replaces the global operator new, include from one translation unit
+//   per executable only. the replacements are kept out of line, g++
+//   pairs an inlined std::malloc or std::free with the operator new or
+//   delete call left in the library and warns (-Wmismatched-new-delete).
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace bench {
+
+inline unsigned long& allocations() {
+    static unsigned long count = 0;
+    return count;
+}
+
+} // namespace bench
+
+BENCH_NOINLINE void* operator new(size_t n) {
+    bench::allocations()++;
+    if (void* p = std::malloc(n ? n : 1)) { return p; }
+    throw std::bad_alloc();
+}
+
+BENCH_NOINLINE void* operator new[](size_t n) {
+    bench::allocations()++;
+    if (void* p = std::malloc(n ? n : 1)) { return p; }
+    throw std::bad_alloc();
+}
+
+BENCH_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+BENCH_NOINLINE void operator delete[](void* p) noexcept { std::free(p); }
+BENCH_NOINLINE void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+BENCH_NOINLINE void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+namespace bench {
+
+// deterministic pseudo random numbers (lcg), the same on every platform
+class random {
+public:
+    random() : x_(20140322) {}
+
+    int operator()(int n) {
+        x_ = x_ * 1103515245 + 12345;
+        return int((x_ >> 16) % unsigned(n));
+    }
+
+private:
+    unsigned x_;
+
+};
+
+// token stream, split into sentences
+//   each sentence is parsed by a freshly reset parser, so that input
+//   after a syntax error of a parser without recovery is still used.
+template <class Token, class Value>
+struct workload {
+    std::string                             name;
+    std::vector<std::pair<Token, Value>>    tokens;
+    std::vector<size_t>                     ends;
+
+    explicit workload(const std::string& n) : name(n) {}
+
+    size_t size() const { return tokens.size(); }
+
+    void add(Token token, const Value& value = Value()) {
+        tokens.push_back(std::make_pair(token, value));
+    }
+
+    void end_sentence(Token eof) {
+        add(eof);
+        ends.push_back(tokens.size());
+    }
+};
+
+inline size_t token_count(int argc, char** argv) {
+    if (argc < 2) { return 100000; }
+    return size_t(std::strtod(argv[1], nullptr));
+}
+
+// counts taken by the profiled build
+struct counts {
+    unsigned long   reductions  = 0;
+    unsigned long   recoveries  = 0;
+    unsigned long   max_depth   = 0;
+};
+
+// the counts of workload name from stdin, zero when missing
+inline counts read_counts(const std::string& name) {
+    counts c;
+    char buffer[64];
+    if (std::scanf("%63s %lu %lu %lu", buffer,
+                   &c.reductions, &c.recoveries, &c.max_depth) != 4 ||
+        name != buffer) {
+        return counts();
+    }
+    return c;
+}
+
+// posts the sentences of w, returns the number of tokens posted
+template <class Parser, class Workload>
+size_t parse(Parser& parser, const Workload& w,
+             size_t& accepted, size_t& errors) {
+    size_t posted = 0;
+    size_t b = 0;
+    for (size_t e: w.ends) {
+        parser.reset();
+        for (size_t i = b ; i < e ; i++) {
+            posted++;
+            if (parser.post(w.tokens[i].first, w.tokens[i].second)) {
+                break;
+            }
+        }
+        if (parser.error()) { errors++; } else { accepted++; }
+        b = e;
+    }
+    return posted;
+}
+
+#ifdef BENCH_PROFILE
+
+template <class Parser, class Workload>
+void run(Parser& parser, const Workload& w) {
+    parser.clear_stats();
+
+    size_t accepted = 0;
+    size_t errors = 0;
+    parse(parser, w, accepted, errors);
+
+    const typename Parser::stats_type& stats = parser.stats();
+    unsigned long reductions = 0;
+    for (int i = 0 ; i < Parser::rule_count ; i++) {
+        reductions += stats.reductions[i];
+    }
+
+    std::printf("%s %lu %lu %lu\n", w.name.c_str(), reductions,
+                (unsigned long)stats.recoveries,
+                (unsigned long)stats.max_depth);
+    std::fflush(stdout);
+}
+
+#else
+
+template <class Parser, class Workload>
+void run(Parser& parser, const Workload& w) {
+    size_t accepted = 0;
+    size_t errors = 0;
+
+    unsigned long allocations0 = allocations();
+    auto t0 = std::chrono::steady_clock::now();
+
+    size_t posted = parse(parser, w, accepted, errors);
+
+    auto t1 = std::chrono::steady_clock::now();
+    unsigned long allocations1 = allocations();
+
+    counts c = read_counts(w.name);
+
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+    if (seconds <= 0) { seconds = 1e-9; }
+
+    std::printf(
+        "{\"caper\": \"%s\", \"backend\": \"c++\", "
+        "\"grammar\": \"%s\", \"variant\": \"%s\", \"workload\": \"%s\", "
+        "\"tokens\": %lu, \"sentences\": %lu, \"accepted\": %lu, "
+        "\"errors\": %lu, \"recoveries\": %lu, \"seconds\": %.6f, "
+        "\"tokens_per_sec\": %.0f, \"reductions_per_sec\": %.0f, "
+        "\"peak_stack_depth\": %lu, \"allocations_per_token\": %.4f}\n",
+        CAPER_VERSION, BENCH_GRAMMAR, BENCH_VARIANT, w.name.c_str(),
+        (unsigned long)posted, (unsigned long)w.ends.size(),
+        (unsigned long)accepted, (unsigned long)errors,
+        c.recoveries, seconds,
+        posted / seconds, c.reductions / seconds,
+        c.max_depth,
+        posted ? double(allocations1 - allocations0) / posted : 0.0);
+    std::fflush(stdout);
+}
+
+#endif
+
+} // namespace bench
+
+#endif // BENCH_HPP
@@ -0,0 +1,64 @@
+// calc0, calc1, calc2 workloads
+
+#ifndef BENCH_CALC_HPP
+#define BENCH_CALC_HPP
+
+#include "bench.hpp"
+
+namespace bench {
+
+template <class Value>
+void calc_expression(
+    workload<calc::Token, Value>& w, random& r, size_t length,
+    Value (*number)(int)) {
+    static const calc::Token operators[] = {
+        calc::token_Add, calc::token_Sub, calc::token_Mul, calc::token_Div
+    };
+
+    w.add(calc::token_Number, number(r(100) + 1));
+    for (size_t i = 2 ; i < length ; i += 2) {
+        w.add(operators[r(4)]);
+        w.add(calc::token_Number, number(r(100) + 1));
+    }
+}
+
+// one expression of n tokens
+template <class Value>
+workload<calc::Token, Value> calc_long(size_t n, Value (*number)(int)) {
+    workload<calc::Token, Value> w("long");
+    random r;
+    calc_expression(w, r, n - 1, number);
+    w.end_sentence(calc::token_eof);
+    return w;
+}
+
+// expressions of 3 to 17 tokens
+template <class Value>
+workload<calc::Token, Value> calc_short(size_t n, Value (*number)(int)) {
+    workload<calc::Token, Value> w("short");
+    random r;
+    while (w.size() < n) {
+        calc_expression(w, r, 3 + 2 * r(8), number);
+        w.end_sentence(calc::token_eof);
+    }
+    return w;
+}
+
+// expressions with a doubled operator each
+template <class Value>
+workload<calc::Token, Value> calc_error(size_t n, Value (*number)(int)) {
+    workload<calc::Token, Value> w("error");
+    random r;
+    while (w.size() < n) {
+        calc_expression(w, r, 5, number);
+        w.add(calc::token_Mul);
+        w.add(calc::token_Add);
+        calc_expression(w, r, 5, number);
+        w.end_sentence(calc::token_eof);
+    }
+    return w;
+}
+
+} // namespace bench
+
+#endif // BENCH_CALC_HPP
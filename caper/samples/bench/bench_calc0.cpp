@@ -0,0 +1,32 @@
+// calc0: int values
+
+#include "bench.hpp"
+#include BENCH_IPP
+#include "bench_calc.hpp"
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int Identity(int n) { return n; }
+    int MakeAdd(int x, int y) { return x + y; }
+    int MakeSub(int x, int y) { return x - y; }
+    int MakeMul(int x, int y) { return x * y; }
+    int MakeDiv(int x, int y) { return x / y; }
+};
+
+int number(int n) { return n; }
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    calc::Parser<int, SemanticAction> parser(sa);
+
+    bench::run(parser, bench::calc_long(n, number));
+    bench::run(parser, bench::calc_short(n, number));
+    bench::run(parser, bench::calc_error(n, number));
+    return 0;
+}
@@ -0,0 +1,67 @@
+// calc1: heap allocated nodes
+
+#include "bench.hpp"
+#include "calc1_ast.hpp"
+#include BENCH_IPP
+#include "bench_calc.hpp"
+
+struct SemanticAction {
+    std::vector<Node*> nodes;
+
+    ~SemanticAction() { clear(); }
+
+    void clear() {
+        for (Node* p: nodes) { delete p; }
+        nodes.clear();
+    }
+
+    template <class T>
+    T* keep(T* p) { nodes.push_back(p); return p; }
+
+    void syntax_error() {}
+    void stack_overflow() {}
+
+    template <class T>
+    void downcast(T*& x, Node* y) { x = static_cast<T*>(y); }
+
+    template <class T>
+    void upcast(Node*& x, T* y) { x = y; }
+
+    Expr* MakeExpr(Term* x) { return keep(new TermExpr(x)); }
+    Expr* MakeAdd(Expr* x, Term* y) {
+        return keep(new AddExpr(x, keep(new TermExpr(y))));
+    }
+    Expr* MakeSub(Expr* x, Term* y) {
+        return keep(new SubExpr(x, keep(new TermExpr(y))));
+    }
+    Term* MakeTerm(Number* x) { return keep(new NumberTerm(x)); }
+    Term* MakeMul(Term* x, Number* y) {
+        return keep(new MulTerm(x, keep(new NumberTerm(y))));
+    }
+    Term* MakeDiv(Term* x, Number* y) {
+        return keep(new DivTerm(x, keep(new NumberTerm(y))));
+    }
+};
+
+// numbers are shared by all workloads and created before measuring
+Node* number(int n) {
+    static std::vector<Number> numbers;
+    if (numbers.empty()) {
+        for (int i = 0 ; i <= 100 ; i++) { numbers.push_back(Number(i)); }
+    }
+    return &numbers[n];
+}
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    calc::Parser<Node*, SemanticAction> parser(sa);
+
+    bench::run(parser, bench::calc_long(n, number));
+    sa.clear();
+    bench::run(parser, bench::calc_short(n, number));
+    sa.clear();
+    bench::run(parser, bench::calc_error(n, number));
+    return 0;
+}
@@ -0,0 +1,42 @@
+// calc2: boost::variant values
+
+#include "bench.hpp"
+#include "calc2_ast.hpp"
+
+typedef boost::variant<int, Term, Expr> Value;
+
+#include BENCH_IPP
+#include "bench_calc.hpp"
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+
+    template <class T>
+    void downcast(T& x, Value y) { x = boost::get<T>(y); }
+
+    template <class T>
+    void upcast(Value& x, const T& y) { x = y; }
+
+    Expr MakeExpr(const Term& x) { return Expr(x); }
+    Expr MakeAdd(const Expr& x, const Term& y) { return BinOpExpr<Add>(x, y); }
+    Expr MakeSub(const Expr& x, const Term& y) { return BinOpExpr<Sub>(x, y); }
+    Term MakeTerm(int x) { return Term(x); }
+    Term MakeMul(const Term& x, int y) { return BinOpTerm<Mul>(x, y); }
+    Term MakeDiv(const Term& x, int y) { return BinOpTerm<Div>(x, y); }
+};
+
+Value number(int n) { return n; }
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    calc::Parser<Value, SemanticAction> parser(sa);
+
+    // the actions copy whole subtrees, so one long expression takes
+    // quadratic time; only short expressions are measured
+    bench::run(parser, bench::calc_short(n, number));
+    bench::run(parser, bench::calc_error(n, number));
+    return 0;
+}
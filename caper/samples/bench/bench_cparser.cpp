@@ -0,0 +1,76 @@
+// cparser: synthetic C sources, scanned before measuring
+
+#include "bench.hpp"
+#include "stdafx.h"
+#include "CParserAST.h"
+#include BENCH_IPP
+#include "CScanner.h"
+#include "CParserSite.h"
+
+using namespace cparser;
+
+typedef bench::workload<Token, shared_ptr<Node>> workload_type;
+
+void scan(workload_type& w, const std::string& text) {
+    ParserSite ps;
+    Scanner<std::string::const_iterator, ParserSite> scanner(ps, false);
+
+    std::vector<TokenValue> infos;
+    scanner.scan(infos, text.begin(), text.end());
+    for (const TokenValue& info: infos) {
+        if (info.m_token == eof) { break; }
+        w.add(info.m_token, make_shared<TokenValue>(info));
+    }
+    w.end_sentence(eof);
+}
+
+std::string function(bench::random& r, int index, int depth) {
+    std::string i = std::to_string(index);
+    std::string text =
+        "int f" + i + "(int a, int b) {\n"
+        "    int c = a + b * " + std::to_string(r(100)) + ";\n"
+        "    if (c > 10) { c = c - 1; } else { c = c << 2; }\n"
+        "    while (c < 100) { c += b; }\n"
+        "    return ";
+    for (int j = 0 ; j < depth ; j++) { text += "(a + "; }
+    text += "c";
+    for (int j = 0 ; j < depth ; j++) { text += ")"; }
+    text += ";\n}\n";
+    return text;
+}
+
+// one translation unit of about n tokens
+workload_type unit(const char* name, size_t n, int depth) {
+    workload_type w(name);
+    bench::random r;
+    size_t tokens_per_function = 60 + 4 * depth;
+    std::string text = "typedef unsigned long size_t;\n";
+    for (size_t i = 0 ; i * tokens_per_function < n ; i++) {
+        text += function(r, int(i), depth);
+    }
+    scan(w, text);
+    return w;
+}
+
+// small translation units with a syntax error each
+workload_type errors(size_t n) {
+    workload_type w("error");
+    bench::random r;
+    while (w.size() < n) {
+        std::string i = std::to_string(r(1000));
+        scan(w, "int a" + i + " = 1;\nint b" + i + " = a" + i + " + ;\n");
+    }
+    return w;
+}
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    ParserSite ps;
+    Parser<shared_ptr<Node>, ParserSite> parser(ps);
+
+    bench::run(parser, unit("long", n, 0));
+    bench::run(parser, unit("deep", n, 64));
+    bench::run(parser, errors(n));
+    return 0;
+}
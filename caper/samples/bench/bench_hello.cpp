@@ -0,0 +1,62 @@
+// hello0, hello1 (int values) and hello2 (BENCH_HELLO_STRING)
+
+#include <string>
+
+using std::string;
+
+#include "bench.hpp"
+#include BENCH_IPP
+
+#ifdef BENCH_HELLO_STRING
+typedef std::string value_type;
+#else
+typedef int value_type;
+#endif
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(value_type& x, const value_type& y) { x = y; }
+    void upcast(value_type& x, const value_type& y) { x = y; }
+
+    int Greet() { return 0; }
+    std::string Greet(const std::string& x, const std::string& y) {
+        return x + y;
+    }
+};
+
+typedef bench::workload<hello_world::Token, value_type> workload_type;
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    hello_world::Parser<value_type, SemanticAction> parser(sa);
+
+#ifdef BENCH_HELLO_STRING
+    value_type hello = "Guten Tag, ";
+    value_type world = "Welt";
+#else
+    value_type hello = 0;
+    value_type world = 0;
+#endif
+
+    // "Hello World" sentences
+    workload_type sentences("short");
+    while (sentences.size() < n) {
+        sentences.add(hello_world::token_Hello, hello);
+        sentences.add(hello_world::token_World, world);
+        sentences.end_sentence(hello_world::token_eof);
+    }
+    bench::run(parser, sentences);
+
+    // "World Hello" sentences
+    workload_type errors("error");
+    while (errors.size() < n) {
+        errors.add(hello_world::token_World, world);
+        errors.add(hello_world::token_Hello, hello);
+        errors.end_sentence(hello_world::token_eof);
+    }
+    bench::run(parser, errors);
+    return 0;
+}
@@ -0,0 +1,77 @@
+// list0, list1, list2 (EBNF) and rawlist0, rawlist1, rawlist2
+//   BENCH_LIST_COMMA: items are separated by Comma (list2, rawlist2)
+
+#include "bench.hpp"
+#include BENCH_IPP
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    template <class S>
+    int Document(const S& x) {
+        int n = 0;
+        for (typename S::const_iterator i = x.begin() ; i != x.end() ; ++i) {
+            n += *i;
+        }
+        return n;
+    }
+    int Document(int x) { return x; }
+
+    int MakeList() { return 0; }
+    int MakeList(int x) { return x; }
+    int AddToList(int x, int y) { return x + y; }
+};
+
+typedef bench::workload<list::Token, int> workload_type;
+
+void items(workload_type& w, bench::random& r, size_t length, bool error) {
+    size_t star = error ? r(int(length)) : length;
+
+    w.add(list::token_LParen);
+    for (size_t i = 0 ; i < length ; i++) {
+#ifdef BENCH_LIST_COMMA
+        if (i != 0) { w.add(list::token_Comma); }
+#endif
+        if (i == star) { w.add(list::token_Star); }
+        w.add(list::token_Number, r(100));
+    }
+    w.add(list::token_RParen);
+    w.end_sentence(list::token_eof);
+}
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    list::Parser<int, SemanticAction> parser(sa);
+
+#ifdef BENCH_LIST_COMMA
+    size_t per_item = 2;
+#else
+    size_t per_item = 1;
+#endif
+
+    // one list of n tokens
+    workload_type long_list("long");
+    bench::random r;
+    items(long_list, r, (n - 3) / per_item, false);
+    bench::run(parser, long_list);
+
+    // lists of 1 to 16 items
+    workload_type short_lists("short");
+    while (short_lists.size() < n) {
+        items(short_lists, r, 1 + r(16), false);
+    }
+    bench::run(parser, short_lists);
+
+    // lists with a misplaced Star each
+    workload_type errors("error");
+    while (errors.size() < n) {
+        items(errors, r, 1 + r(16), true);
+    }
+    bench::run(parser, errors);
+    return 0;
+}
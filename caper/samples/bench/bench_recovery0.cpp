@@ -0,0 +1,59 @@
+// recovery0: comma separated lists, "( error )" recovers
+
+#include "bench.hpp"
+#include BENCH_IPP
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int PackList(int x) { return x; }
+    int PackListError() { return -1; }
+    int MakeList(int n) { return n; }
+    int AddToList(int m, int n) { return m + n; }
+};
+
+typedef bench::workload<rec::Token, int> workload_type;
+
+void items(workload_type& w, bench::random& r, size_t length, bool error) {
+    size_t comma = error ? r(int(length)) : length;
+
+    w.add(rec::token_LParen);
+    for (size_t i = 0 ; i < length ; i++) {
+        if (i != 0) { w.add(rec::token_Comma); }
+        if (i == comma) { w.add(rec::token_Comma); }
+        w.add(rec::token_Number, r(100));
+    }
+    w.add(rec::token_RParen);
+    w.end_sentence(rec::token_eof);
+}
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    rec::Parser<int, SemanticAction> parser(sa);
+
+    // one list of n tokens
+    workload_type long_list("long");
+    bench::random r;
+    items(long_list, r, (n - 2) / 2, false);
+    bench::run(parser, long_list);
+
+    // lists of 1 to 16 items
+    workload_type short_lists("short");
+    while (short_lists.size() < n) {
+        items(short_lists, r, 1 + r(16), false);
+    }
+    bench::run(parser, short_lists);
+
+    // lists with a doubled Comma each, recovered by "( error )"
+    workload_type errors("error");
+    while (errors.size() < n) {
+        items(errors, r, 2 + r(15), true);
+    }
+    bench::run(parser, errors);
+    return 0;
+}
@@ -0,0 +1,82 @@
+// recovery1: lines of expressions, "error NewLine" recovers
+
+#include "bench.hpp"
+#include BENCH_IPP
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int DoLine1() { return 0; }
+    int DoLine2(int exp) { return exp; }
+    int DoLine3() { return -1; }
+
+    int DoAddExp1(int exp1) { return exp1; }
+    int DoAddExp2(int exp1, int exp2) { return exp1 + exp2; }
+    int DoAddExp3(int exp1, int exp2) { return exp1 - exp2; }
+
+    int DoMulExp1(int exp1) { return exp1; }
+    int DoMulExp2(int exp1, int exp2) { return exp1 * exp2; }
+    int DoMulExp3(int exp1, int exp2) { return exp1 / (exp2 ? exp2 : 1); }
+
+    int DoUnaryExp1(int exp1) { return exp1; }
+    int DoUnaryExp2(int exp1) { return -exp1; }
+
+    int DoPrimExp1(int num1) { return num1; }
+    int DoPrimExp2(int exp1) { return exp1; }
+};
+
+typedef bench::workload<calc::Token, int> workload_type;
+
+void expression(workload_type& w, bench::random& r, int depth) {
+    static const calc::Token operators[] = {
+        calc::token_Plus, calc::token_Minus, calc::token_Star, calc::token_Slash
+    };
+
+    for (int i = 0 ; i < 3 ; i++) {
+        if (i != 0) { w.add(operators[r(4)]); }
+        if (0 < depth && i == 1) {
+            w.add(calc::token_LParen);
+            expression(w, r, depth - 1);
+            w.add(calc::token_RParen);
+        } else if (r(4) == 0) {
+            w.add(calc::token_Minus);
+            w.add(calc::token_Number, r(100));
+        } else {
+            w.add(calc::token_Number, r(100));
+        }
+    }
+}
+
+// one input of lines with nesting depth up to max_depth
+//   error: every line contains a doubled operator
+workload_type lines(
+    const char* name, size_t n, int max_depth, bool error) {
+    workload_type w(name);
+    bench::random r;
+    while (w.size() < n) {
+        expression(w, r, max_depth ? r(max_depth + 1) : 0);
+        if (error) {
+            w.add(calc::token_Star);
+            w.add(calc::token_Star);
+            w.add(calc::token_Number, r(100));
+        }
+        w.add(calc::token_NewLine);
+    }
+    w.end_sentence(calc::token_eof);
+    return w;
+}
+
+int main(int argc, char** argv) {
+    size_t n = bench::token_count(argc, argv);
+
+    SemanticAction sa;
+    calc::Parser<int, SemanticAction> parser(sa);
+
+    bench::run(parser, lines("long", n, 2, false));
+    bench::run(parser, lines("deep", n, 128, false));
+    bench::run(parser, lines("error", n, 2, true));
+    return 0;
+}
@@ -0,0 +1,810 @@
+#ifndef CALC1_RAW_PROF_IPP_
+#define CALC1_RAW_PROF_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+
+#ifndef CAPER_PROFILE
+#define CAPER_PROFILE 1
+#endif
+#ifndef CAPER_TRACE_SIZE
+#define CAPER_TRACE_SIZE 0
+#endif
+
+namespace calc {
+
+enum Token {
+    token_eof,
+    token_Add,
+    token_Div,
+    token_Mul,
+    token_Number,
+    token_Sub,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_Add",
+        "token_Div",
+        "token_Mul",
+        "token_Number",
+        "token_Sub",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { top_ = 0; gap_ = 0; tmp_ = 0; }
+    ~Stack() {}
+
+    void rollback_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        tmp_ = 0;
+        gap_ = top_;
+    }
+
+    void commit_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            if (gap_ + i <top_) {
+                at(gap_ + i) = at(StackSize - 1 - i);
+            } else {
+                new (&at(gap_ + i)) T(at(StackSize - 1 - i));
+            }
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        if (gap_ + tmp_ <top_) {
+            for (int i = 0 ; i <int(top_ - gap_ - tmp_); i++) {
+                at(top_ - 1 - i).~T(); // explicit destructor
+            }
+        }
+
+        top_ = gap_ = gap_ + tmp_;
+        tmp_ = 0;
+    }
+
+    bool push(const T& f) {
+        if (StackSize <= top_ + tmp_) { return false; }
+        new (&at(StackSize - 1 - tmp_++)) T(f);
+        return true;
+    }
+
+    void pop(size_t n) {
+        size_t m = n; if (m > tmp_) { m = tmp_; }
+
+        for (size_t i = 0 ; i <m ; i++) {
+            at(StackSize - tmp_ + i).~T(); // explicit destructor
+        }
+
+        tmp_ -= m;
+        gap_ -= n - m;
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (0 <tmp_) {
+            return at(StackSize - 1 -(tmp_-1));
+        } else {
+            return at(gap_ - 1);
+        }
+    }
+
+    const T& get_arg(size_t base, size_t index) {
+        if (base - index <= tmp_) {
+            return at(StackSize-1 - (tmp_ -(base - index)));
+        } else {
+            return at(gap_ -(base - tmp_) + index);
+        }
+    }
+
+    void clear() {
+        rollback_tmp();
+        for (size_t i = 0 ; i <top_ ; i++) {
+            at(i).~T(); // explicit destructor
+        }
+        top_ = gap_ = tmp_ = 0;
+    }
+
+    bool empty() const {
+        if (0 < tmp_) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+
+    size_t depth() const {
+        return gap_ + tmp_;
+    }
+
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return at(StackSize-1 - (index - gap_));
+        } else {
+            return at(index);
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    T& at(size_t n) {
+        return *(T*)(stack_ + (n * sizeof(T)));
+    }
+
+private:
+    char stack_[ StackSize * sizeof(T) ];
+    size_t top_;
+    size_t gap_;
+    size_t tmp_;
+
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 1024>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_Expr,
+        Nonterminal_Term,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[12][1] = {
+            { 16 },
+            { 35 },
+            { 47 },
+            { 16 },
+            { 47 },
+            { 16 },
+            { 47 },
+            { 47 },
+            { 16 },
+            { 47 },
+            { 16 },
+            { 47 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() {
+        rollback_tmp_stack();
+        return int(stack_top()->entry - entry(0));
+    }
+
+    bool expected(token_type token) {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        profile_depth();
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+public:
+    // profiling
+    //   counters are compiled in when CAPER_PROFILE is nonzero,
+    //   the ring buffer of recent events when CAPER_TRACE_SIZE is nonzero.
+    enum {
+        state_count = 12,
+        rule_count = 7
+    };
+
+    struct stats_type {
+        unsigned long   shifts[state_count];        // by state
+        unsigned long   reductions[rule_count];     // by rule
+        unsigned long   gotos[state_count];         // by source state
+        unsigned long   recoveries;
+        size_t          max_depth;
+
+        stats_type() { clear(); }
+
+        void clear() {
+            for (int i = 0 ; i < state_count ; i++) {
+                shifts[i] = 0;
+                gotos[i] = 0;
+            }
+            for (int i = 0 ; i < rule_count ; i++) {
+                reductions[i] = 0;
+            }
+            recoveries = 0;
+            max_depth = 0;
+        }
+    };
+
+    enum trace_action {
+        trace_shift,    // target: destination state
+        trace_reduce,   // target: rule
+        trace_accept,
+        trace_error,
+    };
+
+    struct trace_event {
+        int     state;
+        int     token;
+        int     action;
+        int     target;
+    };
+
+    const stats_type& stats() const { return stats_; }
+    void clear_stats() { stats_.clear(); }
+
+    static const char* rule_label(int rule) {
+        static const char* labels[] = {
+            "$implicit_root ::= Expr",
+            "Expr ::= Term",
+            "Expr ::= Expr Add Term",
+            "Expr ::= Expr Sub Term",
+            "Term ::= Number",
+            "Term ::= Term Mul Number",
+            "Term ::= Term Div Number",
+        };
+        return labels[rule];
+    }
+
+    // copies up to n recent events (oldest first), returns the count
+    size_t trace(trace_event* events, size_t n) const {
+#if CAPER_TRACE_SIZE
+        size_t count = trace_.count;
+        if (CAPER_TRACE_SIZE < count) { count = CAPER_TRACE_SIZE; }
+        if (n < count) { count = n; }
+        for (size_t i = 0 ; i < count ; i++) {
+            events[i] = trace_.events[
+                (trace_.count - count + i) % CAPER_TRACE_SIZE];
+        }
+        return count;
+#else
+        (void)events;
+        (void)n;
+        return 0;
+#endif
+    }
+
+private:
+    stats_type stats_;
+#if CAPER_TRACE_SIZE
+    struct trace_buffer {
+        trace_event events[CAPER_TRACE_SIZE];
+        size_t      count;
+
+        trace_buffer() : count(0) {}
+    };
+    trace_buffer trace_;
+#endif
+
+    void profile_trace(int state, token_type token, int action, int target) {
+#if CAPER_TRACE_SIZE
+        trace_event& e = trace_.events[trace_.count++ % CAPER_TRACE_SIZE];
+        e.state = state;
+        e.token = int(token);
+        e.action = action;
+        e.target = target;
+#else
+        (void)state;
+        (void)token;
+        (void)action;
+        (void)target;
+#endif
+    }
+
+    void profile_shift(int state, token_type token, int dest) {
+#if CAPER_PROFILE
+        stats_.shifts[state]++;
+#endif
+        profile_trace(state, token, trace_shift, dest);
+    }
+
+    void profile_reduce(int state, token_type token, int rule) {
+#if CAPER_PROFILE
+        stats_.reductions[rule]++;
+#endif
+        profile_trace(state, token, trace_reduce, rule);
+    }
+
+    void profile_accept(int state, token_type token) {
+        profile_trace(state, token, trace_accept, 0);
+    }
+
+    void profile_error(int state, token_type token) {
+        profile_trace(state, token, trace_error, 0);
+    }
+
+    void profile_goto(int state) {
+#if CAPER_PROFILE
+        stats_.gotos[state]++;
+#else
+        (void)state;
+#endif
+    }
+
+    void profile_recover() {
+#if CAPER_PROFILE
+        stats_.recoveries++;
+#endif
+    }
+
+    void profile_depth() {
+#if CAPER_PROFILE
+        if (stats_.max_depth < stack_.depth()) {
+            stats_.max_depth = stack_.depth();
+        }
+#endif
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_MakeExpr(Nonterminal nonterminal, int base, int arg_index0) {
+        Term* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Expr* r = sa_.MakeExpr(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeAdd(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        Expr* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Term* arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        Expr* r = sa_.MakeAdd(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeSub(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        Expr* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Term* arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        Expr* r = sa_.MakeSub(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeTerm(Nonterminal nonterminal, int base, int arg_index0) {
+        Number* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Term* r = sa_.MakeTerm(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeMul(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        Term* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Number* arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        Term* r = sa_.MakeMul(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeDiv(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        Term* arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        Number* arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        Term* r = sa_.MakeDiv(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            profile_shift(0, token, 7);
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            profile_error(0, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        profile_goto(0);
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 1;
+        case Nonterminal_Term: return 2;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            profile_accept(1, token);
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_Add:
+            // shift
+            profile_shift(1, token, 3);
+            push_stack(/*state*/ 3, value);
+            return false;
+        case token_Sub:
+            // shift
+            profile_shift(1, token, 5);
+            push_stack(/*state*/ 5, value);
+            return false;
+        default:
+            profile_error(1, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        profile_goto(1);
+        assert(0);
+        return true;
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            profile_shift(2, token, 10);
+            push_stack(/*state*/ 10, value);
+            return false;
+        case token_Mul:
+            // shift
+            profile_shift(2, token, 8);
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(2, token, 1);
+            return call_0_MakeExpr(Nonterminal_Expr, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        profile_goto(2);
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            profile_shift(3, token, 7);
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            profile_error(3, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_3(Nonterminal nonterminal) {
+        profile_goto(3);
+        switch(nonterminal) {
+        case Nonterminal_Term: return 4;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            profile_shift(4, token, 10);
+            push_stack(/*state*/ 10, value);
+            return false;
+        case token_Mul:
+            // shift
+            profile_shift(4, token, 8);
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(4, token, 2);
+            return call_0_MakeAdd(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_4(Nonterminal nonterminal) {
+        profile_goto(4);
+        assert(0);
+        return true;
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            profile_shift(5, token, 7);
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            profile_error(5, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_5(Nonterminal nonterminal) {
+        profile_goto(5);
+        switch(nonterminal) {
+        case Nonterminal_Term: return 6;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            profile_shift(6, token, 10);
+            push_stack(/*state*/ 10, value);
+            return false;
+        case token_Mul:
+            // shift
+            profile_shift(6, token, 8);
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(6, token, 3);
+            return call_0_MakeSub(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_6(Nonterminal nonterminal) {
+        profile_goto(6);
+        assert(0);
+        return true;
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(7, token, 4);
+        return call_0_MakeTerm(Nonterminal_Term, /*pop*/ 1, 0);
+    }
+
+    int gotof_7(Nonterminal nonterminal) {
+        profile_goto(7);
+        assert(0);
+        return true;
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            profile_shift(8, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        default:
+            profile_error(8, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_8(Nonterminal nonterminal) {
+        profile_goto(8);
+        assert(0);
+        return true;
+    }
+
+    bool state_9(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(9, token, 5);
+        return call_0_MakeMul(Nonterminal_Term, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_9(Nonterminal nonterminal) {
+        profile_goto(9);
+        assert(0);
+        return true;
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            profile_shift(10, token, 11);
+            push_stack(/*state*/ 11, value);
+            return false;
+        default:
+            profile_error(10, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_10(Nonterminal nonterminal) {
+        profile_goto(10);
+        assert(0);
+        return true;
+    }
+
+    bool state_11(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(11, token, 6);
+        return call_0_MakeDiv(Nonterminal_Term, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_11(Nonterminal nonterminal) {
+        profile_goto(11);
+        assert(0);
+        return true;
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_2, &Parser::gotof_2, false, false },
+            { &Parser::state_3, &Parser::gotof_3, false, false },
+            { &Parser::state_4, &Parser::gotof_4, false, false },
+            { &Parser::state_5, &Parser::gotof_5, false, false },
+            { &Parser::state_6, &Parser::gotof_6, false, false },
+            { &Parser::state_7, &Parser::gotof_7, false, true },
+            { &Parser::state_8, &Parser::gotof_8, false, false },
+            { &Parser::state_9, &Parser::gotof_9, false, true },
+            { &Parser::state_10, &Parser::gotof_10, false, false },
+            { &Parser::state_11, &Parser::gotof_11, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace calc
+
+#endif // #ifndef CALC1_RAW_PROF_IPP_
+
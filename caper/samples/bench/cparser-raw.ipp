@@ -0,0 +1,16877 @@
+#ifndef CPARSER_RAW_IPP_
+#define CPARSER_RAW_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+
+namespace cparser {
+
+enum Token {
+    eof,
+    T_ADD_ASSIGN,
+    T_ALIGNAS,
+    T_ALIGNOF,
+    T_AND,
+    T_AND_ASSIGN,
+    T_ARROW,
+    T_ASM,
+    T_ASSIGN,
+    T_ASTERISK,
+    T_ATOMIC,
+    T_AUTO,
+    T_BITWISE_NOT,
+    T_BOOL,
+    T_BREAK,
+    T_CASE,
+    T_CDECL,
+    T_CHAR,
+    T_COLON,
+    T_COMMA,
+    T_COMPLEX,
+    T_CONST,
+    T_CONSTANT,
+    T_CONTINUE,
+    T_DEC,
+    T_DECLSPEC,
+    T_DEFAULT,
+    T_DIV_ASSIGN,
+    T_DO,
+    T_DOT,
+    T_DOUBLE,
+    T_ELLIPSIS,
+    T_ELSE,
+    T_ENUM,
+    T_EQUAL,
+    T_EXTERN,
+    T_FASTCALL,
+    T_FLOAT,
+    T_FOR,
+    T_FORCEINLINE,
+    T_GE,
+    T_GENERIC,
+    T_GNU_ATTRIBUTE,
+    T_GNU_EXTENSION,
+    T_GOTO,
+    T_GT,
+    T_IDENTIFIER,
+    T_IF,
+    T_IMAGINARY,
+    T_INC,
+    T_INLINE,
+    T_INT,
+    T_INT32,
+    T_INT64,
+    T_LE,
+    T_LONG,
+    T_LT,
+    T_L_AND,
+    T_L_BRACE,
+    T_L_BRACKET,
+    T_L_OR,
+    T_L_PAREN,
+    T_L_SHIFT,
+    T_L_SHIFT_ASSIGN,
+    T_MINUS,
+    T_MOD_ASSIGN,
+    T_MUL_ASSIGN,
+    T_NE,
+    T_NORETURN,
+    T_NOT,
+    T_NOTHROW,
+    T_OR,
+    T_OR_ASSIGN,
+    T_PERCENT,
+    T_PLUS,
+    T_PRAGMA,
+    T_PTR32,
+    T_PTR64,
+    T_QUESTION,
+    T_REGISTER,
+    T_RESTRICT,
+    T_RETURN,
+    T_R_BRACE,
+    T_R_BRACKET,
+    T_R_PAREN,
+    T_R_SHIFT,
+    T_R_SHIFT_ASSIGN,
+    T_SEMICOLON,
+    T_SHORT,
+    T_SIGNED,
+    T_SIZEOF,
+    T_SLASH,
+    T_STATIC,
+    T_STATIC_ASSERT,
+    T_STDCALL,
+    T_STRING,
+    T_STRUCT,
+    T_SUB_ASSIGN,
+    T_SWITCH,
+    T_TAGNAME,
+    T_THREAD_LOCAL,
+    T_TYPEDEF,
+    T_TYPEDEF_NAME,
+    T_TYPEDEF_TAG,
+    T_UNALIGNED,
+    T_UNION,
+    T_UNSIGNED,
+    T_VOID,
+    T_VOLATILE,
+    T_W64,
+    T_WHILE,
+    T_XOR,
+    T_XOR_ASSIGN,
+    T_XSIGNED,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "eof",
+        "T_ADD_ASSIGN",
+        "T_ALIGNAS",
+        "T_ALIGNOF",
+        "T_AND",
+        "T_AND_ASSIGN",
+        "T_ARROW",
+        "T_ASM",
+        "T_ASSIGN",
+        "T_ASTERISK",
+        "T_ATOMIC",
+        "T_AUTO",
+        "T_BITWISE_NOT",
+        "T_BOOL",
+        "T_BREAK",
+        "T_CASE",
+        "T_CDECL",
+        "T_CHAR",
+        "T_COLON",
+        "T_COMMA",
+        "T_COMPLEX",
+        "T_CONST",
+        "T_CONSTANT",
+        "T_CONTINUE",
+        "T_DEC",
+        "T_DECLSPEC",
+        "T_DEFAULT",
+        "T_DIV_ASSIGN",
+        "T_DO",
+        "T_DOT",
+        "T_DOUBLE",
+        "T_ELLIPSIS",
+        "T_ELSE",
+        "T_ENUM",
+        "T_EQUAL",
+        "T_EXTERN",
+        "T_FASTCALL",
+        "T_FLOAT",
+        "T_FOR",
+        "T_FORCEINLINE",
+        "T_GE",
+        "T_GENERIC",
+        "T_GNU_ATTRIBUTE",
+        "T_GNU_EXTENSION",
+        "T_GOTO",
+        "T_GT",
+        "T_IDENTIFIER",
+        "T_IF",
+        "T_IMAGINARY",
+        "T_INC",
+        "T_INLINE",
+        "T_INT",
+        "T_INT32",
+        "T_INT64",
+        "T_LE",
+        "T_LONG",
+        "T_LT",
+        "T_L_AND",
+        "T_L_BRACE",
+        "T_L_BRACKET",
+        "T_L_OR",
+        "T_L_PAREN",
+        "T_L_SHIFT",
+        "T_L_SHIFT_ASSIGN",
+        "T_MINUS",
+        "T_MOD_ASSIGN",
+        "T_MUL_ASSIGN",
+        "T_NE",
+        "T_NORETURN",
+        "T_NOT",
+        "T_NOTHROW",
+        "T_OR",
+        "T_OR_ASSIGN",
+        "T_PERCENT",
+        "T_PLUS",
+        "T_PRAGMA",
+        "T_PTR32",
+        "T_PTR64",
+        "T_QUESTION",
+        "T_REGISTER",
+        "T_RESTRICT",
+        "T_RETURN",
+        "T_R_BRACE",
+        "T_R_BRACKET",
+        "T_R_PAREN",
+        "T_R_SHIFT",
+        "T_R_SHIFT_ASSIGN",
+        "T_SEMICOLON",
+        "T_SHORT",
+        "T_SIGNED",
+        "T_SIZEOF",
+        "T_SLASH",
+        "T_STATIC",
+        "T_STATIC_ASSERT",
+        "T_STDCALL",
+        "T_STRING",
+        "T_STRUCT",
+        "T_SUB_ASSIGN",
+        "T_SWITCH",
+        "T_TAGNAME",
+        "T_THREAD_LOCAL",
+        "T_TYPEDEF",
+        "T_TYPEDEF_NAME",
+        "T_TYPEDEF_TAG",
+        "T_UNALIGNED",
+        "T_UNION",
+        "T_UNSIGNED",
+        "T_VOID",
+        "T_VOLATILE",
+        "T_W64",
+        "T_WHILE",
+        "T_XOR",
+        "T_XOR_ASSIGN",
+        "T_XSIGNED",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { top_ = 0; gap_ = 0; tmp_ = 0; }
+    ~Stack() {}
+
+    void rollback_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        tmp_ = 0;
+        gap_ = top_;
+    }
+
+    void commit_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            if (gap_ + i <top_) {
+                at(gap_ + i) = at(StackSize - 1 - i);
+            } else {
+                new (&at(gap_ + i)) T(at(StackSize - 1 - i));
+            }
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        if (gap_ + tmp_ <top_) {
+            for (int i = 0 ; i <int(top_ - gap_ - tmp_); i++) {
+                at(top_ - 1 - i).~T(); // explicit destructor
+            }
+        }
+
+        top_ = gap_ = gap_ + tmp_;
+        tmp_ = 0;
+    }
+
+    bool push(const T& f) {
+        if (StackSize <= top_ + tmp_) { return false; }
+        new (&at(StackSize - 1 - tmp_++)) T(f);
+        return true;
+    }
+
+    void pop(size_t n) {
+        size_t m = n; if (m > tmp_) { m = tmp_; }
+
+        for (size_t i = 0 ; i <m ; i++) {
+            at(StackSize - tmp_ + i).~T(); // explicit destructor
+        }
+
+        tmp_ -= m;
+        gap_ -= n - m;
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (0 <tmp_) {
+            return at(StackSize - 1 -(tmp_-1));
+        } else {
+            return at(gap_ - 1);
+        }
+    }
+
+    const T& get_arg(size_t base, size_t index) {
+        if (base - index <= tmp_) {
+            return at(StackSize-1 - (tmp_ -(base - index)));
+        } else {
+            return at(gap_ -(base - tmp_) + index);
+        }
+    }
+
+    void clear() {
+        rollback_tmp();
+        for (size_t i = 0 ; i <top_ ; i++) {
+            at(i).~T(); // explicit destructor
+        }
+        top_ = gap_ = tmp_ = 0;
+    }
+
+    bool empty() const {
+        if (0 < tmp_) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+
+    size_t depth() const {
+        return gap_ + tmp_;
+    }
+
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return at(StackSize-1 - (index - gap_));
+        } else {
+            return at(index);
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    T& at(size_t n) {
+        return *(T*)(stack_ + (n * sizeof(T)));
+    }
+
+private:
+    char stack_[ StackSize * sizeof(T) ];
+    size_t top_;
+    size_t gap_;
+    size_t tmp_;
+
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 1024>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_abstract_declarator,
+        Nonterminal_additive_expression,
+        Nonterminal_alignment_specifier,
+        Nonterminal_and_expression,
+        Nonterminal_argument_expression_list,
+        Nonterminal_asm_block,
+        Nonterminal_asm_operand,
+        Nonterminal_asm_operands,
+        Nonterminal_asm_specifier,
+        Nonterminal_assignment_expression,
+        Nonterminal_asterisk_company,
+        Nonterminal_atomic_type_specifier,
+        Nonterminal_cast_expression,
+        Nonterminal_compound_statement,
+        Nonterminal_conditional_expression,
+        Nonterminal_constant_expression,
+        Nonterminal_declaration,
+        Nonterminal_declaration_list,
+        Nonterminal_declaration_specifiers,
+        Nonterminal_declarator,
+        Nonterminal_direct_abstract_declarator,
+        Nonterminal_direct_declarator,
+        Nonterminal_enum_specifier,
+        Nonterminal_enumerator,
+        Nonterminal_enumerator_list,
+        Nonterminal_equality_expression,
+        Nonterminal_exclusive_or_expression,
+        Nonterminal_expression,
+        Nonterminal_expression_statement,
+        Nonterminal_external_declaration,
+        Nonterminal_function_definition,
+        Nonterminal_function_specifier,
+        Nonterminal_generic_assoc_list,
+        Nonterminal_generic_association,
+        Nonterminal_generic_selection,
+        Nonterminal_inclusive_or_expression,
+        Nonterminal_init_declarator,
+        Nonterminal_init_declarator_list,
+        Nonterminal_initializer,
+        Nonterminal_initializer_list,
+        Nonterminal_iteration_statement,
+        Nonterminal_jump_statement,
+        Nonterminal_labeled_statement,
+        Nonterminal_logical_and_expression,
+        Nonterminal_logical_or_expression,
+        Nonterminal_multiplicative_expression,
+        Nonterminal_parameter_declaration,
+        Nonterminal_parameter_list,
+        Nonterminal_parameter_type_list,
+        Nonterminal_pointer,
+        Nonterminal_postfix_expression,
+        Nonterminal_primary_expression,
+        Nonterminal_relational_expression,
+        Nonterminal_selection_statement,
+        Nonterminal_shift_expression,
+        Nonterminal_specifier_qualifier_list,
+        Nonterminal_statement,
+        Nonterminal_statement_list,
+        Nonterminal_static_assert_declaration,
+        Nonterminal_storage_class_specifier,
+        Nonterminal_struct_declaration,
+        Nonterminal_struct_declaration_list,
+        Nonterminal_struct_declarator,
+        Nonterminal_struct_declarator_list,
+        Nonterminal_struct_specifier,
+        Nonterminal_translation_unit,
+        Nonterminal_type_name,
+        Nonterminal_type_qualifier,
+        Nonterminal_type_qualifier_list,
+        Nonterminal_type_specifier,
+        Nonterminal_typedef_declaration_specifiers,
+        Nonterminal_typedef_declarator,
+        Nonterminal_typedef_declarator_list,
+        Nonterminal_typedef_direct_declarator,
+        Nonterminal_unary_expression,
+        Nonterminal_union_specifier,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[512][15] = {
+            { 132, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 0, 2, 0, 0, 0, 64, 0, 32, 0, 0, 128, 0, 0, 1, 0 },
+            { 132, 45, 58, 64, 170, 0, 189, 4, 16, 128, 129, 51, 113, 62, 2 },
+            { 132, 44, 50, 64, 170, 0, 189, 4, 16, 128, 1, 51, 113, 62, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 132, 44, 50, 64, 170, 0, 189, 4, 16, 128, 1, 51, 113, 62, 2 },
+            { 132, 44, 50, 64, 170, 0, 189, 4, 16, 128, 1, 51, 113, 62, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 133, 46, 50, 64, 170, 64, 189, 32, 16, 128, 129, 51, 113, 63, 2 },
+            { 156, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 126, 2 },
+            { 156, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 126, 2 },
+            { 156, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 126, 2 },
+            { 156, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 126, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 3, 65, 62, 2 },
+            { 0, 2, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 0, 2, 0, 0, 0, 64, 0, 32, 0, 0, 128, 0, 0, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 50, 64, 170, 64, 189, 40, 16, 128, 17, 19, 81, 63, 2 },
+            { 4, 44, 50, 64, 170, 0, 189, 0, 16, 128, 17, 19, 81, 62, 2 },
+            { 4, 44, 50, 64, 170, 0, 189, 0, 16, 128, 17, 19, 81, 62, 2 },
+            { 4, 46, 50, 64, 170, 0, 189, 40, 16, 128, 17, 19, 81, 63, 2 },
+            { 4, 44, 50, 64, 170, 0, 189, 0, 16, 128, 17, 19, 81, 62, 2 },
+            { 4, 44, 50, 192, 170, 0, 189, 0, 16, 128, 1, 19, 81, 62, 2 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 38, 50, 64, 34, 0, 185, 32, 0, 0, 1, 3, 193, 63, 2 },
+            { 0, 38, 50, 64, 34, 0, 185, 32, 0, 0, 1, 3, 193, 63, 2 },
+            { 0, 2, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 1, 0 },
+            { 0, 2, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 1, 0 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 3, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 38, 54, 64, 34, 64, 185, 40, 0, 0, 145, 3, 65, 63, 2 },
+            { 0, 38, 54, 64, 34, 64, 185, 40, 0, 0, 145, 3, 65, 63, 2 },
+            { 24, 54, 114, 65, 34, 66, 187, 32, 33, 4, 1, 135, 65, 62, 2 },
+            { 24, 54, 114, 65, 34, 66, 187, 32, 33, 4, 1, 135, 65, 62, 2 },
+            { 24, 54, 114, 65, 34, 66, 187, 32, 33, 4, 1, 135, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 1, 3, 65, 62, 2 },
+            { 0, 36, 50, 68, 34, 0, 185, 0, 0, 0, 1, 3, 65, 62, 2 },
+            { 0, 36, 50, 68, 34, 0, 185, 0, 0, 0, 1, 3, 65, 62, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 0, 32, 0, 0, 0, 0, 36, 0, 0, 1, 0, 0, 16, 0 },
+            { 0, 0, 32, 0, 0, 0, 0, 32, 0, 0, 1, 0, 0, 16, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 8, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 44, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 8, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 44, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 2, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 2, 0, 0, 0, 64, 0, 32, 0, 0, 0, 0, 0, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 1, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 2, 4, 0, 0, 64, 0, 32, 0, 0, 128, 0, 0, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 36, 50, 64, 34, 0, 185, 0, 0, 0, 5, 35, 65, 62, 2 },
+            { 0, 2, 4, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 4, 0, 0, 64, 0, 40, 0, 0, 144, 0, 0, 1, 0 },
+            { 0, 2, 4, 0, 0, 64, 0, 32, 0, 0, 0, 0, 0, 1, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 8, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 44, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 4, 46, 62, 64, 170, 64, 189, 40, 16, 128, 145, 19, 209, 63, 2 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 1, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 2, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 1, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 128, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 2, 0, 0, 0, 64, 0, 32, 0, 0, 0, 0, 0, 1, 0 },
+            { 0, 2, 8, 0, 0, 64, 0, 40, 0, 0, 16, 0, 0, 1, 0 },
+            { 0, 0, 0, 0, 0, 64, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 64, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 8, 132, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 40, 0, 0, 144, 0, 0, 0, 0 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 8, 132, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 132, 45, 62, 64, 170, 0, 189, 44, 16, 128, 145, 51, 113, 62, 2 },
+            { 0, 2, 4, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 1, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 0, 128, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 0, 128, 0, 0 },
+            { 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 48, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 48, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 2, 44, 0, 0, 64, 0, 40, 0, 0, 17, 0, 128, 17, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 4, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 4, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 8, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 8, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 40, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 64, 210, 2, 36, 33, 4, 130, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 224, 8, 2, 128, 1 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 157, 254, 242, 85, 235, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 235, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 235, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 157, 254, 242, 85, 235, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 128, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 128, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 16, 132, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 16, 132, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 128, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 16, 132, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 16, 132, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 128, 132, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 24, 210, 192, 21, 65, 210, 2, 36, 33, 4, 134, 132, 4, 64, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 16, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 16, 0, 64, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 0, 64, 156, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 0, 64, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 128, 0 },
+            { 16, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 0, 0, 0, 18, 128, 64, 156, 0, 0, 128, 0 },
+            { 16, 0, 12, 0, 4, 0, 0, 18, 136, 64, 156, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 0, 0, 18, 136, 64, 156, 0, 0, 128, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 19, 136, 64, 156, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 19, 136, 64, 156, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 19, 136, 64, 156, 0, 0, 128, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 136, 64, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 136, 64, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 136, 64, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 136, 64, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 136, 64, 188, 0, 0, 128, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 137, 68, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 137, 68, 188, 0, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 0, 12, 0, 4, 33, 64, 83, 137, 68, 188, 0, 0, 128, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 16, 2, 12, 0, 4, 33, 64, 83, 137, 70, 188, 8, 0, 128, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 36, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 24, 18, 64, 1, 0, 66, 2, 32, 33, 4, 0, 132, 0, 0, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 50, 3, 12, 8, 4, 33, 64, 211, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 114, 3, 12, 41, 4, 33, 66, 251, 143, 71, 252, 8, 2, 128, 1 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 4, 46, 58, 64, 170, 64, 189, 40, 16, 128, 145, 19, 81, 63, 2 },
+            { 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 128, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 16, 128, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 0, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 4, 128, 0, 0, 0 },
+            { 157, 254, 242, 85, 234, 210, 191, 36, 49, 132, 135, 183, 117, 127, 2 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+            { 0, 0, 12, 0, 0, 64, 0, 40, 0, 0, 20, 128, 0, 0, 0 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() {
+        rollback_tmp_stack();
+        return int(stack_top()->entry - entry(0));
+    }
+
+    bool expected(token_type token) {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_DoTransUnit1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TransUnit> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExtDecl> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TransUnit> r = sa_.DoTransUnit1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTransUnit2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ExtDecl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TransUnit> r = sa_.DoTransUnit2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExtDecl1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Decl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExtDecl> r = sa_.DoExtDecl1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExtDecl2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Decl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExtDecl> r = sa_.DoExtDecl2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExtDecl3(Nonterminal nonterminal, int base) {
+        shared_ptr<ExtDecl> r = sa_.DoExtDecl3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncDef1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2, int arg_index3) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclList> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<CompStmt> arg3; sa_.downcast(arg3, get_arg(base, arg_index3));
+        shared_ptr<Decl> r = sa_.DoFuncDef1(arg0, arg1, arg2, arg3);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncDef2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CompStmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<Decl> r = sa_.DoFuncDef2(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncDef3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CompStmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<Decl> r = sa_.DoFuncDef3(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncDef4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CompStmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoFuncDef4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclList> r = sa_.DoDeclList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Decl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> r = sa_.DoDeclList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoDecl1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoDecl2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoDecl3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<StaticAssertDecl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoDecl4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AsmSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoDecl5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDecl6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AsmBlock> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoDecl6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<StorClsSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<StorClsSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<FuncSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<FuncSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs7(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs7(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs8(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs8(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs9(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AlignSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs9(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclSpecs10(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AlignSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoDeclSpecs10(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclSpecs1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoTypedefDeclSpecs1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclSpecs2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoTypedefDeclSpecs2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclSpecs3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoTypedefDeclSpecs3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclSpecs4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoTypedefDeclSpecs4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStorClsSpec1(Nonterminal nonterminal, int base) {
+        shared_ptr<StorClsSpec> r = sa_.DoStorClsSpec1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStorClsSpec2(Nonterminal nonterminal, int base) {
+        shared_ptr<StorClsSpec> r = sa_.DoStorClsSpec2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStorClsSpec3(Nonterminal nonterminal, int base) {
+        shared_ptr<StorClsSpec> r = sa_.DoStorClsSpec3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStorClsSpec4(Nonterminal nonterminal, int base) {
+        shared_ptr<StorClsSpec> r = sa_.DoStorClsSpec4();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStorClsSpec5(Nonterminal nonterminal, int base) {
+        shared_ptr<StorClsSpec> r = sa_.DoStorClsSpec5();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec1(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec2(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec3(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec4(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec4();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec5(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec5();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec6(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec6();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec7(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec7();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec8(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec8();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec9(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec9();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec10(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec10();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec11(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec11();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec12(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec12();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec13(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec13();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec14(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec14(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec15(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec15(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec16(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec16(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec17(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec17(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec18(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AtomicTypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec18(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec19(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec19();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec20(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec20();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeSpec21(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeSpec> r = sa_.DoTypeSpec21();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAtomicTypeSpec1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AtomicTypeSpec> r = sa_.DoAtomicTypeSpec1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeQual1(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeQual> r = sa_.DoTypeQual1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeQual2(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeQual> r = sa_.DoTypeQual2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeQual3(Nonterminal nonterminal, int base) {
+        shared_ptr<TypeQual> r = sa_.DoTypeQual3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructSpec1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeSpec> r = sa_.DoStructSpec1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructSpec2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeSpec> r = sa_.DoStructSpec2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructSpec3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoStructSpec3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnionSpec1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeSpec> r = sa_.DoUnionSpec1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnionSpec2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoUnionSpec2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnionSpec3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoUnionSpec3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclList> r = sa_.DoStructDeclList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Decl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclList> r = sa_.DoStructDeclList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclorList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclorList> r = sa_.DoTypedefDeclorList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclorList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> r = sa_.DoTypedefDeclorList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInitDeclorList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclorList> r = sa_.DoInitDeclorList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInitDeclorList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> r = sa_.DoInitDeclorList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInitDeclor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Initer> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoInitDeclor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInitDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoInitDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDecl1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoStructDecl1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDecl2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoStructDecl2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDecl3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<StaticAssertDecl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoStructDecl3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSpecQualList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoSpecQualList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSpecQualList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeSpec> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoSpecQualList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSpecQualList3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclSpecs> r = sa_.DoSpecQualList3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSpecQualList4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclSpecs> r = sa_.DoSpecQualList4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclorList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<DeclorList> r = sa_.DoStructDeclorList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclorList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<DeclorList> r = sa_.DoStructDeclorList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoStructDeclor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoStructDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStructDeclor3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoStructDeclor3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumSpec1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<EnumorList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeSpec> r = sa_.DoEnumSpec1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumSpec2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<EnumorList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeSpec> r = sa_.DoEnumSpec2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumSpec3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<EnumorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoEnumSpec3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumSpec4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<EnumorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoEnumSpec4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumSpec5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeSpec> r = sa_.DoEnumSpec5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumorList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<EnumorList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Enumor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<EnumorList> r = sa_.DoEnumorList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumorList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Enumor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<EnumorList> r = sa_.DoEnumorList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Enumor> r = sa_.DoEnumor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEnumor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Enumor> r = sa_.DoEnumor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Pointers> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoTypedefDeclor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoTypedefDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Pointers> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoDeclor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypedefDirDeclor7(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoTypedefDirDeclor7(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirDeclor1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoDirDeclor3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirDeclor4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoDirDeclor5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirDeclor7(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirDeclor7(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPtr1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<AstCom> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeQualList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Pointers> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<Pointers> r = sa_.DoPtr1(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPtr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AstCom> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeQualList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Pointers> r = sa_.DoPtr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPtr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AstCom> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Pointers> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Pointers> r = sa_.DoPtr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPtr4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AstCom> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Pointers> r = sa_.DoPtr4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAstCom6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AstCom> r = sa_.DoAstCom6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeQualList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeQualList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeQual> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeQualList> r = sa_.DoTypeQualList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeQualList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeQual> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeQualList> r = sa_.DoTypeQualList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamTypeList1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ParamList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> r = sa_.DoParamTypeList1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamTypeList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ParamList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> r = sa_.DoParamTypeList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<ParamList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<ParamList> r = sa_.DoParamList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Decl> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> r = sa_.DoParamList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamDecl1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoParamDecl1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamDecl2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Decl> r = sa_.DoParamDecl2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoParamDecl3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Decl> r = sa_.DoParamDecl3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIniter1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AssignExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Initer> r = sa_.DoIniter1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIniter2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<IniterList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Initer> r = sa_.DoIniter2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIniter3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<IniterList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Initer> r = sa_.DoIniter3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIniterList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<IniterList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Initer> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IniterList> r = sa_.DoIniterList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIniterList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Initer> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<IniterList> r = sa_.DoIniterList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeName1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<TypeName> r = sa_.DoTypeName1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoTypeName2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclSpecs> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TypeName> r = sa_.DoTypeName2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAbsDeclor1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Pointers> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoAbsDeclor1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAbsDeclor2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoAbsDeclor2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAbsDeclor3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Pointers> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoAbsDeclor3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor2(Nonterminal nonterminal, int base) {
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor6(Nonterminal nonterminal, int base) {
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor6();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor7(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor7(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor8(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ParamList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor8(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoDirAbsDeclor9(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Declor> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ParamList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Declor> r = sa_.DoDirAbsDeclor9(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmtList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<StmtList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<StmtList> r = sa_.DoStmtList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmtList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Stmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<StmtList> r = sa_.DoStmtList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<LabeledStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ExprStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CompStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<SelStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<IterStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStmt6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<JumpStmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> r = sa_.DoStmt6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLabeledStmt1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<LabeledStmt> r = sa_.DoLabeledStmt1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLabeledStmt2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<LabeledStmt> r = sa_.DoLabeledStmt2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLabeledStmt3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Stmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<LabeledStmt> r = sa_.DoLabeledStmt3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExprStmt1(Nonterminal nonterminal, int base) {
+        shared_ptr<ExprStmt> r = sa_.DoExprStmt1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExprStmt2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExprStmt> r = sa_.DoExprStmt2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCompStmt1(Nonterminal nonterminal, int base) {
+        shared_ptr<CompStmt> r = sa_.DoCompStmt1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCompStmt2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<DeclList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CompStmt> r = sa_.DoCompStmt2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCompStmt3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<StmtList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CompStmt> r = sa_.DoCompStmt3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCompStmt4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<DeclList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<StmtList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CompStmt> r = sa_.DoCompStmt4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSelStmt1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Stmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<SelStmt> r = sa_.DoSelStmt1(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSelStmt2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<SelStmt> r = sa_.DoSelStmt2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoSelStmt3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<SelStmt> r = sa_.DoSelStmt3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Stmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Stmt> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt6(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Stmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt6(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt7(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Stmt> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt7(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt8(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Stmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt8(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt9(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Stmt> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt9(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoIterStmt10(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2, int arg_index3) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Expr> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<Stmt> arg3; sa_.downcast(arg3, get_arg(base, arg_index3));
+        shared_ptr<IterStmt> r = sa_.DoIterStmt10(arg0, arg1, arg2, arg3);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoJumpStmt1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<JumpStmt> r = sa_.DoJumpStmt1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoJumpStmt2(Nonterminal nonterminal, int base) {
+        shared_ptr<JumpStmt> r = sa_.DoJumpStmt2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoJumpStmt3(Nonterminal nonterminal, int base) {
+        shared_ptr<JumpStmt> r = sa_.DoJumpStmt3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoJumpStmt4(Nonterminal nonterminal, int base) {
+        shared_ptr<JumpStmt> r = sa_.DoJumpStmt4();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoJumpStmt5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<JumpStmt> r = sa_.DoJumpStmt5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AssignExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> r = sa_.DoExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<Expr> r = sa_.DoExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr6(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr6(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr7(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr7(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr8(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr8(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr9(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr9(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr10(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr10(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr11(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr11(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAssignExpr12(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AssignExpr> r = sa_.DoAssignExpr12(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCondExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<LogOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> r = sa_.DoCondExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCondExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1, int arg_index2) {
+        shared_ptr<LogOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<Expr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CondExpr> arg2; sa_.downcast(arg2, get_arg(base, arg_index2));
+        shared_ptr<CondExpr> r = sa_.DoCondExpr2(arg0, arg1, arg2);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoConstExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CondExpr> r = sa_.DoConstExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLogOrExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<LogAndExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<LogOrExpr> r = sa_.DoLogOrExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLogOrExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<LogOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<LogAndExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<LogOrExpr> r = sa_.DoLogOrExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLogAnd1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<InclOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<LogAndExpr> r = sa_.DoLogAnd1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLogAnd2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<LogAndExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<InclOrExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<LogAndExpr> r = sa_.DoLogAnd2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInclOrExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ExclOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<InclOrExpr> r = sa_.DoInclOrExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoInclOrExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<InclOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExclOrExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<InclOrExpr> r = sa_.DoInclOrExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExclOr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AndExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ExclOrExpr> r = sa_.DoExclOr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoExclOr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<ExclOrExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AndExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<ExclOrExpr> r = sa_.DoExclOr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAndExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<EqualExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AndExpr> r = sa_.DoAndExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAndExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AndExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<EqualExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AndExpr> r = sa_.DoAndExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEqualExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<RelExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<EqualExpr> r = sa_.DoEqualExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEqualExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<EqualExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<RelExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<EqualExpr> r = sa_.DoEqualExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoEqualExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<EqualExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<RelExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<EqualExpr> r = sa_.DoEqualExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoRelExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<ShiftExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<RelExpr> r = sa_.DoRelExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoRelExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<RelExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ShiftExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<RelExpr> r = sa_.DoRelExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoRelExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<RelExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ShiftExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<RelExpr> r = sa_.DoRelExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoRelExpr4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<RelExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ShiftExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<RelExpr> r = sa_.DoRelExpr4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoRelExpr5(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<RelExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ShiftExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<RelExpr> r = sa_.DoRelExpr5(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoShiftExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AddExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ShiftExpr> r = sa_.DoShiftExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoShiftExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<ShiftExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AddExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<ShiftExpr> r = sa_.DoShiftExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoShiftExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<ShiftExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AddExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<ShiftExpr> r = sa_.DoShiftExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<MulExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AddExpr> r = sa_.DoAddExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AddExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<MulExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AddExpr> r = sa_.DoAddExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AddExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<MulExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AddExpr> r = sa_.DoAddExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<MulExpr> r = sa_.DoMulExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<MulExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CastExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<MulExpr> r = sa_.DoMulExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<MulExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CastExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<MulExpr> r = sa_.DoMulExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExpr4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<MulExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CastExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<MulExpr> r = sa_.DoMulExpr4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCastExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CastExpr> r = sa_.DoCastExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCastExpr2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<IniterList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CastExpr> r = sa_.DoCastExpr2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCastExpr3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<IniterList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CastExpr> r = sa_.DoCastExpr3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoCastExpr4(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<CastExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<CastExpr> r = sa_.DoCastExpr4(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr7(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr7(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr8(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr8(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr9(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CastExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr9(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr10(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<UnaryExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr10(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr11(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr11(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExpr12(Nonterminal nonterminal, int base) {
+        shared_ptr<UnaryExpr> r = sa_.DoUnaryExpr12();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PrimExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr7(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr7(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPostfixExpr8(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<PostfixExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PostfixExpr> r = sa_.DoPostfixExpr8(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExpr1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PrimExpr> r = sa_.DoPrimExpr1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExpr2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PrimExpr> r = sa_.DoPrimExpr2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExpr3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PrimExpr> r = sa_.DoPrimExpr3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExpr4(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<PrimExpr> r = sa_.DoPrimExpr4(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExpr5(Nonterminal nonterminal, int base) {
+        shared_ptr<PrimExpr> r = sa_.DoPrimExpr5();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoGeneSel1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AssignExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<GeneAssocList> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<GeneSel> r = sa_.DoGeneSel1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoGeneAssocList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<GeneAssocList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<GeneAssoc> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<GeneAssocList> r = sa_.DoGeneAssocList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoGeneAssocList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<GeneAssoc> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<GeneAssocList> r = sa_.DoGeneAssocList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoGeneAssoc1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<GeneAssoc> r = sa_.DoGeneAssoc1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoGeneAssoc2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AssignExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<GeneAssoc> r = sa_.DoGeneAssoc2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoArgExprList1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<ArgExprList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AssignExpr> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<ArgExprList> r = sa_.DoArgExprList1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoArgExprList2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AssignExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<ArgExprList> r = sa_.DoArgExprList2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncSpec1(Nonterminal nonterminal, int base) {
+        shared_ptr<FuncSpec> r = sa_.DoFuncSpec1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncSpec2(Nonterminal nonterminal, int base) {
+        shared_ptr<FuncSpec> r = sa_.DoFuncSpec2();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoFuncSpec3(Nonterminal nonterminal, int base) {
+        shared_ptr<FuncSpec> r = sa_.DoFuncSpec3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAlignSpec1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeName> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AlignSpec> r = sa_.DoAlignSpec1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAlignSpec2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AlignSpec> r = sa_.DoAlignSpec2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoStaticAssertDecl1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<CondExpr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<TokenValue> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<StaticAssertDecl> r = sa_.DoStaticAssertDecl1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmSpec1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<TypeQualList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperands> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AsmSpec> r = sa_.DoAsmSpec1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmSpec2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TypeQualList> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmSpec> r = sa_.DoAsmSpec2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmSpec3(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AsmOperands> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmSpec> r = sa_.DoAsmSpec3(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmSpec4(Nonterminal nonterminal, int base) {
+        shared_ptr<AsmSpec> r = sa_.DoAsmSpec4();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmBlock1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AsmOperands> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmBlock> r = sa_.DoAsmBlock1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperands1(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        shared_ptr<AsmOperands> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperand> arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        shared_ptr<AsmOperands> r = sa_.DoAsmOperands1(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperands2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<AsmOperand> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperands> r = sa_.DoAsmOperands2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand1(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand2(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<TokenValue> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand3(Nonterminal nonterminal, int base) {
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand4(Nonterminal nonterminal, int base) {
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand4();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand5(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand5(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAsmOperand6(Nonterminal nonterminal, int base, int arg_index0) {
+        shared_ptr<Expr> arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        shared_ptr<AsmOperand> r = sa_.DoAsmOperand6(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration: return 5;
+        case Nonterminal_declaration_specifiers: return 7;
+        case Nonterminal_declarator: return 12;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_external_declaration: return 3;
+        case Nonterminal_function_definition: return 4;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_pointer: return 162;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_translation_unit: return 1;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration: return 5;
+        case Nonterminal_declaration_specifiers: return 7;
+        case Nonterminal_declarator: return 12;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_external_declaration: return 2;
+        case Nonterminal_function_definition: return 4;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_pointer: return 162;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTransUnit1(Nonterminal_translation_unit, /*pop*/ 2, 0, 1);
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTransUnit2(Nonterminal_translation_unit, /*pop*/ 1, 0);
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExtDecl1(Nonterminal_external_declaration, /*pop*/ 1, 0);
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExtDecl2(Nonterminal_external_declaration, /*pop*/ 1, 0);
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExtDecl3(Nonterminal_external_declaration, /*pop*/ 1);
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 27, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_7(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 8;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_init_declarator: return 120;
+        case Nonterminal_init_declarator_list: return 25;
+        case Nonterminal_pointer: return 162;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ASSIGN:
+            // shift
+            push_stack(/*state*/ 122, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoInitDeclor2(Nonterminal_init_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_8(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_compound_statement: return 11;
+        case Nonterminal_declaration: return 19;
+        case Nonterminal_declaration_list: return 9;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_9(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_9(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_compound_statement: return 10;
+        case Nonterminal_declaration: return 18;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncDef1(Nonterminal_function_definition, /*pop*/ 4, 0, 1, 2, 3);
+    }
+
+    bool state_11(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncDef2(Nonterminal_function_definition, /*pop*/ 3, 0, 1, 2);
+    }
+
+    int gotof_12(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_compound_statement: return 15;
+        case Nonterminal_declaration: return 19;
+        case Nonterminal_declaration_list: return 13;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_13(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_compound_statement: return 14;
+        case Nonterminal_declaration: return 18;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_14(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncDef3(Nonterminal_function_definition, /*pop*/ 3, 0, 1, 2);
+    }
+
+    bool state_15(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncDef4(Nonterminal_function_definition, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_16(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_BREAK:
+            // shift
+            push_stack(/*state*/ 322, value);
+            return false;
+        case T_CASE:
+            // shift
+            push_stack(/*state*/ 263, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_CONTINUE:
+            // shift
+            push_stack(/*state*/ 320, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 266, value);
+            return false;
+        case T_DO:
+            // shift
+            push_stack(/*state*/ 246, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FOR:
+            // shift
+            push_stack(/*state*/ 294, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_GOTO:
+            // shift
+            push_stack(/*state*/ 317, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 261, value);
+            return false;
+        case T_IF:
+            // shift
+            push_stack(/*state*/ 275, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_RETURN:
+            // shift
+            push_stack(/*state*/ 324, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 271, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 268, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_SWITCH:
+            // shift
+            push_stack(/*state*/ 280, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 284, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_16(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_declaration: return 19;
+        case Nonterminal_declaration_list: return 17;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 238;
+        case Nonterminal_statement_list: return 235;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_unary_expression: return 358;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_17(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASM:
+            // shift
+            push_stack(/*state*/ 100, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_BREAK:
+            // shift
+            push_stack(/*state*/ 322, value);
+            return false;
+        case T_CASE:
+            // shift
+            push_stack(/*state*/ 263, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_CONTINUE:
+            // shift
+            push_stack(/*state*/ 320, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 266, value);
+            return false;
+        case T_DO:
+            // shift
+            push_stack(/*state*/ 246, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FOR:
+            // shift
+            push_stack(/*state*/ 294, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_GOTO:
+            // shift
+            push_stack(/*state*/ 317, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 261, value);
+            return false;
+        case T_IF:
+            // shift
+            push_stack(/*state*/ 275, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_RETURN:
+            // shift
+            push_stack(/*state*/ 324, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 272, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 268, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_SWITCH:
+            // shift
+            push_stack(/*state*/ 280, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 284, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_17(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_asm_block: return 31;
+        case Nonterminal_asm_specifier: return 29;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_declaration: return 18;
+        case Nonterminal_declaration_specifiers: return 24;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 238;
+        case Nonterminal_statement_list: return 236;
+        case Nonterminal_static_assert_declaration: return 28;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_unary_expression: return 358;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_18(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclList1(Nonterminal_declaration_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_19(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclList2(Nonterminal_declaration_list, /*pop*/ 1, 0);
+    }
+
+    bool state_20(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_20(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 49;
+        case Nonterminal_type_specifier: return 48;
+        case Nonterminal_typedef_declaration_specifiers: return 21;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_21(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 156, value);
+            return false;
+        case T_TYPEDEF_TAG:
+            // shift
+            push_stack(/*state*/ 166, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_21(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_pointer: return 157;
+        case Nonterminal_typedef_declarator: return 117;
+        case Nonterminal_typedef_declarator_list: return 22;
+        case Nonterminal_typedef_direct_declarator: return 159;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_22(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 115, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 23, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_23(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl1(Nonterminal_declaration, /*pop*/ 4, 1, 2);
+    }
+
+    int gotof_24(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 121;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_init_declarator: return 120;
+        case Nonterminal_init_declarator_list: return 25;
+        case Nonterminal_pointer: return 162;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_25(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 118, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 26, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_26(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl2(Nonterminal_declaration, /*pop*/ 3, 0, 1);
+    }
+
+    bool state_27(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl3(Nonterminal_declaration, /*pop*/ 2, 0);
+    }
+
+    bool state_28(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl4(Nonterminal_declaration, /*pop*/ 1, 0);
+    }
+
+    bool state_29(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 30, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_30(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl5(Nonterminal_declaration, /*pop*/ 2, 0);
+    }
+
+    bool state_31(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDecl6(Nonterminal_declaration, /*pop*/ 1, 0);
+    }
+
+    bool state_32(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclSpecs2(Nonterminal_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_32(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 43;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_33(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclSpecs4(Nonterminal_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_33(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 44;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_34(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclSpecs6(Nonterminal_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_34(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 45;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_35(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclSpecs8(Nonterminal_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_35(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 46;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_36(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclSpecs10(Nonterminal_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_36(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 47;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_37(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 37, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 229, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_37(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_abstract_declarator: return 219;
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_declarator: return 177;
+        case Nonterminal_direct_abstract_declarator: return 218;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 201;
+        case Nonterminal_parameter_list: return 198;
+        case Nonterminal_parameter_type_list: return 231;
+        case Nonterminal_pointer: return 163;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_38(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 175, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_38(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 201;
+        case Nonterminal_parameter_list: return 198;
+        case Nonterminal_parameter_type_list: return 173;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_39(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 185, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_39(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 201;
+        case Nonterminal_parameter_list: return 198;
+        case Nonterminal_parameter_type_list: return 183;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_40(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 40, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 229, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_40(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_abstract_declarator: return 219;
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_direct_abstract_declarator: return 218;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 201;
+        case Nonterminal_parameter_list: return 198;
+        case Nonterminal_parameter_type_list: return 231;
+        case Nonterminal_pointer: return 216;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_41(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 230, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_41(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 201;
+        case Nonterminal_parameter_list: return 198;
+        case Nonterminal_parameter_type_list: return 233;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_42(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNAS:
+            // shift
+            push_stack(/*state*/ 482, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_AUTO:
+            // shift
+            push_stack(/*state*/ 52, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ELLIPSIS:
+            // shift
+            push_stack(/*state*/ 199, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_EXTERN:
+            // shift
+            push_stack(/*state*/ 53, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_FORCEINLINE:
+            // shift
+            push_stack(/*state*/ 480, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INLINE:
+            // shift
+            push_stack(/*state*/ 479, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_NORETURN:
+            // shift
+            push_stack(/*state*/ 481, value);
+            return false;
+        case T_REGISTER:
+            // shift
+            push_stack(/*state*/ 54, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC:
+            // shift
+            push_stack(/*state*/ 55, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_THREAD_LOCAL:
+            // shift
+            push_stack(/*state*/ 56, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_42(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_alignment_specifier: return 36;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_declaration_specifiers: return 161;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_function_specifier: return 33;
+        case Nonterminal_parameter_declaration: return 200;
+        case Nonterminal_storage_class_specifier: return 32;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 35;
+        case Nonterminal_type_specifier: return 34;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_43(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclSpecs1(Nonterminal_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_44(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclSpecs3(Nonterminal_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_45(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclSpecs5(Nonterminal_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_46(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclSpecs7(Nonterminal_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_47(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDeclSpecs9(Nonterminal_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_48(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoTypedefDeclSpecs3(Nonterminal_typedef_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_48(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 49;
+        case Nonterminal_type_specifier: return 48;
+        case Nonterminal_typedef_declaration_specifiers: return 50;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_49(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoTypedefDeclSpecs4(Nonterminal_typedef_declaration_specifiers, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_49(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 49;
+        case Nonterminal_type_specifier: return 48;
+        case Nonterminal_typedef_declaration_specifiers: return 51;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_50(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDeclSpecs1(Nonterminal_typedef_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_51(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDeclSpecs2(Nonterminal_typedef_declaration_specifiers, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_52(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStorClsSpec1(Nonterminal_storage_class_specifier, /*pop*/ 1);
+    }
+
+    bool state_53(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStorClsSpec2(Nonterminal_storage_class_specifier, /*pop*/ 1);
+    }
+
+    bool state_54(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStorClsSpec3(Nonterminal_storage_class_specifier, /*pop*/ 1);
+    }
+
+    bool state_55(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStorClsSpec4(Nonterminal_storage_class_specifier, /*pop*/ 1);
+    }
+
+    bool state_56(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStorClsSpec5(Nonterminal_storage_class_specifier, /*pop*/ 1);
+    }
+
+    int gotof_57(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 96;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_58(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_58(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 124;
+        case Nonterminal_static_assert_declaration: return 128;
+        case Nonterminal_struct_declaration: return 114;
+        case Nonterminal_struct_declaration_list: return 59;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_59(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 107, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_59(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 124;
+        case Nonterminal_static_assert_declaration: return 128;
+        case Nonterminal_struct_declaration: return 113;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_60(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 124;
+        case Nonterminal_static_assert_declaration: return 128;
+        case Nonterminal_struct_declaration: return 114;
+        case Nonterminal_struct_declaration_list: return 61;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_61(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 108, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_62(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 124;
+        case Nonterminal_static_assert_declaration: return 128;
+        case Nonterminal_struct_declaration: return 114;
+        case Nonterminal_struct_declaration_list: return 63;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_63(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 111, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_64(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 124;
+        case Nonterminal_static_assert_declaration: return 128;
+        case Nonterminal_struct_declaration: return 114;
+        case Nonterminal_struct_declaration_list: return 65;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_65(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 112, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STATIC_ASSERT:
+            // shift
+            push_stack(/*state*/ 487, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_66(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoSpecQualList2(Nonterminal_specifier_qualifier_list, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_66(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 129;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_67(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoSpecQualList4(Nonterminal_specifier_qualifier_list, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_67(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 130;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_68(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_68(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 336;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 429;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_unary_expression: return 358;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_69(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 336;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 446;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_unary_expression: return 358;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_70(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 485;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 483;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_unary_expression: return 428;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_71(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 449;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_72(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ATOMIC:
+            // shift
+            push_stack(/*state*/ 95, value);
+            return false;
+        case T_BOOL:
+            // shift
+            push_stack(/*state*/ 85, value);
+            return false;
+        case T_CHAR:
+            // shift
+            push_stack(/*state*/ 75, value);
+            return false;
+        case T_COMPLEX:
+            // shift
+            push_stack(/*state*/ 92, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 475, value);
+            return false;
+        case T_DOUBLE:
+            // shift
+            push_stack(/*state*/ 82, value);
+            return false;
+        case T_ENUM:
+            // shift
+            push_stack(/*state*/ 139, value);
+            return false;
+        case T_FLOAT:
+            // shift
+            push_stack(/*state*/ 81, value);
+            return false;
+        case T_IMAGINARY:
+            // shift
+            push_stack(/*state*/ 93, value);
+            return false;
+        case T_INT:
+            // shift
+            push_stack(/*state*/ 77, value);
+            return false;
+        case T_INT32:
+            // shift
+            push_stack(/*state*/ 78, value);
+            return false;
+        case T_INT64:
+            // shift
+            push_stack(/*state*/ 79, value);
+            return false;
+        case T_LONG:
+            // shift
+            push_stack(/*state*/ 80, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_SHORT:
+            // shift
+            push_stack(/*state*/ 76, value);
+            return false;
+        case T_SIGNED:
+            // shift
+            push_stack(/*state*/ 83, value);
+            return false;
+        case T_STRUCT:
+            // shift
+            push_stack(/*state*/ 105, value);
+            return false;
+        case T_TYPEDEF_NAME:
+            // shift
+            push_stack(/*state*/ 87, value);
+            return false;
+        case T_UNION:
+            // shift
+            push_stack(/*state*/ 109, value);
+            return false;
+        case T_UNSIGNED:
+            // shift
+            push_stack(/*state*/ 84, value);
+            return false;
+        case T_VOID:
+            // shift
+            push_stack(/*state*/ 74, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        case T_W64:
+            // shift
+            push_stack(/*state*/ 86, value);
+            return false;
+        case T_XSIGNED:
+            // shift
+            push_stack(/*state*/ 94, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_72(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_generic_assoc_list: return 469;
+        case Nonterminal_generic_association: return 472;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 473;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_73(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_atomic_type_specifier: return 91;
+        case Nonterminal_enum_specifier: return 90;
+        case Nonterminal_generic_association: return 471;
+        case Nonterminal_specifier_qualifier_list: return 186;
+        case Nonterminal_struct_specifier: return 88;
+        case Nonterminal_type_name: return 473;
+        case Nonterminal_type_qualifier: return 67;
+        case Nonterminal_type_specifier: return 66;
+        case Nonterminal_union_specifier: return 89;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_74(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec1(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_75(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec2(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_76(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec3(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_77(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec4(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_78(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec5(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_79(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec6(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_80(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec7(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_81(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec8(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_82(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec9(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_83(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec10(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_84(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec11(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_85(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec12(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_86(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec13(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_87(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec14(Nonterminal_type_specifier, /*pop*/ 1, 0);
+    }
+
+    bool state_88(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec15(Nonterminal_type_specifier, /*pop*/ 1, 0);
+    }
+
+    bool state_89(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec16(Nonterminal_type_specifier, /*pop*/ 1, 0);
+    }
+
+    bool state_90(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec17(Nonterminal_type_specifier, /*pop*/ 1, 0);
+    }
+
+    bool state_91(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec18(Nonterminal_type_specifier, /*pop*/ 1, 0);
+    }
+
+    bool state_92(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec19(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_93(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec20(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_94(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeSpec21(Nonterminal_type_specifier, /*pop*/ 1);
+    }
+
+    bool state_95(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 57, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_96(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 97, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_97(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAtomicTypeSpec1(Nonterminal_atomic_type_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_98(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoPtr4(Nonterminal_pointer, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_98(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_pointer: return 188;
+        case Nonterminal_type_qualifier: return 197;
+        case Nonterminal_type_qualifier_list: return 99;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_99(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoPtr2(Nonterminal_pointer, /*pop*/ 2, 0, 1);
+        }
+    }
+
+    int gotof_99(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_pointer: return 187;
+        case Nonterminal_type_qualifier: return 196;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_100(token_type token, const value_type& value) {
+        switch(token) {
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 501, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 497, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_100(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_type_qualifier: return 197;
+        case Nonterminal_type_qualifier_list: return 101;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_101(token_type token, const value_type& value) {
+        switch(token) {
+        case T_CONST:
+            // shift
+            push_stack(/*state*/ 102, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 493, value);
+            return false;
+        case T_RESTRICT:
+            // shift
+            push_stack(/*state*/ 103, value);
+            return false;
+        case T_VOLATILE:
+            // shift
+            push_stack(/*state*/ 104, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_101(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_type_qualifier: return 196;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_102(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeQual1(Nonterminal_type_qualifier, /*pop*/ 1);
+    }
+
+    bool state_103(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeQual2(Nonterminal_type_qualifier, /*pop*/ 1);
+    }
+
+    bool state_104(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeQual3(Nonterminal_type_qualifier, /*pop*/ 1);
+    }
+
+    bool state_105(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 60, value);
+            return false;
+        case T_TAGNAME:
+            // shift
+            push_stack(/*state*/ 106, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_106(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 58, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoStructSpec3(Nonterminal_struct_specifier, /*pop*/ 2, 1);
+        }
+    }
+
+    bool state_107(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructSpec1(Nonterminal_struct_specifier, /*pop*/ 5, 1, 3);
+    }
+
+    bool state_108(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructSpec2(Nonterminal_struct_specifier, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_109(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 64, value);
+            return false;
+        case T_TAGNAME:
+            // shift
+            push_stack(/*state*/ 110, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_110(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 62, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoUnionSpec3(Nonterminal_union_specifier, /*pop*/ 2, 1);
+        }
+    }
+
+    bool state_111(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnionSpec1(Nonterminal_union_specifier, /*pop*/ 5, 1, 3);
+    }
+
+    bool state_112(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnionSpec2(Nonterminal_union_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_113(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclList1(Nonterminal_struct_declaration_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_114(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclList2(Nonterminal_struct_declaration_list, /*pop*/ 1, 0);
+    }
+
+    int gotof_115(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_pointer: return 157;
+        case Nonterminal_typedef_declarator: return 116;
+        case Nonterminal_typedef_direct_declarator: return 159;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_116(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDeclorList1(Nonterminal_typedef_declarator_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_117(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDeclorList2(Nonterminal_typedef_declarator_list, /*pop*/ 1, 0);
+    }
+
+    bool state_118(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_118(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 121;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_init_declarator: return 119;
+        case Nonterminal_pointer: return 162;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_119(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoInitDeclorList1(Nonterminal_init_declarator_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_120(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoInitDeclorList2(Nonterminal_init_declarator_list, /*pop*/ 1, 0);
+    }
+
+    bool state_121(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASSIGN:
+            // shift
+            push_stack(/*state*/ 122, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoInitDeclor2(Nonterminal_init_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_122(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 204, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_122(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 208;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_initializer: return 123;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_123(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoInitDeclor1(Nonterminal_init_declarator, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_124(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 137, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 127, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_124(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 134;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_pointer: return 162;
+        case Nonterminal_struct_declarator: return 133;
+        case Nonterminal_struct_declarator_list: return 125;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_125(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 131, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 126, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_126(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDecl1(Nonterminal_struct_declaration, /*pop*/ 3, 0, 1);
+    }
+
+    bool state_127(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDecl2(Nonterminal_struct_declaration, /*pop*/ 2, 0);
+    }
+
+    bool state_128(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDecl3(Nonterminal_struct_declaration, /*pop*/ 1, 0);
+    }
+
+    bool state_129(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoSpecQualList1(Nonterminal_specifier_qualifier_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_130(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoSpecQualList3(Nonterminal_specifier_qualifier_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_131(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 137, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_131(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 134;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_pointer: return 162;
+        case Nonterminal_struct_declarator: return 132;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_132(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclorList1(Nonterminal_struct_declarator_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_133(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclorList2(Nonterminal_struct_declarator_list, /*pop*/ 1, 0);
+    }
+
+    bool state_134(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 135, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoStructDeclor2(Nonterminal_struct_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_135(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_135(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 136;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_136(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclor1(Nonterminal_struct_declarator, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_137(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 138;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_138(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStructDeclor3(Nonterminal_struct_declarator, /*pop*/ 2, 1);
+    }
+
+    bool state_139(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 146, value);
+            return false;
+        case T_TAGNAME:
+            // shift
+            push_stack(/*state*/ 140, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_140(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 141, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoEnumSpec5(Nonterminal_enum_specifier, /*pop*/ 2, 1);
+        }
+    }
+
+    bool state_141(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 153, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_141(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_enumerator: return 152;
+        case Nonterminal_enumerator_list: return 142;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_142(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 143, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 145, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_143(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 153, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 144, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_143(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_enumerator: return 151;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_144(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumSpec1(Nonterminal_enum_specifier, /*pop*/ 6, 1, 3);
+    }
+
+    bool state_145(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumSpec2(Nonterminal_enum_specifier, /*pop*/ 5, 1, 3);
+    }
+
+    int gotof_146(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_enumerator: return 152;
+        case Nonterminal_enumerator_list: return 147;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_147(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 148, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 150, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_148(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 153, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 149, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_149(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumSpec3(Nonterminal_enum_specifier, /*pop*/ 5, 2);
+    }
+
+    bool state_150(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumSpec4(Nonterminal_enum_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_151(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumorList1(Nonterminal_enumerator_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_152(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumorList2(Nonterminal_enumerator_list, /*pop*/ 1, 0);
+    }
+
+    bool state_153(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASSIGN:
+            // shift
+            push_stack(/*state*/ 154, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoEnumor2(Nonterminal_enumerator, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_154(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 155;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_155(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoEnumor1(Nonterminal_enumerator, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_156(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_pointer: return 157;
+        case Nonterminal_typedef_declarator: return 167;
+        case Nonterminal_typedef_direct_declarator: return 159;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_157(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 156, value);
+            return false;
+        case T_TYPEDEF_TAG:
+            // shift
+            push_stack(/*state*/ 166, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_157(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_typedef_direct_declarator: return 158;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_158(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 169, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 38, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoTypedefDeclor1(Nonterminal_typedef_declarator, /*pop*/ 2, 0, 1);
+        }
+    }
+
+    bool state_159(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 169, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 38, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoTypedefDeclor2(Nonterminal_typedef_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_160(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 177;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_pointer: return 162;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_161(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 37, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoParamDecl3(Nonterminal_parameter_declaration, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_161(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_abstract_declarator: return 203;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_declarator: return 202;
+        case Nonterminal_direct_abstract_declarator: return 218;
+        case Nonterminal_direct_declarator: return 165;
+        case Nonterminal_pointer: return 163;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_162(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 160, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_162(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_direct_declarator: return 164;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_163(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 176, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 37, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAbsDeclor3(Nonterminal_abstract_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_163(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_direct_abstract_declarator: return 217;
+        case Nonterminal_direct_declarator: return 164;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_164(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 179, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 39, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclor1(Nonterminal_declarator, /*pop*/ 2, 0, 1);
+        }
+    }
+
+    bool state_165(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 179, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 39, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoDeclor2(Nonterminal_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_166(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor1(Nonterminal_typedef_direct_declarator, /*pop*/ 1, 0);
+    }
+
+    bool state_167(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 168, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_168(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor2(Nonterminal_typedef_direct_declarator, /*pop*/ 3, 1);
+    }
+
+    bool state_169(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 172, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_169(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 170;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_170(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 171, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_171(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor3(Nonterminal_typedef_direct_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_172(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor4(Nonterminal_typedef_direct_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_173(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 174, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_174(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor5(Nonterminal_typedef_direct_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_175(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypedefDirDeclor7(Nonterminal_typedef_direct_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_176(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor1(Nonterminal_direct_declarator, /*pop*/ 1, 0);
+    }
+
+    bool state_177(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 178, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_178(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor2(Nonterminal_direct_declarator, /*pop*/ 3, 1);
+    }
+
+    bool state_179(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 182, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_179(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 180;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_180(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 181, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_181(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor3(Nonterminal_direct_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_182(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor4(Nonterminal_direct_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_183(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 184, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_184(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor5(Nonterminal_direct_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_185(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirDeclor7(Nonterminal_direct_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_186(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 193, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 40, value);
+            return false;
+        case T_UNALIGNED:
+            // shift
+            push_stack(/*state*/ 189, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoTypeName2(Nonterminal_type_name, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_186(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_abstract_declarator: return 215;
+        case Nonterminal_asterisk_company: return 98;
+        case Nonterminal_direct_abstract_declarator: return 218;
+        case Nonterminal_pointer: return 216;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_187(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPtr1(Nonterminal_pointer, /*pop*/ 3, 0, 1, 2);
+    }
+
+    bool state_188(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPtr3(Nonterminal_pointer, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_189(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 190, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_190(token_type token, const value_type& value) {
+        switch(token) {
+        case T_PTR32:
+            // shift
+            push_stack(/*state*/ 192, value);
+            return false;
+        case T_PTR64:
+            // shift
+            push_stack(/*state*/ 191, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAstCom3(Nonterminal_asterisk_company, /*pop*/ 2, 1);
+        }
+    }
+
+    bool state_191(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAstCom1(Nonterminal_asterisk_company, /*pop*/ 3, 1);
+    }
+
+    bool state_192(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAstCom2(Nonterminal_asterisk_company, /*pop*/ 3, 1);
+    }
+
+    bool state_193(token_type token, const value_type& value) {
+        switch(token) {
+        case T_PTR32:
+            // shift
+            push_stack(/*state*/ 195, value);
+            return false;
+        case T_PTR64:
+            // shift
+            push_stack(/*state*/ 194, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAstCom6(Nonterminal_asterisk_company, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_194(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAstCom4(Nonterminal_asterisk_company, /*pop*/ 2, 0);
+    }
+
+    bool state_195(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAstCom5(Nonterminal_asterisk_company, /*pop*/ 2, 0);
+    }
+
+    bool state_196(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeQualList1(Nonterminal_type_qualifier_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_197(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeQualList2(Nonterminal_type_qualifier_list, /*pop*/ 1, 0);
+    }
+
+    bool state_198(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 42, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoParamTypeList2(Nonterminal_parameter_type_list, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_199(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoParamTypeList1(Nonterminal_parameter_type_list, /*pop*/ 3, 0);
+    }
+
+    bool state_200(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoParamList1(Nonterminal_parameter_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_201(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoParamList2(Nonterminal_parameter_list, /*pop*/ 1, 0);
+    }
+
+    bool state_202(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoParamDecl1(Nonterminal_parameter_declaration, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_203(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoParamDecl2(Nonterminal_parameter_declaration, /*pop*/ 2, 0, 1);
+    }
+
+    int gotof_204(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 208;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_initializer: return 214;
+        case Nonterminal_initializer_list: return 209;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_205(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 204, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 210, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_205(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 208;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_initializer: return 213;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_206(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 208;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_initializer: return 214;
+        case Nonterminal_initializer_list: return 212;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_207(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 204, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 430, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_208(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIniter1(Nonterminal_initializer, /*pop*/ 1, 0);
+    }
+
+    bool state_209(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 205, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 211, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_210(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIniter2(Nonterminal_initializer, /*pop*/ 4, 1);
+    }
+
+    bool state_211(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIniter3(Nonterminal_initializer, /*pop*/ 3, 1);
+    }
+
+    bool state_212(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 207, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 431, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_213(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIniterList1(Nonterminal_initializer_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_214(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIniterList2(Nonterminal_initializer_list, /*pop*/ 1, 0);
+    }
+
+    bool state_215(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoTypeName1(Nonterminal_type_name, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_216(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 221, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 40, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAbsDeclor3(Nonterminal_abstract_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_216(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_direct_abstract_declarator: return 217;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_217(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 223, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 41, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAbsDeclor1(Nonterminal_abstract_declarator, /*pop*/ 2, 0, 1);
+        }
+    }
+
+    bool state_218(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 223, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 41, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAbsDeclor2(Nonterminal_abstract_declarator, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_219(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 220, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_220(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor1(Nonterminal_direct_abstract_declarator, /*pop*/ 3, 1);
+    }
+
+    bool state_221(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 222, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_221(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 225;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_222(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor2(Nonterminal_direct_abstract_declarator, /*pop*/ 2);
+    }
+
+    bool state_223(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 224, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_223(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 227;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_224(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor3(Nonterminal_direct_abstract_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_225(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 226, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_226(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor4(Nonterminal_direct_abstract_declarator, /*pop*/ 3, 1);
+    }
+
+    bool state_227(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 228, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_228(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor5(Nonterminal_direct_abstract_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_229(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor6(Nonterminal_direct_abstract_declarator, /*pop*/ 2);
+    }
+
+    bool state_230(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor7(Nonterminal_direct_abstract_declarator, /*pop*/ 3, 0);
+    }
+
+    bool state_231(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 232, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_232(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor8(Nonterminal_direct_abstract_declarator, /*pop*/ 3, 1);
+    }
+
+    bool state_233(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 234, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_234(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoDirAbsDeclor9(Nonterminal_direct_abstract_declarator, /*pop*/ 4, 0, 2);
+    }
+
+    bool state_235(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BREAK:
+            // shift
+            push_stack(/*state*/ 322, value);
+            return false;
+        case T_CASE:
+            // shift
+            push_stack(/*state*/ 263, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_CONTINUE:
+            // shift
+            push_stack(/*state*/ 320, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 266, value);
+            return false;
+        case T_DO:
+            // shift
+            push_stack(/*state*/ 246, value);
+            return false;
+        case T_FOR:
+            // shift
+            push_stack(/*state*/ 294, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_GOTO:
+            // shift
+            push_stack(/*state*/ 317, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 261, value);
+            return false;
+        case T_IF:
+            // shift
+            push_stack(/*state*/ 275, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_RETURN:
+            // shift
+            push_stack(/*state*/ 324, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 273, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 268, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_SWITCH:
+            // shift
+            push_stack(/*state*/ 280, value);
+            return false;
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 284, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_235(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 237;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_236(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BREAK:
+            // shift
+            push_stack(/*state*/ 322, value);
+            return false;
+        case T_CASE:
+            // shift
+            push_stack(/*state*/ 263, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_CONTINUE:
+            // shift
+            push_stack(/*state*/ 320, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 266, value);
+            return false;
+        case T_DO:
+            // shift
+            push_stack(/*state*/ 246, value);
+            return false;
+        case T_FOR:
+            // shift
+            push_stack(/*state*/ 294, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_GOTO:
+            // shift
+            push_stack(/*state*/ 317, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 261, value);
+            return false;
+        case T_IF:
+            // shift
+            push_stack(/*state*/ 275, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_RETURN:
+            // shift
+            push_stack(/*state*/ 324, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 274, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 268, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_SWITCH:
+            // shift
+            push_stack(/*state*/ 280, value);
+            return false;
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 284, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_237(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmtList1(Nonterminal_statement_list, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_238(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmtList2(Nonterminal_statement_list, /*pop*/ 1, 0);
+    }
+
+    bool state_239(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_BREAK:
+            // shift
+            push_stack(/*state*/ 322, value);
+            return false;
+        case T_CASE:
+            // shift
+            push_stack(/*state*/ 263, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_CONTINUE:
+            // shift
+            push_stack(/*state*/ 320, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_DEFAULT:
+            // shift
+            push_stack(/*state*/ 266, value);
+            return false;
+        case T_DO:
+            // shift
+            push_stack(/*state*/ 246, value);
+            return false;
+        case T_FOR:
+            // shift
+            push_stack(/*state*/ 294, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_GOTO:
+            // shift
+            push_stack(/*state*/ 317, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 261, value);
+            return false;
+        case T_IF:
+            // shift
+            push_stack(/*state*/ 275, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 16, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_RETURN:
+            // shift
+            push_stack(/*state*/ 324, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 268, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        case T_SWITCH:
+            // shift
+            push_stack(/*state*/ 280, value);
+            return false;
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 284, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_239(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 262;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_240(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 265;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_241(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 267;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_242(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 278;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_243(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 279;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_244(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 283;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_245(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 287;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_246(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 288;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_247(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 298;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_248(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 300;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_249(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 303;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_250(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 305;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_251(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 309;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_252(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 311;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_253(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 314;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_254(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_compound_statement: return 257;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 269;
+        case Nonterminal_expression_statement: return 256;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_iteration_statement: return 259;
+        case Nonterminal_jump_statement: return 260;
+        case Nonterminal_labeled_statement: return 255;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_selection_statement: return 258;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_statement: return 316;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_255(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt1(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_256(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt2(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_257(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt3(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_258(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt4(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_259(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt5(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_260(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStmt6(Nonterminal_statement, /*pop*/ 1, 0);
+    }
+
+    bool state_261(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 239, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoPrimExpr1(Nonterminal_primary_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_262(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoLabeledStmt1(Nonterminal_labeled_statement, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_263(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 264;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_264(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 240, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_265(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoLabeledStmt2(Nonterminal_labeled_statement, /*pop*/ 4, 1, 3);
+    }
+
+    bool state_266(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 241, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_267(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoLabeledStmt3(Nonterminal_labeled_statement, /*pop*/ 3, 2);
+    }
+
+    bool state_268(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExprStmt1(Nonterminal_expression_statement, /*pop*/ 1);
+    }
+
+    bool state_269(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 270, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_270(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExprStmt2(Nonterminal_expression_statement, /*pop*/ 2, 0);
+    }
+
+    bool state_271(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCompStmt1(Nonterminal_compound_statement, /*pop*/ 2);
+    }
+
+    bool state_272(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCompStmt2(Nonterminal_compound_statement, /*pop*/ 3, 1);
+    }
+
+    bool state_273(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCompStmt3(Nonterminal_compound_statement, /*pop*/ 3, 1);
+    }
+
+    bool state_274(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCompStmt4(Nonterminal_compound_statement, /*pop*/ 4, 1, 2);
+    }
+
+    bool state_275(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 276, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_276(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 277;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_277(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 242, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_278(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ELSE:
+            // shift
+            push_stack(/*state*/ 243, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoSelStmt2(Nonterminal_selection_statement, /*pop*/ 5, 2, 4);
+        }
+    }
+
+    bool state_279(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoSelStmt1(Nonterminal_selection_statement, /*pop*/ 7, 2, 4, 6);
+    }
+
+    bool state_280(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 281, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_281(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 282;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_282(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 244, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_283(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoSelStmt3(Nonterminal_selection_statement, /*pop*/ 5, 2, 4);
+    }
+
+    bool state_284(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 285, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_285(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 286;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_286(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 245, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_287(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt1(Nonterminal_iteration_statement, /*pop*/ 5, 2, 4);
+    }
+
+    bool state_288(token_type token, const value_type& value) {
+        switch(token) {
+        case T_WHILE:
+            // shift
+            push_stack(/*state*/ 289, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_289(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 290, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_290(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 291;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_291(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 292, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_292(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 293, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_293(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt2(Nonterminal_iteration_statement, /*pop*/ 7, 1, 4);
+    }
+
+    bool state_294(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 295, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_295(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 296, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_295(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 306;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_296(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 297, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_296(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 301;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_297(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 247, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_297(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 299;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_298(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt3(Nonterminal_iteration_statement, /*pop*/ 6, 5);
+    }
+
+    bool state_299(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 248, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_300(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt4(Nonterminal_iteration_statement, /*pop*/ 7, 4, 6);
+    }
+
+    bool state_301(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 302, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_302(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 249, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_302(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 304;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_303(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt5(Nonterminal_iteration_statement, /*pop*/ 7, 3, 6);
+    }
+
+    bool state_304(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 250, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_305(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt6(Nonterminal_iteration_statement, /*pop*/ 8, 3, 5, 7);
+    }
+
+    bool state_306(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 307, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_307(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 308, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_307(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 312;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_308(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 251, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_308(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 310;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_309(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt7(Nonterminal_iteration_statement, /*pop*/ 7, 2, 6);
+    }
+
+    bool state_310(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 252, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_311(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt8(Nonterminal_iteration_statement, /*pop*/ 8, 2, 5, 7);
+    }
+
+    bool state_312(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 313, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_313(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 253, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_313(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 315;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_314(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt9(Nonterminal_iteration_statement, /*pop*/ 8, 2, 4, 7);
+    }
+
+    bool state_315(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 254, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_316(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoIterStmt10(Nonterminal_iteration_statement, /*pop*/ 9, 2, 4, 6, 8);
+    }
+
+    bool state_317(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 318, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_318(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 319, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_319(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoJumpStmt1(Nonterminal_jump_statement, /*pop*/ 3, 1);
+    }
+
+    bool state_320(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 321, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_321(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoJumpStmt2(Nonterminal_jump_statement, /*pop*/ 2);
+    }
+
+    bool state_322(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 323, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_323(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoJumpStmt3(Nonterminal_jump_statement, /*pop*/ 2);
+    }
+
+    bool state_324(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 325, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_324(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 326;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_325(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoJumpStmt4(Nonterminal_jump_statement, /*pop*/ 2);
+    }
+
+    bool state_326(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 327, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_327(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoJumpStmt5(Nonterminal_jump_statement, /*pop*/ 3, 1);
+    }
+
+    int gotof_328(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 334;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_329(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 335;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_330(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 336;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_331(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 337;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_332(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 333;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_expression: return 338;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_333(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExpr1(Nonterminal_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_334(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 370, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_335(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 452, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_336(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 465, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_337(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 510, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_338(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 339, value);
+            return false;
+        case T_R_BRACKET:
+            // shift
+            push_stack(/*state*/ 511, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_339(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 340;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_340(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoExpr2(Nonterminal_expression, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_341(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 359;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_342(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 360;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_343(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 361;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_344(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 362;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_345(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 363;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_346(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 364;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_347(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 365;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_348(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 366;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_349(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 367;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_350(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 368;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_351(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 369;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_352(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 455, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_352(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_argument_expression_list: return 453;
+        case Nonterminal_assignment_expression: return 478;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_353(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 468;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_354(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 474;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_355(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 476;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_356(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_assignment_expression: return 477;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 357;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 358;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_357(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr1(Nonterminal_assignment_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_358(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ADD_ASSIGN:
+            // shift
+            push_stack(/*state*/ 345, value);
+            return false;
+        case T_AND_ASSIGN:
+            // shift
+            push_stack(/*state*/ 349, value);
+            return false;
+        case T_ASSIGN:
+            // shift
+            push_stack(/*state*/ 341, value);
+            return false;
+        case T_DIV_ASSIGN:
+            // shift
+            push_stack(/*state*/ 343, value);
+            return false;
+        case T_L_SHIFT_ASSIGN:
+            // shift
+            push_stack(/*state*/ 347, value);
+            return false;
+        case T_MOD_ASSIGN:
+            // shift
+            push_stack(/*state*/ 344, value);
+            return false;
+        case T_MUL_ASSIGN:
+            // shift
+            push_stack(/*state*/ 342, value);
+            return false;
+        case T_OR_ASSIGN:
+            // shift
+            push_stack(/*state*/ 351, value);
+            return false;
+        case T_R_SHIFT_ASSIGN:
+            // shift
+            push_stack(/*state*/ 348, value);
+            return false;
+        case T_SUB_ASSIGN:
+            // shift
+            push_stack(/*state*/ 346, value);
+            return false;
+        case T_XOR_ASSIGN:
+            // shift
+            push_stack(/*state*/ 350, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoCastExpr1(Nonterminal_cast_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_359(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr2(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_360(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr3(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_361(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr4(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_362(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr5(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_363(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr6(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_364(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr7(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_365(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr8(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_366(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr9(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_367(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr10(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_368(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr11(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_369(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAssignExpr12(Nonterminal_assignment_expression, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_370(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 373;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_371(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_conditional_expression: return 374;
+        case Nonterminal_constant_expression: return 488;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 375;
+        case Nonterminal_logical_or_expression: return 372;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_372(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_OR:
+            // shift
+            push_stack(/*state*/ 376, value);
+            return false;
+        case T_QUESTION:
+            // shift
+            push_stack(/*state*/ 328, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoCondExpr1(Nonterminal_conditional_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_373(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCondExpr2(Nonterminal_conditional_expression, /*pop*/ 5, 0, 2, 4);
+    }
+
+    bool state_374(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoConstExpr1(Nonterminal_constant_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_375(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_AND:
+            // shift
+            push_stack(/*state*/ 379, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoLogOrExpr1(Nonterminal_logical_or_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_376(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 378;
+        case Nonterminal_logical_and_expression: return 377;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_377(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_AND:
+            // shift
+            push_stack(/*state*/ 379, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoLogOrExpr2(Nonterminal_logical_or_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_378(token_type token, const value_type& value) {
+        switch(token) {
+        case T_OR:
+            // shift
+            push_stack(/*state*/ 382, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoLogAnd1(Nonterminal_logical_and_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_379(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 381;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_inclusive_or_expression: return 380;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_380(token_type token, const value_type& value) {
+        switch(token) {
+        case T_OR:
+            // shift
+            push_stack(/*state*/ 382, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoLogAnd2(Nonterminal_logical_and_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_381(token_type token, const value_type& value) {
+        switch(token) {
+        case T_XOR:
+            // shift
+            push_stack(/*state*/ 385, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoInclOrExpr1(Nonterminal_inclusive_or_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_382(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 384;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_exclusive_or_expression: return 383;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_383(token_type token, const value_type& value) {
+        switch(token) {
+        case T_XOR:
+            // shift
+            push_stack(/*state*/ 385, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoInclOrExpr2(Nonterminal_inclusive_or_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_384(token_type token, const value_type& value) {
+        switch(token) {
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 388, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoExclOr1(Nonterminal_exclusive_or_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_385(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_and_expression: return 386;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_equality_expression: return 387;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_386(token_type token, const value_type& value) {
+        switch(token) {
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 388, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoExclOr2(Nonterminal_exclusive_or_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_387(token_type token, const value_type& value) {
+        switch(token) {
+        case T_EQUAL:
+            // shift
+            push_stack(/*state*/ 391, value);
+            return false;
+        case T_NE:
+            // shift
+            push_stack(/*state*/ 393, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAndExpr1(Nonterminal_and_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_388(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_equality_expression: return 389;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 390;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_389(token_type token, const value_type& value) {
+        switch(token) {
+        case T_EQUAL:
+            // shift
+            push_stack(/*state*/ 391, value);
+            return false;
+        case T_NE:
+            // shift
+            push_stack(/*state*/ 393, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAndExpr2(Nonterminal_and_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_390(token_type token, const value_type& value) {
+        switch(token) {
+        case T_GE:
+            // shift
+            push_stack(/*state*/ 402, value);
+            return false;
+        case T_GT:
+            // shift
+            push_stack(/*state*/ 398, value);
+            return false;
+        case T_LE:
+            // shift
+            push_stack(/*state*/ 400, value);
+            return false;
+        case T_LT:
+            // shift
+            push_stack(/*state*/ 396, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoEqualExpr1(Nonterminal_equality_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_391(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 392;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_392(token_type token, const value_type& value) {
+        switch(token) {
+        case T_GE:
+            // shift
+            push_stack(/*state*/ 402, value);
+            return false;
+        case T_GT:
+            // shift
+            push_stack(/*state*/ 398, value);
+            return false;
+        case T_LE:
+            // shift
+            push_stack(/*state*/ 400, value);
+            return false;
+        case T_LT:
+            // shift
+            push_stack(/*state*/ 396, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoEqualExpr2(Nonterminal_equality_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_393(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_relational_expression: return 394;
+        case Nonterminal_shift_expression: return 395;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_394(token_type token, const value_type& value) {
+        switch(token) {
+        case T_GE:
+            // shift
+            push_stack(/*state*/ 402, value);
+            return false;
+        case T_GT:
+            // shift
+            push_stack(/*state*/ 398, value);
+            return false;
+        case T_LE:
+            // shift
+            push_stack(/*state*/ 400, value);
+            return false;
+        case T_LT:
+            // shift
+            push_stack(/*state*/ 396, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoEqualExpr3(Nonterminal_equality_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_395(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_SHIFT:
+            // shift
+            push_stack(/*state*/ 405, value);
+            return false;
+        case T_R_SHIFT:
+            // shift
+            push_stack(/*state*/ 407, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoRelExpr1(Nonterminal_relational_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_396(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_shift_expression: return 397;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_397(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_SHIFT:
+            // shift
+            push_stack(/*state*/ 405, value);
+            return false;
+        case T_R_SHIFT:
+            // shift
+            push_stack(/*state*/ 407, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoRelExpr2(Nonterminal_relational_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_398(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_shift_expression: return 399;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_399(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_SHIFT:
+            // shift
+            push_stack(/*state*/ 405, value);
+            return false;
+        case T_R_SHIFT:
+            // shift
+            push_stack(/*state*/ 407, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoRelExpr3(Nonterminal_relational_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_400(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_shift_expression: return 401;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_401(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_SHIFT:
+            // shift
+            push_stack(/*state*/ 405, value);
+            return false;
+        case T_R_SHIFT:
+            // shift
+            push_stack(/*state*/ 407, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoRelExpr4(Nonterminal_relational_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_402(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 404;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_shift_expression: return 403;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_403(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_SHIFT:
+            // shift
+            push_stack(/*state*/ 405, value);
+            return false;
+        case T_R_SHIFT:
+            // shift
+            push_stack(/*state*/ 407, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoRelExpr5(Nonterminal_relational_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_404(token_type token, const value_type& value) {
+        switch(token) {
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 412, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 410, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoShiftExpr1(Nonterminal_shift_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_405(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 406;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_406(token_type token, const value_type& value) {
+        switch(token) {
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 412, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 410, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoShiftExpr2(Nonterminal_shift_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_407(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_additive_expression: return 408;
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 409;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_408(token_type token, const value_type& value) {
+        switch(token) {
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 412, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 410, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoShiftExpr3(Nonterminal_shift_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_409(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 415, value);
+            return false;
+        case T_PERCENT:
+            // shift
+            push_stack(/*state*/ 419, value);
+            return false;
+        case T_SLASH:
+            // shift
+            push_stack(/*state*/ 417, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExpr1(Nonterminal_additive_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_410(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 411;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_411(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 415, value);
+            return false;
+        case T_PERCENT:
+            // shift
+            push_stack(/*state*/ 419, value);
+            return false;
+        case T_SLASH:
+            // shift
+            push_stack(/*state*/ 417, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExpr2(Nonterminal_additive_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_412(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 414;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_multiplicative_expression: return 413;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_413(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 415, value);
+            return false;
+        case T_PERCENT:
+            // shift
+            push_stack(/*state*/ 419, value);
+            return false;
+        case T_SLASH:
+            // shift
+            push_stack(/*state*/ 417, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExpr3(Nonterminal_additive_expression, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_414(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExpr1(Nonterminal_multiplicative_expression, /*pop*/ 1, 0);
+    }
+
+    int gotof_415(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 416;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_416(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExpr2(Nonterminal_multiplicative_expression, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_417(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 418;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_418(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExpr3(Nonterminal_multiplicative_expression, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_419(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 420;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_420(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExpr4(Nonterminal_multiplicative_expression, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_421(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_BRACE:
+            // shift
+            push_stack(/*state*/ 206, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 68, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_421(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 432;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_422(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 439;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_423(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 440;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_424(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 441;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_425(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 442;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_426(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 443;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_427(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_cast_expression: return 444;
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 428;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_428(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCastExpr1(Nonterminal_cast_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_429(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 421, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_430(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCastExpr2(Nonterminal_cast_expression, /*pop*/ 7, 1, 4);
+    }
+
+    bool state_431(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCastExpr3(Nonterminal_cast_expression, /*pop*/ 6, 1, 4);
+    }
+
+    bool state_432(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoCastExpr4(Nonterminal_cast_expression, /*pop*/ 4, 1, 3);
+    }
+
+    bool state_433(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 330, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_433(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 437;
+        default: assert(0); return false;
+        }
+    }
+
+    int gotof_434(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 438;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_435(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ALIGNOF:
+            // shift
+            push_stack(/*state*/ 448, value);
+            return false;
+        case T_AND:
+            // shift
+            push_stack(/*state*/ 422, value);
+            return false;
+        case T_ASTERISK:
+            // shift
+            push_stack(/*state*/ 423, value);
+            return false;
+        case T_BITWISE_NOT:
+            // shift
+            push_stack(/*state*/ 426, value);
+            return false;
+        case T_CONSTANT:
+            // shift
+            push_stack(/*state*/ 463, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 434, value);
+            return false;
+        case T_GENERIC:
+            // shift
+            push_stack(/*state*/ 467, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 462, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 433, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 69, value);
+            return false;
+        case T_MINUS:
+            // shift
+            push_stack(/*state*/ 425, value);
+            return false;
+        case T_NOT:
+            // shift
+            push_stack(/*state*/ 427, value);
+            return false;
+        case T_PLUS:
+            // shift
+            push_stack(/*state*/ 424, value);
+            return false;
+        case T_SIZEOF:
+            // shift
+            push_stack(/*state*/ 435, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 464, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_435(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_generic_selection: return 466;
+        case Nonterminal_postfix_expression: return 436;
+        case Nonterminal_primary_expression: return 451;
+        case Nonterminal_unary_expression: return 445;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_436(token_type token, const value_type& value) {
+        switch(token) {
+        case T_ARROW:
+            // shift
+            push_stack(/*state*/ 458, value);
+            return false;
+        case T_DEC:
+            // shift
+            push_stack(/*state*/ 461, value);
+            return false;
+        case T_DOT:
+            // shift
+            push_stack(/*state*/ 456, value);
+            return false;
+        case T_INC:
+            // shift
+            push_stack(/*state*/ 460, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 329, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 352, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoUnaryExpr1(Nonterminal_unary_expression, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_437(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr2(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_438(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr3(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_439(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr4(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_440(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr5(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_441(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr6(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_442(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr7(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_443(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr8(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_444(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr9(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_445(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr10(Nonterminal_unary_expression, /*pop*/ 2, 1);
+    }
+
+    bool state_446(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 447, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_447(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr11(Nonterminal_unary_expression, /*pop*/ 4, 2);
+    }
+
+    bool state_448(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 71, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_449(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 450, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_450(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExpr12(Nonterminal_unary_expression, /*pop*/ 4);
+    }
+
+    bool state_451(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr1(Nonterminal_postfix_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_452(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr2(Nonterminal_postfix_expression, /*pop*/ 4, 0);
+    }
+
+    bool state_453(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 356, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 454, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_454(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr3(Nonterminal_postfix_expression, /*pop*/ 4, 0);
+    }
+
+    bool state_455(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr4(Nonterminal_postfix_expression, /*pop*/ 3, 0);
+    }
+
+    bool state_456(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 457, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_457(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr5(Nonterminal_postfix_expression, /*pop*/ 3, 0);
+    }
+
+    bool state_458(token_type token, const value_type& value) {
+        switch(token) {
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 459, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_459(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr6(Nonterminal_postfix_expression, /*pop*/ 3, 0);
+    }
+
+    bool state_460(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr7(Nonterminal_postfix_expression, /*pop*/ 2, 0);
+    }
+
+    bool state_461(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPostfixExpr8(Nonterminal_postfix_expression, /*pop*/ 2, 0);
+    }
+
+    bool state_462(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExpr1(Nonterminal_primary_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_463(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExpr2(Nonterminal_primary_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_464(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExpr3(Nonterminal_primary_expression, /*pop*/ 1, 0);
+    }
+
+    bool state_465(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExpr4(Nonterminal_primary_expression, /*pop*/ 3, 1);
+    }
+
+    bool state_466(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExpr5(Nonterminal_primary_expression, /*pop*/ 1);
+    }
+
+    bool state_467(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 353, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_468(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 72, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_469(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 73, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 470, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_470(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoGeneSel1(Nonterminal_generic_selection, /*pop*/ 6, 2, 4);
+    }
+
+    bool state_471(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoGeneAssocList1(Nonterminal_generic_assoc_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_472(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoGeneAssocList2(Nonterminal_generic_assoc_list, /*pop*/ 1, 0);
+    }
+
+    bool state_473(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 354, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_474(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoGeneAssoc1(Nonterminal_generic_association, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_475(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 355, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_476(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoGeneAssoc2(Nonterminal_generic_association, /*pop*/ 3, 2);
+    }
+
+    bool state_477(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoArgExprList1(Nonterminal_argument_expression_list, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_478(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoArgExprList2(Nonterminal_argument_expression_list, /*pop*/ 1, 0);
+    }
+
+    bool state_479(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncSpec1(Nonterminal_function_specifier, /*pop*/ 1);
+    }
+
+    bool state_480(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncSpec2(Nonterminal_function_specifier, /*pop*/ 1);
+    }
+
+    bool state_481(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoFuncSpec3(Nonterminal_function_specifier, /*pop*/ 1);
+    }
+
+    bool state_482(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 70, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_483(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 484, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_484(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAlignSpec1(Nonterminal_alignment_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_485(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 486, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_486(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAlignSpec2(Nonterminal_alignment_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_487(token_type token, const value_type& value) {
+        switch(token) {
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 371, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_488(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 489, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_489(token_type token, const value_type& value) {
+        switch(token) {
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 490, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_490(token_type token, const value_type& value) {
+        switch(token) {
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 491, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_491(token_type token, const value_type& value) {
+        switch(token) {
+        case T_SEMICOLON:
+            // shift
+            push_stack(/*state*/ 492, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_492(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoStaticAssertDecl1(Nonterminal_static_assert_declaration, /*pop*/ 7, 2, 4);
+    }
+
+    bool state_493(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 496, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_493(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asm_operand: return 505;
+        case Nonterminal_asm_operands: return 494;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_494(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 495, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_494(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asm_operand: return 504;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_495(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmSpec1(Nonterminal_asm_specifier, /*pop*/ 5, 1, 3);
+    }
+
+    bool state_496(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmSpec2(Nonterminal_asm_specifier, /*pop*/ 4, 1);
+    }
+
+    bool state_497(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 500, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_497(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asm_operand: return 505;
+        case Nonterminal_asm_operands: return 498;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_498(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_R_PAREN:
+            // shift
+            push_stack(/*state*/ 499, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_499(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmSpec3(Nonterminal_asm_specifier, /*pop*/ 4, 2);
+    }
+
+    bool state_500(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmSpec4(Nonterminal_asm_specifier, /*pop*/ 3);
+    }
+
+    bool state_501(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_501(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_asm_operand: return 505;
+        case Nonterminal_asm_operands: return 502;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_502(token_type token, const value_type& value) {
+        switch(token) {
+        case T_COLON:
+            // shift
+            push_stack(/*state*/ 509, value);
+            return false;
+        case T_COMMA:
+            // shift
+            push_stack(/*state*/ 508, value);
+            return false;
+        case T_IDENTIFIER:
+            // shift
+            push_stack(/*state*/ 507, value);
+            return false;
+        case T_L_BRACKET:
+            // shift
+            push_stack(/*state*/ 332, value);
+            return false;
+        case T_L_PAREN:
+            // shift
+            push_stack(/*state*/ 331, value);
+            return false;
+        case T_R_BRACE:
+            // shift
+            push_stack(/*state*/ 503, value);
+            return false;
+        case T_STRING:
+            // shift
+            push_stack(/*state*/ 506, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_503(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmBlock1(Nonterminal_asm_block, /*pop*/ 4, 2);
+    }
+
+    bool state_504(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperands1(Nonterminal_asm_operands, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_505(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperands2(Nonterminal_asm_operands, /*pop*/ 1, 0);
+    }
+
+    bool state_506(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand1(Nonterminal_asm_operand, /*pop*/ 1, 0);
+    }
+
+    bool state_507(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand2(Nonterminal_asm_operand, /*pop*/ 1, 0);
+    }
+
+    bool state_508(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand3(Nonterminal_asm_operand, /*pop*/ 1);
+    }
+
+    bool state_509(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand4(Nonterminal_asm_operand, /*pop*/ 1);
+    }
+
+    bool state_510(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand5(Nonterminal_asm_operand, /*pop*/ 3, 1);
+    }
+
+    bool state_511(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoAsmOperand6(Nonterminal_asm_operand, /*pop*/ 3, 1);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_2, &Parser::gotof_2, false, true },
+            { &Parser::state_3, &Parser::gotof_2, false, true },
+            { &Parser::state_4, &Parser::gotof_2, false, true },
+            { &Parser::state_5, &Parser::gotof_2, false, true },
+            { &Parser::state_6, &Parser::gotof_2, false, true },
+            { &Parser::state_7, &Parser::gotof_7, false, false },
+            { &Parser::state_8, &Parser::gotof_8, false, false },
+            { &Parser::state_9, &Parser::gotof_9, false, false },
+            { &Parser::state_10, &Parser::gotof_2, false, true },
+            { &Parser::state_11, &Parser::gotof_2, false, true },
+            { &Parser::state_9, &Parser::gotof_12, false, false },
+            { &Parser::state_9, &Parser::gotof_13, false, false },
+            { &Parser::state_14, &Parser::gotof_2, false, true },
+            { &Parser::state_15, &Parser::gotof_2, false, true },
+            { &Parser::state_16, &Parser::gotof_16, false, false },
+            { &Parser::state_17, &Parser::gotof_17, false, false },
+            { &Parser::state_18, &Parser::gotof_2, false, true },
+            { &Parser::state_19, &Parser::gotof_2, false, true },
+            { &Parser::state_20, &Parser::gotof_20, false, false },
+            { &Parser::state_21, &Parser::gotof_21, false, false },
+            { &Parser::state_22, &Parser::gotof_2, false, false },
+            { &Parser::state_23, &Parser::gotof_2, false, true },
+            { &Parser::state_7, &Parser::gotof_24, false, false },
+            { &Parser::state_25, &Parser::gotof_2, false, false },
+            { &Parser::state_26, &Parser::gotof_2, false, true },
+            { &Parser::state_27, &Parser::gotof_2, false, true },
+            { &Parser::state_28, &Parser::gotof_2, false, true },
+            { &Parser::state_29, &Parser::gotof_2, false, false },
+            { &Parser::state_30, &Parser::gotof_2, false, true },
+            { &Parser::state_31, &Parser::gotof_2, false, true },
+            { &Parser::state_32, &Parser::gotof_32, false, false },
+            { &Parser::state_33, &Parser::gotof_33, false, false },
+            { &Parser::state_34, &Parser::gotof_34, false, false },
+            { &Parser::state_35, &Parser::gotof_35, false, false },
+            { &Parser::state_36, &Parser::gotof_36, false, false },
+            { &Parser::state_37, &Parser::gotof_37, false, false },
+            { &Parser::state_38, &Parser::gotof_38, false, false },
+            { &Parser::state_39, &Parser::gotof_39, false, false },
+            { &Parser::state_40, &Parser::gotof_40, false, false },
+            { &Parser::state_41, &Parser::gotof_41, false, false },
+            { &Parser::state_42, &Parser::gotof_42, false, false },
+            { &Parser::state_43, &Parser::gotof_2, false, true },
+            { &Parser::state_44, &Parser::gotof_2, false, true },
+            { &Parser::state_45, &Parser::gotof_2, false, true },
+            { &Parser::state_46, &Parser::gotof_2, false, true },
+            { &Parser::state_47, &Parser::gotof_2, false, true },
+            { &Parser::state_48, &Parser::gotof_48, false, false },
+            { &Parser::state_49, &Parser::gotof_49, false, false },
+            { &Parser::state_50, &Parser::gotof_2, false, true },
+            { &Parser::state_51, &Parser::gotof_2, false, true },
+            { &Parser::state_52, &Parser::gotof_2, false, true },
+            { &Parser::state_53, &Parser::gotof_2, false, true },
+            { &Parser::state_54, &Parser::gotof_2, false, true },
+            { &Parser::state_55, &Parser::gotof_2, false, true },
+            { &Parser::state_56, &Parser::gotof_2, false, true },
+            { &Parser::state_20, &Parser::gotof_57, false, false },
+            { &Parser::state_58, &Parser::gotof_58, false, false },
+            { &Parser::state_59, &Parser::gotof_59, false, false },
+            { &Parser::state_58, &Parser::gotof_60, false, false },
+            { &Parser::state_61, &Parser::gotof_59, false, false },
+            { &Parser::state_58, &Parser::gotof_62, false, false },
+            { &Parser::state_63, &Parser::gotof_59, false, false },
+            { &Parser::state_58, &Parser::gotof_64, false, false },
+            { &Parser::state_65, &Parser::gotof_59, false, false },
+            { &Parser::state_66, &Parser::gotof_66, false, false },
+            { &Parser::state_67, &Parser::gotof_67, false, false },
+            { &Parser::state_68, &Parser::gotof_68, false, false },
+            { &Parser::state_68, &Parser::gotof_69, false, false },
+            { &Parser::state_68, &Parser::gotof_70, false, false },
+            { &Parser::state_20, &Parser::gotof_71, false, false },
+            { &Parser::state_72, &Parser::gotof_72, false, false },
+            { &Parser::state_72, &Parser::gotof_73, false, false },
+            { &Parser::state_74, &Parser::gotof_2, false, true },
+            { &Parser::state_75, &Parser::gotof_2, false, true },
+            { &Parser::state_76, &Parser::gotof_2, false, true },
+            { &Parser::state_77, &Parser::gotof_2, false, true },
+            { &Parser::state_78, &Parser::gotof_2, false, true },
+            { &Parser::state_79, &Parser::gotof_2, false, true },
+            { &Parser::state_80, &Parser::gotof_2, false, true },
+            { &Parser::state_81, &Parser::gotof_2, false, true },
+            { &Parser::state_82, &Parser::gotof_2, false, true },
+            { &Parser::state_83, &Parser::gotof_2, false, true },
+            { &Parser::state_84, &Parser::gotof_2, false, true },
+            { &Parser::state_85, &Parser::gotof_2, false, true },
+            { &Parser::state_86, &Parser::gotof_2, false, true },
+            { &Parser::state_87, &Parser::gotof_2, false, true },
+            { &Parser::state_88, &Parser::gotof_2, false, true },
+            { &Parser::state_89, &Parser::gotof_2, false, true },
+            { &Parser::state_90, &Parser::gotof_2, false, true },
+            { &Parser::state_91, &Parser::gotof_2, false, true },
+            { &Parser::state_92, &Parser::gotof_2, false, true },
+            { &Parser::state_93, &Parser::gotof_2, false, true },
+            { &Parser::state_94, &Parser::gotof_2, false, true },
+            { &Parser::state_95, &Parser::gotof_2, false, false },
+            { &Parser::state_96, &Parser::gotof_2, false, false },
+            { &Parser::state_97, &Parser::gotof_2, false, true },
+            { &Parser::state_98, &Parser::gotof_98, false, false },
+            { &Parser::state_99, &Parser::gotof_99, false, false },
+            { &Parser::state_100, &Parser::gotof_100, false, false },
+            { &Parser::state_101, &Parser::gotof_101, false, false },
+            { &Parser::state_102, &Parser::gotof_2, false, true },
+            { &Parser::state_103, &Parser::gotof_2, false, true },
+            { &Parser::state_104, &Parser::gotof_2, false, true },
+            { &Parser::state_105, &Parser::gotof_2, false, false },
+            { &Parser::state_106, &Parser::gotof_2, false, false },
+            { &Parser::state_107, &Parser::gotof_2, false, true },
+            { &Parser::state_108, &Parser::gotof_2, false, true },
+            { &Parser::state_109, &Parser::gotof_2, false, false },
+            { &Parser::state_110, &Parser::gotof_2, false, false },
+            { &Parser::state_111, &Parser::gotof_2, false, true },
+            { &Parser::state_112, &Parser::gotof_2, false, true },
+            { &Parser::state_113, &Parser::gotof_2, false, true },
+            { &Parser::state_114, &Parser::gotof_2, false, true },
+            { &Parser::state_21, &Parser::gotof_115, false, false },
+            { &Parser::state_116, &Parser::gotof_2, false, true },
+            { &Parser::state_117, &Parser::gotof_2, false, true },
+            { &Parser::state_118, &Parser::gotof_118, false, false },
+            { &Parser::state_119, &Parser::gotof_2, false, true },
+            { &Parser::state_120, &Parser::gotof_2, false, true },
+            { &Parser::state_121, &Parser::gotof_2, false, false },
+            { &Parser::state_122, &Parser::gotof_122, false, false },
+            { &Parser::state_123, &Parser::gotof_2, false, true },
+            { &Parser::state_124, &Parser::gotof_124, false, false },
+            { &Parser::state_125, &Parser::gotof_2, false, false },
+            { &Parser::state_126, &Parser::gotof_2, false, true },
+            { &Parser::state_127, &Parser::gotof_2, false, true },
+            { &Parser::state_128, &Parser::gotof_2, false, true },
+            { &Parser::state_129, &Parser::gotof_2, false, true },
+            { &Parser::state_130, &Parser::gotof_2, false, true },
+            { &Parser::state_131, &Parser::gotof_131, false, false },
+            { &Parser::state_132, &Parser::gotof_2, false, true },
+            { &Parser::state_133, &Parser::gotof_2, false, true },
+            { &Parser::state_134, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_135, false, false },
+            { &Parser::state_136, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_137, false, false },
+            { &Parser::state_138, &Parser::gotof_2, false, true },
+            { &Parser::state_139, &Parser::gotof_2, false, false },
+            { &Parser::state_140, &Parser::gotof_2, false, false },
+            { &Parser::state_141, &Parser::gotof_141, false, false },
+            { &Parser::state_142, &Parser::gotof_2, false, false },
+            { &Parser::state_143, &Parser::gotof_143, false, false },
+            { &Parser::state_144, &Parser::gotof_2, false, true },
+            { &Parser::state_145, &Parser::gotof_2, false, true },
+            { &Parser::state_141, &Parser::gotof_146, false, false },
+            { &Parser::state_147, &Parser::gotof_2, false, false },
+            { &Parser::state_148, &Parser::gotof_143, false, false },
+            { &Parser::state_149, &Parser::gotof_2, false, true },
+            { &Parser::state_150, &Parser::gotof_2, false, true },
+            { &Parser::state_151, &Parser::gotof_2, false, true },
+            { &Parser::state_152, &Parser::gotof_2, false, true },
+            { &Parser::state_153, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_154, false, false },
+            { &Parser::state_155, &Parser::gotof_2, false, true },
+            { &Parser::state_21, &Parser::gotof_156, false, false },
+            { &Parser::state_157, &Parser::gotof_157, false, false },
+            { &Parser::state_158, &Parser::gotof_2, false, false },
+            { &Parser::state_159, &Parser::gotof_2, false, false },
+            { &Parser::state_118, &Parser::gotof_160, false, false },
+            { &Parser::state_161, &Parser::gotof_161, false, false },
+            { &Parser::state_162, &Parser::gotof_162, false, false },
+            { &Parser::state_163, &Parser::gotof_163, false, false },
+            { &Parser::state_164, &Parser::gotof_2, false, false },
+            { &Parser::state_165, &Parser::gotof_2, false, false },
+            { &Parser::state_166, &Parser::gotof_2, false, true },
+            { &Parser::state_167, &Parser::gotof_2, false, false },
+            { &Parser::state_168, &Parser::gotof_2, false, true },
+            { &Parser::state_169, &Parser::gotof_169, false, false },
+            { &Parser::state_170, &Parser::gotof_2, false, false },
+            { &Parser::state_171, &Parser::gotof_2, false, true },
+            { &Parser::state_172, &Parser::gotof_2, false, true },
+            { &Parser::state_173, &Parser::gotof_2, false, false },
+            { &Parser::state_174, &Parser::gotof_2, false, true },
+            { &Parser::state_175, &Parser::gotof_2, false, true },
+            { &Parser::state_176, &Parser::gotof_2, false, true },
+            { &Parser::state_177, &Parser::gotof_2, false, false },
+            { &Parser::state_178, &Parser::gotof_2, false, true },
+            { &Parser::state_179, &Parser::gotof_179, false, false },
+            { &Parser::state_180, &Parser::gotof_2, false, false },
+            { &Parser::state_181, &Parser::gotof_2, false, true },
+            { &Parser::state_182, &Parser::gotof_2, false, true },
+            { &Parser::state_183, &Parser::gotof_2, false, false },
+            { &Parser::state_184, &Parser::gotof_2, false, true },
+            { &Parser::state_185, &Parser::gotof_2, false, true },
+            { &Parser::state_186, &Parser::gotof_186, false, false },
+            { &Parser::state_187, &Parser::gotof_2, false, true },
+            { &Parser::state_188, &Parser::gotof_2, false, true },
+            { &Parser::state_189, &Parser::gotof_2, false, false },
+            { &Parser::state_190, &Parser::gotof_2, false, false },
+            { &Parser::state_191, &Parser::gotof_2, false, true },
+            { &Parser::state_192, &Parser::gotof_2, false, true },
+            { &Parser::state_193, &Parser::gotof_2, false, false },
+            { &Parser::state_194, &Parser::gotof_2, false, true },
+            { &Parser::state_195, &Parser::gotof_2, false, true },
+            { &Parser::state_196, &Parser::gotof_2, false, true },
+            { &Parser::state_197, &Parser::gotof_2, false, true },
+            { &Parser::state_198, &Parser::gotof_2, false, false },
+            { &Parser::state_199, &Parser::gotof_2, false, true },
+            { &Parser::state_200, &Parser::gotof_2, false, true },
+            { &Parser::state_201, &Parser::gotof_2, false, true },
+            { &Parser::state_202, &Parser::gotof_2, false, true },
+            { &Parser::state_203, &Parser::gotof_2, false, true },
+            { &Parser::state_122, &Parser::gotof_204, false, false },
+            { &Parser::state_205, &Parser::gotof_205, false, false },
+            { &Parser::state_122, &Parser::gotof_206, false, false },
+            { &Parser::state_207, &Parser::gotof_205, false, false },
+            { &Parser::state_208, &Parser::gotof_2, false, true },
+            { &Parser::state_209, &Parser::gotof_2, false, false },
+            { &Parser::state_210, &Parser::gotof_2, false, true },
+            { &Parser::state_211, &Parser::gotof_2, false, true },
+            { &Parser::state_212, &Parser::gotof_2, false, false },
+            { &Parser::state_213, &Parser::gotof_2, false, true },
+            { &Parser::state_214, &Parser::gotof_2, false, true },
+            { &Parser::state_215, &Parser::gotof_2, false, true },
+            { &Parser::state_216, &Parser::gotof_216, false, false },
+            { &Parser::state_217, &Parser::gotof_2, false, false },
+            { &Parser::state_218, &Parser::gotof_2, false, false },
+            { &Parser::state_219, &Parser::gotof_2, false, false },
+            { &Parser::state_220, &Parser::gotof_2, false, true },
+            { &Parser::state_221, &Parser::gotof_221, false, false },
+            { &Parser::state_222, &Parser::gotof_2, false, true },
+            { &Parser::state_223, &Parser::gotof_223, false, false },
+            { &Parser::state_224, &Parser::gotof_2, false, true },
+            { &Parser::state_225, &Parser::gotof_2, false, false },
+            { &Parser::state_226, &Parser::gotof_2, false, true },
+            { &Parser::state_227, &Parser::gotof_2, false, false },
+            { &Parser::state_228, &Parser::gotof_2, false, true },
+            { &Parser::state_229, &Parser::gotof_2, false, true },
+            { &Parser::state_230, &Parser::gotof_2, false, true },
+            { &Parser::state_231, &Parser::gotof_2, false, false },
+            { &Parser::state_232, &Parser::gotof_2, false, true },
+            { &Parser::state_233, &Parser::gotof_2, false, false },
+            { &Parser::state_234, &Parser::gotof_2, false, true },
+            { &Parser::state_235, &Parser::gotof_235, false, false },
+            { &Parser::state_236, &Parser::gotof_235, false, false },
+            { &Parser::state_237, &Parser::gotof_2, false, true },
+            { &Parser::state_238, &Parser::gotof_2, false, true },
+            { &Parser::state_239, &Parser::gotof_239, false, false },
+            { &Parser::state_239, &Parser::gotof_240, false, false },
+            { &Parser::state_239, &Parser::gotof_241, false, false },
+            { &Parser::state_239, &Parser::gotof_242, false, false },
+            { &Parser::state_239, &Parser::gotof_243, false, false },
+            { &Parser::state_239, &Parser::gotof_244, false, false },
+            { &Parser::state_239, &Parser::gotof_245, false, false },
+            { &Parser::state_239, &Parser::gotof_246, false, false },
+            { &Parser::state_239, &Parser::gotof_247, false, false },
+            { &Parser::state_239, &Parser::gotof_248, false, false },
+            { &Parser::state_239, &Parser::gotof_249, false, false },
+            { &Parser::state_239, &Parser::gotof_250, false, false },
+            { &Parser::state_239, &Parser::gotof_251, false, false },
+            { &Parser::state_239, &Parser::gotof_252, false, false },
+            { &Parser::state_239, &Parser::gotof_253, false, false },
+            { &Parser::state_239, &Parser::gotof_254, false, false },
+            { &Parser::state_255, &Parser::gotof_2, false, true },
+            { &Parser::state_256, &Parser::gotof_2, false, true },
+            { &Parser::state_257, &Parser::gotof_2, false, true },
+            { &Parser::state_258, &Parser::gotof_2, false, true },
+            { &Parser::state_259, &Parser::gotof_2, false, true },
+            { &Parser::state_260, &Parser::gotof_2, false, true },
+            { &Parser::state_261, &Parser::gotof_2, false, false },
+            { &Parser::state_262, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_263, false, false },
+            { &Parser::state_264, &Parser::gotof_2, false, false },
+            { &Parser::state_265, &Parser::gotof_2, false, true },
+            { &Parser::state_266, &Parser::gotof_2, false, false },
+            { &Parser::state_267, &Parser::gotof_2, false, true },
+            { &Parser::state_268, &Parser::gotof_2, false, true },
+            { &Parser::state_269, &Parser::gotof_2, false, false },
+            { &Parser::state_270, &Parser::gotof_2, false, true },
+            { &Parser::state_271, &Parser::gotof_2, false, true },
+            { &Parser::state_272, &Parser::gotof_2, false, true },
+            { &Parser::state_273, &Parser::gotof_2, false, true },
+            { &Parser::state_274, &Parser::gotof_2, false, true },
+            { &Parser::state_275, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_276, false, false },
+            { &Parser::state_277, &Parser::gotof_2, false, false },
+            { &Parser::state_278, &Parser::gotof_2, false, false },
+            { &Parser::state_279, &Parser::gotof_2, false, true },
+            { &Parser::state_280, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_281, false, false },
+            { &Parser::state_282, &Parser::gotof_2, false, false },
+            { &Parser::state_283, &Parser::gotof_2, false, true },
+            { &Parser::state_284, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_285, false, false },
+            { &Parser::state_286, &Parser::gotof_2, false, false },
+            { &Parser::state_287, &Parser::gotof_2, false, true },
+            { &Parser::state_288, &Parser::gotof_2, false, false },
+            { &Parser::state_289, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_290, false, false },
+            { &Parser::state_291, &Parser::gotof_2, false, false },
+            { &Parser::state_292, &Parser::gotof_2, false, false },
+            { &Parser::state_293, &Parser::gotof_2, false, true },
+            { &Parser::state_294, &Parser::gotof_2, false, false },
+            { &Parser::state_295, &Parser::gotof_295, false, false },
+            { &Parser::state_296, &Parser::gotof_296, false, false },
+            { &Parser::state_297, &Parser::gotof_297, false, false },
+            { &Parser::state_298, &Parser::gotof_2, false, true },
+            { &Parser::state_299, &Parser::gotof_2, false, false },
+            { &Parser::state_300, &Parser::gotof_2, false, true },
+            { &Parser::state_301, &Parser::gotof_2, false, false },
+            { &Parser::state_302, &Parser::gotof_302, false, false },
+            { &Parser::state_303, &Parser::gotof_2, false, true },
+            { &Parser::state_304, &Parser::gotof_2, false, false },
+            { &Parser::state_305, &Parser::gotof_2, false, true },
+            { &Parser::state_306, &Parser::gotof_2, false, false },
+            { &Parser::state_307, &Parser::gotof_307, false, false },
+            { &Parser::state_308, &Parser::gotof_308, false, false },
+            { &Parser::state_309, &Parser::gotof_2, false, true },
+            { &Parser::state_310, &Parser::gotof_2, false, false },
+            { &Parser::state_311, &Parser::gotof_2, false, true },
+            { &Parser::state_312, &Parser::gotof_2, false, false },
+            { &Parser::state_313, &Parser::gotof_313, false, false },
+            { &Parser::state_314, &Parser::gotof_2, false, true },
+            { &Parser::state_315, &Parser::gotof_2, false, false },
+            { &Parser::state_316, &Parser::gotof_2, false, true },
+            { &Parser::state_317, &Parser::gotof_2, false, false },
+            { &Parser::state_318, &Parser::gotof_2, false, false },
+            { &Parser::state_319, &Parser::gotof_2, false, true },
+            { &Parser::state_320, &Parser::gotof_2, false, false },
+            { &Parser::state_321, &Parser::gotof_2, false, true },
+            { &Parser::state_322, &Parser::gotof_2, false, false },
+            { &Parser::state_323, &Parser::gotof_2, false, true },
+            { &Parser::state_324, &Parser::gotof_324, false, false },
+            { &Parser::state_325, &Parser::gotof_2, false, true },
+            { &Parser::state_326, &Parser::gotof_2, false, false },
+            { &Parser::state_327, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_328, false, false },
+            { &Parser::state_135, &Parser::gotof_329, false, false },
+            { &Parser::state_135, &Parser::gotof_330, false, false },
+            { &Parser::state_135, &Parser::gotof_331, false, false },
+            { &Parser::state_135, &Parser::gotof_332, false, false },
+            { &Parser::state_333, &Parser::gotof_2, false, true },
+            { &Parser::state_334, &Parser::gotof_2, false, false },
+            { &Parser::state_335, &Parser::gotof_2, false, false },
+            { &Parser::state_336, &Parser::gotof_2, false, false },
+            { &Parser::state_337, &Parser::gotof_2, false, false },
+            { &Parser::state_338, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_339, false, false },
+            { &Parser::state_340, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_341, false, false },
+            { &Parser::state_135, &Parser::gotof_342, false, false },
+            { &Parser::state_135, &Parser::gotof_343, false, false },
+            { &Parser::state_135, &Parser::gotof_344, false, false },
+            { &Parser::state_135, &Parser::gotof_345, false, false },
+            { &Parser::state_135, &Parser::gotof_346, false, false },
+            { &Parser::state_135, &Parser::gotof_347, false, false },
+            { &Parser::state_135, &Parser::gotof_348, false, false },
+            { &Parser::state_135, &Parser::gotof_349, false, false },
+            { &Parser::state_135, &Parser::gotof_350, false, false },
+            { &Parser::state_135, &Parser::gotof_351, false, false },
+            { &Parser::state_352, &Parser::gotof_352, false, false },
+            { &Parser::state_135, &Parser::gotof_353, false, false },
+            { &Parser::state_135, &Parser::gotof_354, false, false },
+            { &Parser::state_135, &Parser::gotof_355, false, false },
+            { &Parser::state_135, &Parser::gotof_356, false, false },
+            { &Parser::state_357, &Parser::gotof_2, false, true },
+            { &Parser::state_358, &Parser::gotof_2, false, false },
+            { &Parser::state_359, &Parser::gotof_2, false, true },
+            { &Parser::state_360, &Parser::gotof_2, false, true },
+            { &Parser::state_361, &Parser::gotof_2, false, true },
+            { &Parser::state_362, &Parser::gotof_2, false, true },
+            { &Parser::state_363, &Parser::gotof_2, false, true },
+            { &Parser::state_364, &Parser::gotof_2, false, true },
+            { &Parser::state_365, &Parser::gotof_2, false, true },
+            { &Parser::state_366, &Parser::gotof_2, false, true },
+            { &Parser::state_367, &Parser::gotof_2, false, true },
+            { &Parser::state_368, &Parser::gotof_2, false, true },
+            { &Parser::state_369, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_370, false, false },
+            { &Parser::state_135, &Parser::gotof_371, false, false },
+            { &Parser::state_372, &Parser::gotof_2, false, false },
+            { &Parser::state_373, &Parser::gotof_2, false, true },
+            { &Parser::state_374, &Parser::gotof_2, false, true },
+            { &Parser::state_375, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_376, false, false },
+            { &Parser::state_377, &Parser::gotof_2, false, false },
+            { &Parser::state_378, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_379, false, false },
+            { &Parser::state_380, &Parser::gotof_2, false, false },
+            { &Parser::state_381, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_382, false, false },
+            { &Parser::state_383, &Parser::gotof_2, false, false },
+            { &Parser::state_384, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_385, false, false },
+            { &Parser::state_386, &Parser::gotof_2, false, false },
+            { &Parser::state_387, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_388, false, false },
+            { &Parser::state_389, &Parser::gotof_2, false, false },
+            { &Parser::state_390, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_391, false, false },
+            { &Parser::state_392, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_393, false, false },
+            { &Parser::state_394, &Parser::gotof_2, false, false },
+            { &Parser::state_395, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_396, false, false },
+            { &Parser::state_397, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_398, false, false },
+            { &Parser::state_399, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_400, false, false },
+            { &Parser::state_401, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_402, false, false },
+            { &Parser::state_403, &Parser::gotof_2, false, false },
+            { &Parser::state_404, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_405, false, false },
+            { &Parser::state_406, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_407, false, false },
+            { &Parser::state_408, &Parser::gotof_2, false, false },
+            { &Parser::state_409, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_410, false, false },
+            { &Parser::state_411, &Parser::gotof_2, false, false },
+            { &Parser::state_135, &Parser::gotof_412, false, false },
+            { &Parser::state_413, &Parser::gotof_2, false, false },
+            { &Parser::state_414, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_415, false, false },
+            { &Parser::state_416, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_417, false, false },
+            { &Parser::state_418, &Parser::gotof_2, false, true },
+            { &Parser::state_135, &Parser::gotof_419, false, false },
+            { &Parser::state_420, &Parser::gotof_2, false, true },
+            { &Parser::state_421, &Parser::gotof_421, false, false },
+            { &Parser::state_135, &Parser::gotof_422, false, false },
+            { &Parser::state_135, &Parser::gotof_423, false, false },
+            { &Parser::state_135, &Parser::gotof_424, false, false },
+            { &Parser::state_135, &Parser::gotof_425, false, false },
+            { &Parser::state_135, &Parser::gotof_426, false, false },
+            { &Parser::state_135, &Parser::gotof_427, false, false },
+            { &Parser::state_428, &Parser::gotof_2, false, true },
+            { &Parser::state_429, &Parser::gotof_2, false, false },
+            { &Parser::state_430, &Parser::gotof_2, false, true },
+            { &Parser::state_431, &Parser::gotof_2, false, true },
+            { &Parser::state_432, &Parser::gotof_2, false, true },
+            { &Parser::state_433, &Parser::gotof_433, false, false },
+            { &Parser::state_433, &Parser::gotof_434, false, false },
+            { &Parser::state_435, &Parser::gotof_435, false, false },
+            { &Parser::state_436, &Parser::gotof_2, false, false },
+            { &Parser::state_437, &Parser::gotof_2, false, true },
+            { &Parser::state_438, &Parser::gotof_2, false, true },
+            { &Parser::state_439, &Parser::gotof_2, false, true },
+            { &Parser::state_440, &Parser::gotof_2, false, true },
+            { &Parser::state_441, &Parser::gotof_2, false, true },
+            { &Parser::state_442, &Parser::gotof_2, false, true },
+            { &Parser::state_443, &Parser::gotof_2, false, true },
+            { &Parser::state_444, &Parser::gotof_2, false, true },
+            { &Parser::state_445, &Parser::gotof_2, false, true },
+            { &Parser::state_446, &Parser::gotof_2, false, false },
+            { &Parser::state_447, &Parser::gotof_2, false, true },
+            { &Parser::state_448, &Parser::gotof_2, false, false },
+            { &Parser::state_449, &Parser::gotof_2, false, false },
+            { &Parser::state_450, &Parser::gotof_2, false, true },
+            { &Parser::state_451, &Parser::gotof_2, false, true },
+            { &Parser::state_452, &Parser::gotof_2, false, true },
+            { &Parser::state_453, &Parser::gotof_2, false, false },
+            { &Parser::state_454, &Parser::gotof_2, false, true },
+            { &Parser::state_455, &Parser::gotof_2, false, true },
+            { &Parser::state_456, &Parser::gotof_2, false, false },
+            { &Parser::state_457, &Parser::gotof_2, false, true },
+            { &Parser::state_458, &Parser::gotof_2, false, false },
+            { &Parser::state_459, &Parser::gotof_2, false, true },
+            { &Parser::state_460, &Parser::gotof_2, false, true },
+            { &Parser::state_461, &Parser::gotof_2, false, true },
+            { &Parser::state_462, &Parser::gotof_2, false, true },
+            { &Parser::state_463, &Parser::gotof_2, false, true },
+            { &Parser::state_464, &Parser::gotof_2, false, true },
+            { &Parser::state_465, &Parser::gotof_2, false, true },
+            { &Parser::state_466, &Parser::gotof_2, false, true },
+            { &Parser::state_467, &Parser::gotof_2, false, false },
+            { &Parser::state_468, &Parser::gotof_2, false, false },
+            { &Parser::state_469, &Parser::gotof_2, false, false },
+            { &Parser::state_470, &Parser::gotof_2, false, true },
+            { &Parser::state_471, &Parser::gotof_2, false, true },
+            { &Parser::state_472, &Parser::gotof_2, false, true },
+            { &Parser::state_473, &Parser::gotof_2, false, false },
+            { &Parser::state_474, &Parser::gotof_2, false, true },
+            { &Parser::state_475, &Parser::gotof_2, false, false },
+            { &Parser::state_476, &Parser::gotof_2, false, true },
+            { &Parser::state_477, &Parser::gotof_2, false, true },
+            { &Parser::state_478, &Parser::gotof_2, false, true },
+            { &Parser::state_479, &Parser::gotof_2, false, true },
+            { &Parser::state_480, &Parser::gotof_2, false, true },
+            { &Parser::state_481, &Parser::gotof_2, false, true },
+            { &Parser::state_482, &Parser::gotof_2, false, false },
+            { &Parser::state_483, &Parser::gotof_2, false, false },
+            { &Parser::state_484, &Parser::gotof_2, false, true },
+            { &Parser::state_485, &Parser::gotof_2, false, false },
+            { &Parser::state_486, &Parser::gotof_2, false, true },
+            { &Parser::state_487, &Parser::gotof_2, false, false },
+            { &Parser::state_488, &Parser::gotof_2, false, false },
+            { &Parser::state_489, &Parser::gotof_2, false, false },
+            { &Parser::state_490, &Parser::gotof_2, false, false },
+            { &Parser::state_491, &Parser::gotof_2, false, false },
+            { &Parser::state_492, &Parser::gotof_2, false, true },
+            { &Parser::state_493, &Parser::gotof_493, false, false },
+            { &Parser::state_494, &Parser::gotof_494, false, false },
+            { &Parser::state_495, &Parser::gotof_2, false, true },
+            { &Parser::state_496, &Parser::gotof_2, false, true },
+            { &Parser::state_497, &Parser::gotof_497, false, false },
+            { &Parser::state_498, &Parser::gotof_494, false, false },
+            { &Parser::state_499, &Parser::gotof_2, false, true },
+            { &Parser::state_500, &Parser::gotof_2, false, true },
+            { &Parser::state_501, &Parser::gotof_501, false, false },
+            { &Parser::state_502, &Parser::gotof_494, false, false },
+            { &Parser::state_503, &Parser::gotof_2, false, true },
+            { &Parser::state_504, &Parser::gotof_2, false, true },
+            { &Parser::state_505, &Parser::gotof_2, false, true },
+            { &Parser::state_506, &Parser::gotof_2, false, true },
+            { &Parser::state_507, &Parser::gotof_2, false, true },
+            { &Parser::state_508, &Parser::gotof_2, false, true },
+            { &Parser::state_509, &Parser::gotof_2, false, true },
+            { &Parser::state_510, &Parser::gotof_2, false, true },
+            { &Parser::state_511, &Parser::gotof_2, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace cparser
+
+#endif // #ifndef CPARSER_RAW_IPP_
+
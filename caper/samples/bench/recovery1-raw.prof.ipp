@@ -0,0 +1,1364 @@
+#ifndef RECOVERY1_RAW_PROF_IPP_
+#define RECOVERY1_RAW_PROF_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+
+#ifndef CAPER_PROFILE
+#define CAPER_PROFILE 1
+#endif
+#ifndef CAPER_TRACE_SIZE
+#define CAPER_TRACE_SIZE 0
+#endif
+
+namespace calc {
+
+enum Token {
+    token_eof,
+    token_error,
+    token_LParen,
+    token_Minus,
+    token_NewLine,
+    token_Number,
+    token_Plus,
+    token_RParen,
+    token_Slash,
+    token_Star,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_error",
+        "token_LParen",
+        "token_Minus",
+        "token_NewLine",
+        "token_Number",
+        "token_Plus",
+        "token_RParen",
+        "token_Slash",
+        "token_Star",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { top_ = 0; gap_ = 0; tmp_ = 0; }
+    ~Stack() {}
+
+    void rollback_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        tmp_ = 0;
+        gap_ = top_;
+    }
+
+    void commit_tmp() {
+        for (size_t i = 0 ; i <tmp_ ; i++) {
+            if (gap_ + i <top_) {
+                at(gap_ + i) = at(StackSize - 1 - i);
+            } else {
+                new (&at(gap_ + i)) T(at(StackSize - 1 - i));
+            }
+            at(StackSize - 1 - i).~T(); // explicit destructor
+        }
+        if (gap_ + tmp_ <top_) {
+            for (int i = 0 ; i <int(top_ - gap_ - tmp_); i++) {
+                at(top_ - 1 - i).~T(); // explicit destructor
+            }
+        }
+
+        top_ = gap_ = gap_ + tmp_;
+        tmp_ = 0;
+    }
+
+    bool push(const T& f) {
+        if (StackSize <= top_ + tmp_) { return false; }
+        new (&at(StackSize - 1 - tmp_++)) T(f);
+        return true;
+    }
+
+    void pop(size_t n) {
+        size_t m = n; if (m > tmp_) { m = tmp_; }
+
+        for (size_t i = 0 ; i <m ; i++) {
+            at(StackSize - tmp_ + i).~T(); // explicit destructor
+        }
+
+        tmp_ -= m;
+        gap_ -= n - m;
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (0 <tmp_) {
+            return at(StackSize - 1 -(tmp_-1));
+        } else {
+            return at(gap_ - 1);
+        }
+    }
+
+    const T& get_arg(size_t base, size_t index) {
+        if (base - index <= tmp_) {
+            return at(StackSize-1 - (tmp_ -(base - index)));
+        } else {
+            return at(gap_ -(base - tmp_) + index);
+        }
+    }
+
+    void clear() {
+        rollback_tmp();
+        for (size_t i = 0 ; i <top_ ; i++) {
+            at(i).~T(); // explicit destructor
+        }
+        top_ = gap_ = tmp_ = 0;
+    }
+
+    bool empty() const {
+        if (0 < tmp_) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+
+    size_t depth() const {
+        return gap_ + tmp_;
+    }
+
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return at(StackSize-1 - (index - gap_));
+        } else {
+            return at(index);
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    T& at(size_t n) {
+        return *(T*)(stack_ + (n * sizeof(T)));
+    }
+
+private:
+    char stack_[ StackSize * sizeof(T) ];
+    size_t top_;
+    size_t gap_;
+    size_t tmp_;
+
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 1024>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_AddExp,
+        Nonterminal_Input,
+        Nonterminal_Line,
+        Nonterminal_MulExp,
+        Nonterminal_PrimExp,
+        Nonterminal_UnaryExp,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[26][2] = {
+            { 62, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 88, 0 },
+            { 63, 0 },
+            { 16, 0 },
+            { 63, 0 },
+            { 44, 0 },
+            { 216, 3 },
+            { 200, 0 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 216, 3 },
+            { 216, 3 },
+            { 216, 3 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() {
+        rollback_tmp_stack();
+        return int(stack_top()->entry - entry(0));
+    }
+
+    bool expected(token_type token) {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        profile_depth();
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+public:
+    // profiling
+    //   counters are compiled in when CAPER_PROFILE is nonzero,
+    //   the ring buffer of recent events when CAPER_TRACE_SIZE is nonzero.
+    enum {
+        state_count = 26,
+        rule_count = 16
+    };
+
+    struct stats_type {
+        unsigned long   shifts[state_count];        // by state
+        unsigned long   reductions[rule_count];     // by rule
+        unsigned long   gotos[state_count];         // by source state
+        unsigned long   recoveries;
+        size_t          max_depth;
+
+        stats_type() { clear(); }
+
+        void clear() {
+            for (int i = 0 ; i < state_count ; i++) {
+                shifts[i] = 0;
+                gotos[i] = 0;
+            }
+            for (int i = 0 ; i < rule_count ; i++) {
+                reductions[i] = 0;
+            }
+            recoveries = 0;
+            max_depth = 0;
+        }
+    };
+
+    enum trace_action {
+        trace_shift,    // target: destination state
+        trace_reduce,   // target: rule
+        trace_accept,
+        trace_error,
+    };
+
+    struct trace_event {
+        int     state;
+        int     token;
+        int     action;
+        int     target;
+    };
+
+    const stats_type& stats() const { return stats_; }
+    void clear_stats() { stats_.clear(); }
+
+    static const char* rule_label(int rule) {
+        static const char* labels[] = {
+            "$implicit_root ::= Input",
+            "Input ::= Input Line",
+            "Input ::= Line",
+            "Line ::= NewLine",
+            "Line ::= AddExp NewLine",
+            "Line ::= error NewLine",
+            "AddExp ::= MulExp",
+            "AddExp ::= AddExp Plus MulExp",
+            "AddExp ::= AddExp Minus MulExp",
+            "MulExp ::= UnaryExp",
+            "MulExp ::= MulExp Star UnaryExp",
+            "MulExp ::= MulExp Slash UnaryExp",
+            "UnaryExp ::= PrimExp",
+            "UnaryExp ::= Minus UnaryExp",
+            "PrimExp ::= Number",
+            "PrimExp ::= LParen AddExp RParen",
+        };
+        return labels[rule];
+    }
+
+    // copies up to n recent events (oldest first), returns the count
+    size_t trace(trace_event* events, size_t n) const {
+#if CAPER_TRACE_SIZE
+        size_t count = trace_.count;
+        if (CAPER_TRACE_SIZE < count) { count = CAPER_TRACE_SIZE; }
+        if (n < count) { count = n; }
+        for (size_t i = 0 ; i < count ; i++) {
+            events[i] = trace_.events[
+                (trace_.count - count + i) % CAPER_TRACE_SIZE];
+        }
+        return count;
+#else
+        (void)events;
+        (void)n;
+        return 0;
+#endif
+    }
+
+private:
+    stats_type stats_;
+#if CAPER_TRACE_SIZE
+    struct trace_buffer {
+        trace_event events[CAPER_TRACE_SIZE];
+        size_t      count;
+
+        trace_buffer() : count(0) {}
+    };
+    trace_buffer trace_;
+#endif
+
+    void profile_trace(int state, token_type token, int action, int target) {
+#if CAPER_TRACE_SIZE
+        trace_event& e = trace_.events[trace_.count++ % CAPER_TRACE_SIZE];
+        e.state = state;
+        e.token = int(token);
+        e.action = action;
+        e.target = target;
+#else
+        (void)state;
+        (void)token;
+        (void)action;
+        (void)target;
+#endif
+    }
+
+    void profile_shift(int state, token_type token, int dest) {
+#if CAPER_PROFILE
+        stats_.shifts[state]++;
+#endif
+        profile_trace(state, token, trace_shift, dest);
+    }
+
+    void profile_reduce(int state, token_type token, int rule) {
+#if CAPER_PROFILE
+        stats_.reductions[rule]++;
+#endif
+        profile_trace(state, token, trace_reduce, rule);
+    }
+
+    void profile_accept(int state, token_type token) {
+        profile_trace(state, token, trace_accept, 0);
+    }
+
+    void profile_error(int state, token_type token) {
+        profile_trace(state, token, trace_error, 0);
+    }
+
+    void profile_goto(int state) {
+#if CAPER_PROFILE
+        stats_.gotos[state]++;
+#else
+        (void)state;
+#endif
+    }
+
+    void profile_recover() {
+#if CAPER_PROFILE
+        stats_.recoveries++;
+#endif
+    }
+
+    void profile_depth() {
+#if CAPER_PROFILE
+        if (stats_.max_depth < stack_.depth()) {
+            stats_.max_depth = stack_.depth();
+        }
+#endif
+    }
+
+    void recover(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        profile_recover();
+        while(!stack_top()->entry->handle_error) {
+            pop_stack(1);
+            if (stack_.empty()) {
+                error_ = true;
+                return;
+            }
+        }
+        // post error_token;
+        while ((this->*(stack_top()->entry->state))(token_error, value_type()));
+        commit_tmp_stack();
+        // repost original token
+        // if it still causes error, discard it;
+        while ((this->*(stack_top()->entry->state))(token, value));
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        }
+        if (token != token_eof) {
+            error_ = false;
+        }
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_DoLine1(Nonterminal nonterminal, int base) {
+        int r = sa_.DoLine1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLine2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoLine2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLine3(Nonterminal nonterminal, int base) {
+        int r = sa_.DoLine3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoAddExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoAddExp2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoAddExp3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoMulExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoMulExp2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoMulExp3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoUnaryExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExp2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoUnaryExp2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoPrimExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExp2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoPrimExp2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_error:
+            // shift
+            profile_shift(0, token, 7);
+            push_stack(/*state*/ 7, value);
+            return false;
+        case token_LParen:
+            // shift
+            profile_shift(0, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(0, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_NewLine:
+            // shift
+            profile_shift(0, token, 4);
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(0, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(0, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        profile_goto(0);
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 5;
+        case Nonterminal_Input: return 1;
+        case Nonterminal_Line: return 3;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            profile_accept(1, token);
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_error:
+            // shift
+            profile_shift(1, token, 7);
+            push_stack(/*state*/ 7, value);
+            return false;
+        case token_LParen:
+            // shift
+            profile_shift(1, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(1, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_NewLine:
+            // shift
+            profile_shift(1, token, 4);
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(1, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(1, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        profile_goto(1);
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 5;
+        case Nonterminal_Line: return 2;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            profile_reduce(2, token, 1);
+            return call_nothing(Nonterminal_Input, /*pop*/ 2);
+        default:
+            profile_error(2, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        profile_goto(2);
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            profile_reduce(3, token, 2);
+            return call_nothing(Nonterminal_Input, /*pop*/ 1);
+        default:
+            profile_error(3, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_3(Nonterminal nonterminal) {
+        profile_goto(3);
+        assert(0);
+        return true;
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            profile_reduce(4, token, 3);
+            return call_0_DoLine1(Nonterminal_Line, /*pop*/ 1);
+        default:
+            profile_error(4, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_4(Nonterminal nonterminal) {
+        profile_goto(4);
+        assert(0);
+        return true;
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Minus:
+            // shift
+            profile_shift(5, token, 14);
+            push_stack(/*state*/ 14, value);
+            return false;
+        case token_NewLine:
+            // shift
+            profile_shift(5, token, 6);
+            push_stack(/*state*/ 6, value);
+            return false;
+        case token_Plus:
+            // shift
+            profile_shift(5, token, 12);
+            push_stack(/*state*/ 12, value);
+            return false;
+        default:
+            profile_error(5, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_5(Nonterminal nonterminal) {
+        profile_goto(5);
+        assert(0);
+        return true;
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            profile_reduce(6, token, 4);
+            return call_0_DoLine2(Nonterminal_Line, /*pop*/ 2, 0);
+        default:
+            profile_error(6, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_6(Nonterminal nonterminal) {
+        profile_goto(6);
+        assert(0);
+        return true;
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        switch(token) {
+        case token_NewLine:
+            // shift
+            profile_shift(7, token, 8);
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            profile_error(7, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_7(Nonterminal nonterminal) {
+        profile_goto(7);
+        assert(0);
+        return true;
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            profile_reduce(8, token, 5);
+            return call_0_DoLine3(Nonterminal_Line, /*pop*/ 2);
+        default:
+            profile_error(8, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_8(Nonterminal nonterminal) {
+        profile_goto(8);
+        assert(0);
+        return true;
+    }
+
+    bool state_9(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(9, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(9, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(9, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(9, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_9(Nonterminal nonterminal) {
+        profile_goto(9);
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 11;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            profile_shift(10, token, 19);
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            profile_shift(10, token, 17);
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(10, token, 6);
+            return call_0_DoAddExp1(Nonterminal_AddExp, /*pop*/ 1, 0);
+        }
+    }
+
+    int gotof_10(Nonterminal nonterminal) {
+        profile_goto(10);
+        assert(0);
+        return true;
+    }
+
+    bool state_11(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Minus:
+            // shift
+            profile_shift(11, token, 14);
+            push_stack(/*state*/ 14, value);
+            return false;
+        case token_Plus:
+            // shift
+            profile_shift(11, token, 12);
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_RParen:
+            // shift
+            profile_shift(11, token, 25);
+            push_stack(/*state*/ 25, value);
+            return false;
+        default:
+            profile_error(11, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_11(Nonterminal nonterminal) {
+        profile_goto(11);
+        assert(0);
+        return true;
+    }
+
+    bool state_12(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(12, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(12, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(12, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(12, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_12(Nonterminal nonterminal) {
+        profile_goto(12);
+        switch(nonterminal) {
+        case Nonterminal_MulExp: return 13;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_13(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            profile_shift(13, token, 19);
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            profile_shift(13, token, 17);
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(13, token, 7);
+            return call_0_DoAddExp2(Nonterminal_AddExp, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_13(Nonterminal nonterminal) {
+        profile_goto(13);
+        assert(0);
+        return true;
+    }
+
+    bool state_14(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(14, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(14, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(14, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(14, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_14(Nonterminal nonterminal) {
+        profile_goto(14);
+        switch(nonterminal) {
+        case Nonterminal_MulExp: return 15;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_15(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            profile_shift(15, token, 19);
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            profile_shift(15, token, 17);
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            profile_reduce(15, token, 8);
+            return call_0_DoAddExp3(Nonterminal_AddExp, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_15(Nonterminal nonterminal) {
+        profile_goto(15);
+        assert(0);
+        return true;
+    }
+
+    bool state_16(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(16, token, 9);
+        return call_0_DoMulExp1(Nonterminal_MulExp, /*pop*/ 1, 0);
+    }
+
+    int gotof_16(Nonterminal nonterminal) {
+        profile_goto(16);
+        assert(0);
+        return true;
+    }
+
+    bool state_17(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(17, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(17, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(17, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(17, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_17(Nonterminal nonterminal) {
+        profile_goto(17);
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 18;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_18(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(18, token, 10);
+        return call_0_DoMulExp2(Nonterminal_MulExp, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_18(Nonterminal nonterminal) {
+        profile_goto(18);
+        assert(0);
+        return true;
+    }
+
+    bool state_19(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(19, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(19, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(19, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(19, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_19(Nonterminal nonterminal) {
+        profile_goto(19);
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 20;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_20(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(20, token, 11);
+        return call_0_DoMulExp3(Nonterminal_MulExp, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_20(Nonterminal nonterminal) {
+        profile_goto(20);
+        assert(0);
+        return true;
+    }
+
+    bool state_21(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            profile_shift(21, token, 9);
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            profile_shift(21, token, 21);
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            profile_shift(21, token, 24);
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            profile_error(21, token);
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_21(Nonterminal nonterminal) {
+        profile_goto(21);
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 23;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_22(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(22, token, 12);
+        return call_0_DoUnaryExp1(Nonterminal_UnaryExp, /*pop*/ 1, 0);
+    }
+
+    int gotof_22(Nonterminal nonterminal) {
+        profile_goto(22);
+        assert(0);
+        return true;
+    }
+
+    bool state_23(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(23, token, 13);
+        return call_0_DoUnaryExp2(Nonterminal_UnaryExp, /*pop*/ 2, 1);
+    }
+
+    int gotof_23(Nonterminal nonterminal) {
+        profile_goto(23);
+        assert(0);
+        return true;
+    }
+
+    bool state_24(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(24, token, 14);
+        return call_0_DoPrimExp1(Nonterminal_PrimExp, /*pop*/ 1, 0);
+    }
+
+    int gotof_24(Nonterminal nonterminal) {
+        profile_goto(24);
+        assert(0);
+        return true;
+    }
+
+    bool state_25(token_type token, const value_type& value) {
+        // reduce
+        profile_reduce(25, token, 15);
+        return call_0_DoPrimExp2(Nonterminal_PrimExp, /*pop*/ 3, 1);
+    }
+
+    int gotof_25(Nonterminal nonterminal) {
+        profile_goto(25);
+        assert(0);
+        return true;
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, true, false },
+            { &Parser::state_1, &Parser::gotof_1, true, false },
+            { &Parser::state_2, &Parser::gotof_2, true, false },
+            { &Parser::state_3, &Parser::gotof_3, true, false },
+            { &Parser::state_4, &Parser::gotof_4, true, false },
+            { &Parser::state_5, &Parser::gotof_5, false, false },
+            { &Parser::state_6, &Parser::gotof_6, true, false },
+            { &Parser::state_7, &Parser::gotof_7, false, false },
+            { &Parser::state_8, &Parser::gotof_8, true, false },
+            { &Parser::state_9, &Parser::gotof_9, false, false },
+            { &Parser::state_10, &Parser::gotof_10, false, false },
+            { &Parser::state_11, &Parser::gotof_11, false, false },
+            { &Parser::state_12, &Parser::gotof_12, false, false },
+            { &Parser::state_13, &Parser::gotof_13, false, false },
+            { &Parser::state_14, &Parser::gotof_14, false, false },
+            { &Parser::state_15, &Parser::gotof_15, false, false },
+            { &Parser::state_16, &Parser::gotof_16, false, true },
+            { &Parser::state_17, &Parser::gotof_17, false, false },
+            { &Parser::state_18, &Parser::gotof_18, false, true },
+            { &Parser::state_19, &Parser::gotof_19, false, false },
+            { &Parser::state_20, &Parser::gotof_20, false, true },
+            { &Parser::state_21, &Parser::gotof_21, false, false },
+            { &Parser::state_22, &Parser::gotof_22, false, true },
+            { &Parser::state_23, &Parser::gotof_23, false, true },
+            { &Parser::state_24, &Parser::gotof_24, false, true },
+            { &Parser::state_25, &Parser::gotof_25, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace calc
+
+#endif // #ifndef RECOVERY1_RAW_PROF_IPP_
+
@@ -0,0 +1,889 @@
+#ifndef RECOVERY1_STL_IPP_
+#define RECOVERY1_STL_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+
+namespace calc {
+
+enum Token {
+    token_eof,
+    token_error,
+    token_LParen,
+    token_Minus,
+    token_NewLine,
+    token_Number,
+    token_Plus,
+    token_RParen,
+    token_Slash,
+    token_Star,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_error",
+        "token_LParen",
+        "token_Minus",
+        "token_NewLine",
+        "token_Number",
+        "token_Plus",
+        "token_RParen",
+        "token_Slash",
+        "token_Star",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { gap_ = 0; }
+
+    void rollback_tmp() {
+        gap_ = stack_.size();
+        tmp_.clear();
+    }
+
+    void commit_tmp() {
+        // may throw
+        stack_.reserve(gap_ + tmp_.size());
+	   
+        // expect not to throw
+        stack_.erase(stack_.begin()+ gap_, stack_.end());
+        stack_.insert(stack_.end(), tmp_.begin(), tmp_.end());
+        tmp_.clear();
+    }
+    bool push(const T& f) {
+        if (StackSize != 0 &&
+            int(StackSize) <= int(stack_.size() + tmp_.size())) {
+            return false;
+        }
+        tmp_.push_back(f);
+        return true;
+    }
+	   
+    void pop(size_t n) {
+        if (tmp_.size() < n) {
+            n -= tmp_.size();
+            tmp_.clear();
+            gap_ -= n;
+        } else {
+            tmp_.erase(tmp_.end() - n, tmp_.end());
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (!tmp_.empty()) {
+            return tmp_.back();
+        } else {
+            return stack_[gap_ - 1];
+        }
+    }
+	   
+    const T& get_arg(size_t base, size_t index) {
+        size_t n = tmp_.size();
+        if (base - index <= n) {
+            return tmp_[n - (base - index)];
+        } else {
+            return stack_[gap_ - (base - n) + index];
+        }
+    }
+	   
+    void clear() {
+        stack_.clear();
+        tmp_.clear();
+        gap_ = 0; 
+    }
+	   
+    bool empty() const {
+        if (!tmp_.empty()) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+	   
+    size_t depth() const {
+        return gap_ + tmp_.size();
+    }
+	   
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return tmp_[index - gap_];
+        } else {
+            return stack_[index];
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    std::vector<T> stack_;
+    std::vector<T> tmp_;
+    size_t gap_;
+	   
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 0>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_AddExp,
+        Nonterminal_Input,
+        Nonterminal_Line,
+        Nonterminal_MulExp,
+        Nonterminal_PrimExp,
+        Nonterminal_UnaryExp,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[26][2] = {
+            { 62, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 63, 0 },
+            { 88, 0 },
+            { 63, 0 },
+            { 16, 0 },
+            { 63, 0 },
+            { 44, 0 },
+            { 216, 3 },
+            { 200, 0 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 44, 0 },
+            { 216, 3 },
+            { 216, 3 },
+            { 216, 3 },
+            { 216, 3 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() {
+        rollback_tmp_stack();
+        return int(stack_top()->entry - entry(0));
+    }
+
+    bool expected(token_type token) {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+    void recover(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while(!stack_top()->entry->handle_error) {
+            pop_stack(1);
+            if (stack_.empty()) {
+                error_ = true;
+                return;
+            }
+        }
+        // post error_token;
+        while ((this->*(stack_top()->entry->state))(token_error, value_type()));
+        commit_tmp_stack();
+        // repost original token
+        // if it still causes error, discard it;
+        while ((this->*(stack_top()->entry->state))(token, value));
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        }
+        if (token != token_eof) {
+            error_ = false;
+        }
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_DoLine1(Nonterminal nonterminal, int base) {
+        int r = sa_.DoLine1();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLine2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoLine2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoLine3(Nonterminal nonterminal, int base) {
+        int r = sa_.DoLine3();
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoAddExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoAddExp2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoAddExp3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoAddExp3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoMulExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp2(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoMulExp2(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoMulExp3(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DoMulExp3(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoUnaryExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoUnaryExp2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoUnaryExp2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExp1(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoPrimExp1(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DoPrimExp2(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.DoPrimExp2(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_error:
+            // shift
+            push_stack(/*state*/ 7, value);
+            return false;
+        case token_LParen:
+            // shift
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_NewLine:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 5;
+        case Nonterminal_Input: return 1;
+        case Nonterminal_Line: return 3;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_error:
+            // shift
+            push_stack(/*state*/ 7, value);
+            return false;
+        case token_LParen:
+            // shift
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_NewLine:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 5;
+        case Nonterminal_Line: return 2;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            return call_nothing(Nonterminal_Input, /*pop*/ 2);
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            return call_nothing(Nonterminal_Input, /*pop*/ 1);
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            return call_0_DoLine1(Nonterminal_Line, /*pop*/ 1);
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Minus:
+            // shift
+            push_stack(/*state*/ 14, value);
+            return false;
+        case token_NewLine:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        case token_Plus:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            return call_0_DoLine2(Nonterminal_Line, /*pop*/ 2, 0);
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        switch(token) {
+        case token_NewLine:
+            // shift
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+        case token_error:
+        case token_LParen:
+        case token_Minus:
+        case token_NewLine:
+        case token_Number:
+            // reduce
+            return call_0_DoLine3(Nonterminal_Line, /*pop*/ 2);
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_9(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LParen:
+            // shift
+            push_stack(/*state*/ 9, value);
+            return false;
+        case token_Minus:
+            // shift
+            push_stack(/*state*/ 21, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_9(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_AddExp: return 11;
+        case Nonterminal_MulExp: return 10;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExp1(Nonterminal_AddExp, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_11(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Minus:
+            // shift
+            push_stack(/*state*/ 14, value);
+            return false;
+        case token_Plus:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_RParen:
+            // shift
+            push_stack(/*state*/ 25, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_12(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_MulExp: return 13;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_13(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExp2(Nonterminal_AddExp, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_14(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_MulExp: return 15;
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_15(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Slash:
+            // shift
+            push_stack(/*state*/ 19, value);
+            return false;
+        case token_Star:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            // reduce
+            return call_0_DoAddExp3(Nonterminal_AddExp, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_16(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExp1(Nonterminal_MulExp, /*pop*/ 1, 0);
+    }
+
+    int gotof_17(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 18;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_18(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExp2(Nonterminal_MulExp, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_19(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 20;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_20(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoMulExp3(Nonterminal_MulExp, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_21(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_PrimExp: return 22;
+        case Nonterminal_UnaryExp: return 23;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_22(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExp1(Nonterminal_UnaryExp, /*pop*/ 1, 0);
+    }
+
+    bool state_23(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoUnaryExp2(Nonterminal_UnaryExp, /*pop*/ 2, 1);
+    }
+
+    bool state_24(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExp1(Nonterminal_PrimExp, /*pop*/ 1, 0);
+    }
+
+    bool state_25(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DoPrimExp2(Nonterminal_PrimExp, /*pop*/ 3, 1);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, true, false },
+            { &Parser::state_1, &Parser::gotof_1, true, false },
+            { &Parser::state_2, &Parser::gotof_2, true, false },
+            { &Parser::state_3, &Parser::gotof_2, true, false },
+            { &Parser::state_4, &Parser::gotof_2, true, false },
+            { &Parser::state_5, &Parser::gotof_2, false, false },
+            { &Parser::state_6, &Parser::gotof_2, true, false },
+            { &Parser::state_7, &Parser::gotof_2, false, false },
+            { &Parser::state_8, &Parser::gotof_2, true, false },
+            { &Parser::state_9, &Parser::gotof_9, false, false },
+            { &Parser::state_10, &Parser::gotof_2, false, false },
+            { &Parser::state_11, &Parser::gotof_2, false, false },
+            { &Parser::state_9, &Parser::gotof_12, false, false },
+            { &Parser::state_13, &Parser::gotof_2, false, false },
+            { &Parser::state_9, &Parser::gotof_14, false, false },
+            { &Parser::state_15, &Parser::gotof_2, false, false },
+            { &Parser::state_16, &Parser::gotof_2, false, true },
+            { &Parser::state_9, &Parser::gotof_17, false, false },
+            { &Parser::state_18, &Parser::gotof_2, false, true },
+            { &Parser::state_9, &Parser::gotof_19, false, false },
+            { &Parser::state_20, &Parser::gotof_2, false, true },
+            { &Parser::state_9, &Parser::gotof_21, false, false },
+            { &Parser::state_22, &Parser::gotof_2, false, true },
+            { &Parser::state_23, &Parser::gotof_2, false, true },
+            { &Parser::state_24, &Parser::gotof_2, false, true },
+            { &Parser::state_25, &Parser::gotof_2, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace calc
+
+#endif // #ifndef RECOVERY1_STL_IPP_
+
@@ -0,0 +1,93 @@
+// incremental reparse sample
+//   input: the text on the first line, followed by edits
+//   "begin end replacement" (one per line)
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cctype>
+#include "checkpoint0.ipp"
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int Add(int x, int y) { return x + y; }
+    int Identity(int x) { return x; }
+
+};
+
+typedef checkpoint::Parser<int, SemanticAction> parser_type;
+
+// posts tokens of text from offset until the parser stops,
+// returns the number of tokens posted
+int parse(parser_type& parser, const std::string& text, size_t offset) {
+    int count = 0;
+    for (;;) {
+        while (offset < text.size() && isspace(text[offset])) { offset++; }
+
+        checkpoint::Token token;
+        int v = 0;
+        size_t b = offset;
+        if (text.size() <= offset) {
+            token = checkpoint::token_eof;
+        } else if (text[offset] == '+') {
+            token = checkpoint::token_Plus;
+            offset++;
+        } else if (isdigit(text[offset])) {
+            token = checkpoint::token_Number;
+            while (offset < text.size() && isdigit(text[offset])) {
+                v = v * 10 + text[offset++] - '0';
+            }
+        } else {
+            std::cerr << "unexpected char: " << text[offset] << std::endl;
+            exit(1);
+        }
+
+        count++;
+        if (parser.post_at(b, token, v)) { break; }
+    }
+    return count;
+}
+
+void report(parser_type& parser, int count) {
+    int v;
+    std::cout << "tokens: " << count
+              << (parser.converged() ? " (converged)" : "");
+    if (!parser.error() && parser.accept(v)) {
+        std::cout << ", result: " << v << std::endl;
+    } else {
+        std::cout << ", error" << std::endl;
+    }
+}
+
+int main(int, char**)
+{
+    std::string text;
+    std::getline(std::cin, text);
+
+    SemanticAction sa;
+    parser_type parser(sa);
+    parser.set_checkpoint_interval(4);
+
+    report(parser, parse(parser, text, 0));
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        std::istringstream is(line);
+        size_t begin, end;
+        std::string replacement;
+        is >> begin >> end;
+        std::getline(is, replacement);
+        if (!replacement.empty()) { replacement.erase(0, 1); }
+
+        text.replace(begin, end - begin, replacement);
+        size_t offset = parser.edit(
+            begin, end, std::ptrdiff_t(replacement.size()) - std::ptrdiff_t(end - begin));
+        report(parser, parse(parser, text, offset));
+    }
+
+    return 0;
+}
@@ -0,0 +1,88 @@
+// context sensitive scanning sample
+//   "a * b;" is a declaration if a names a type and a multiplication
+//   otherwise. the scanner classifies a typedef name as TypeName only
+//   where the parser expects one, so "typedef a;" and "a a;" need no
+//   rescan.
+
+#include <cctype>
+#include <iostream>
+#include <set>
+#include <string>
+#include "context0.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(std::string& x, const std::string& y) { x = y; }
+    void upcast(std::string& x, const std::string& y) { x = y; }
+
+    std::string First(const std::string& x) { return x; }
+    std::string Next(const std::string&, const std::string& y) { return y; }
+    std::string Typedef(const std::string& x) {
+        std::cout << "typedef " << x << std::endl;
+        return x;
+    }
+    std::string Declare(const std::string& t, const std::string& x) {
+        std::cout << "declare " << x << ": " << t << std::endl;
+        return x;
+    }
+    std::string DeclarePointer(const std::string& t, const std::string& x) {
+        std::cout << "declare " << x << ": pointer to " << t << std::endl;
+        return x;
+    }
+    std::string Expression(const std::string& x) {
+        std::cout << "expression " << x << std::endl;
+        return x;
+    }
+    std::string Identity(const std::string& x) { return x; }
+    std::string Multiply(const std::string& x, const std::string& y) {
+        return "(" + x + " * " + y + ")";
+    }
+
+};
+
+typedef context::Parser<std::string, SemanticAction> parser_type;
+
+int main(int, char**) {
+    SemanticAction sa;
+    parser_type parser(sa);
+
+    std::set<std::string> typedefs;
+    context::Token last = context::token_eof;
+
+    std::istreambuf_iterator<char> b(std::cin);
+    std::istreambuf_iterator<char> e;
+    for (;;) {
+        while (b != e && isspace(*b)) { ++b; }
+
+        context::Token token;
+        std::string s;
+        if (b == e) {
+            token = context::token_eof;
+        } else if (isalpha(*b)) {
+            while (b != e && isalnum(*b)) { s += *b++; }
+            if (s == "typedef") {
+                token = context::token_Typedef;
+            } else if (typedefs.count(s) &&
+                       parser.expected(context::token_TypeName)) {
+                token = context::token_TypeName;
+            } else {
+                token = context::token_Ident;
+                if (last == context::token_Typedef) { typedefs.insert(s); }
+            }
+        } else {
+            char c = *b++;
+            switch (c) {
+                case '*': token = context::token_Star; break;
+                case ';': token = context::token_Semicolon; break;
+                default:
+                    std::cout << "unexpected char " << c << std::endl;
+                    return 1;
+            }
+        }
+
+        last = token;
+        if (parser.post(token, s)) { break; }
+    }
+    return parser.error() ? 1 : 0;
+}
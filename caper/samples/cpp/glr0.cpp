@@ -0,0 +1,117 @@
+// A X Y / B X Z cannot be told apart by one token of lookahead,
+// so the parser forks at the reduce/reduce conflict after 'Letter'.
+
+#include <iostream>
+#include <cctype>
+#include "glr0.ipp"
+
+class unexpected_char : public std::exception {};
+
+template <class It>
+class scanner {
+public:
+    typedef int char_type;
+    int eof() { return std::char_traits<char_type>::eof(); }
+
+public:
+    scanner(It b, It e) : b_(b), e_(e), c_(b) {}
+
+    glr::Token get(int& v) {
+        int c;
+        do {
+            c = getc();
+        } while (isspace(c));
+
+        v = c;
+        switch (c) {
+            case 'x': return glr::token_X;
+            case 'y': return glr::token_Y;
+            case 'z': return glr::token_Z;
+            case ';': return glr::token_Semicolon;
+        }
+        if (c == eof()) { return glr::token_eof; }
+        if (isalpha(c)) { return glr::token_Letter; }
+
+        std::cerr << char(c) << std::endl;
+        throw unexpected_char();
+    }
+
+private:
+    char_type getc() {
+        if (c_ == e_) { return eof(); }
+        return *c_++;
+    }
+
+private:
+    It              b_;
+    It              e_;
+    It              c_;
+
+};
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void downcast(char& x, int y) { x = char(y); }
+    void upcast(int& x, int y) { x = y; }
+
+    int Document(int n) {
+        std::cout << "Document: " << n << "\n";
+        return n;
+    }
+    int FirstSentence(int) {
+        return 1;
+    }
+    int NextSentence(int n, int) {
+        return n + 1;
+    }
+    int MakeXY(char c) {
+        std::cout << "XY: " << c << "\n";
+        return 0;
+    }
+    int MakeXZ(char c) {
+        std::cout << "XZ: " << c << "\n";
+        return 0;
+    }
+    char MakeA(char c) {
+        std::cout << "A: " << c << "\n";
+        return c;
+    }
+    char MakeB(char c) {
+        std::cout << "B: " << c << "\n";
+        return c;
+    }
+
+};
+
+int main(int, char**)
+{
+    typedef std::istreambuf_iterator<char> is_iterator;
+    is_iterator b(std::cin);
+    is_iterator e;
+    scanner<is_iterator> s(b, e);
+
+    SemanticAction sa;
+    glr::Parser<int, SemanticAction> parser(sa);
+
+    glr::Token token;
+    for(;;) {
+        int v;
+        token = s.get(v);
+        if (parser.post(token, v)) { break; }
+    }
+
+    if (parser.error()) {
+        std::cerr << "error occured: " << glr::token_label(token) << std::endl;
+        exit(1);
+    }
+
+    int v;
+    if (parser.accept(v)) {
+        std::cout << "accepted\n";
+        std::cout << v << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cctype>
+#include "glr1.ipp"
+
+class unexpected_char : public std::exception {};
+
+template <class It>
+class scanner {
+public:
+    typedef int char_type;
+    int eof() { return std::char_traits<char_type>::eof(); }
+
+public:
+    scanner(It b, It e) : b_(b), e_(e), c_(b), unget_(eof()) {}
+
+    glr1::Token get(int& v) {
+        int c;
+        do {
+            c = getc();
+        } while (isspace(c));
+
+        if (c == eof()) { return glr1::token_eof; }
+        if (c == '+') { return glr1::token_Plus; }
+        if (isdigit(c)) {
+            v = 0;
+            while (isdigit(c)) {
+                v = v * 10 + c - '0';
+                c = getc();
+            }
+            unget_ = c;
+            return glr1::token_Number;
+        }
+
+        std::cerr << char(c) << std::endl;
+        throw unexpected_char();
+    }
+
+private:
+    char_type getc() {
+        int c = unget_;
+        if (c != eof()) {
+            unget_ = eof();
+            return c;
+        }
+        if (c_ == e_) { return eof(); }
+        return *c_++;
+    }
+
+private:
+    It              b_;
+    It              e_;
+    It              c_;
+    int             unget_;
+
+};
+
+// values are indices of the printed subtrees
+struct SemanticAction {
+    std::vector<std::string> trees;
+
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int Add(int x, int y) {
+        trees.push_back("(" + trees[x] + "+" + trees[y] + ")");
+        return int(trees.size()) - 1;
+    }
+    int Id(int n) {
+        trees.push_back(std::to_string(n));
+        return int(trees.size()) - 1;
+    }
+
+};
+
+int main(int, char**)
+{
+    typedef std::istreambuf_iterator<char> is_iterator;
+    is_iterator b(std::cin);
+    is_iterator e;
+    scanner<is_iterator> s(b, e);
+
+    SemanticAction sa;
+    glr1::Parser<int, SemanticAction> parser(sa);
+
+    glr1::Token token;
+    for(;;) {
+        int v;
+        token = s.get(v);
+        if (parser.post(token, v)) { break; }
+    }
+
+    if (parser.error()) {
+        std::cerr << "error occured: " << glr1::token_label(token) << std::endl;
+        exit(1);
+    }
+
+    int v;
+    if (parser.accept(v)) {
+        std::cout << sa.trees[v] << std::endl;
+        std::cout << sa.trees.size() << " actions" << std::endl;
+    }
+
+    return 0;
+}
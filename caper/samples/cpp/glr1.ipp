@@ -0,0 +1,749 @@
+#ifndef GLR1_IPP_
+#define GLR1_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <deque>
+
+namespace glr1 {
+
+enum Token {
+    token_eof,
+    token_Number,
+    token_Plus,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_Number",
+        "token_Plus",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { gap_ = 0; }
+
+    void rollback_tmp() {
+        gap_ = stack_.size();
+        tmp_.clear();
+    }
+
+    void commit_tmp() {
+        // may throw
+        stack_.reserve(gap_ + tmp_.size());
+	   
+        // expect not to throw
+        stack_.erase(stack_.begin()+ gap_, stack_.end());
+        stack_.insert(stack_.end(), tmp_.begin(), tmp_.end());
+        tmp_.clear();
+    }
+    bool push(const T& f) {
+        if (StackSize != 0 &&
+            int(StackSize) <= int(stack_.size() + tmp_.size())) {
+            return false;
+        }
+        tmp_.push_back(f);
+        return true;
+    }
+	   
+    void pop(size_t n) {
+        if (tmp_.size() < n) {
+            n -= tmp_.size();
+            tmp_.clear();
+            gap_ -= n;
+        } else {
+            tmp_.erase(tmp_.end() - n, tmp_.end());
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (!tmp_.empty()) {
+            return tmp_.back();
+        } else {
+            return stack_[gap_ - 1];
+        }
+    }
+
+    const T& committed_top() const {
+        assert(!stack_.empty());
+        return stack_.back();
+    }
+	   
+    const T& get_arg(size_t base, size_t index) {
+        size_t n = tmp_.size();
+        if (base - index <= n) {
+            return tmp_[n - (base - index)];
+        } else {
+            return stack_[gap_ - (base - n) + index];
+        }
+    }
+	   
+    void clear() {
+        stack_.clear();
+        tmp_.clear();
+        gap_ = 0; 
+    }
+	   
+    bool empty() const {
+        if (!tmp_.empty()) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+	   
+    size_t depth() const {
+        return gap_ + tmp_.size();
+    }
+	   
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return tmp_[index - gap_];
+        } else {
+            return stack_[index];
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    std::vector<T> stack_;
+    std::vector<T> tmp_;
+    size_t gap_;
+	   
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 0>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_Expr,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        glr_clear();
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        if (glr_active_) {
+            glr_post(token, value);
+        } else {
+            while ((this->*(stack_top()->entry->state))(token, value))
+                ; // may throw
+            reduce_consistent(token, value);
+        }
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[5][1] = {
+            { 2 },
+            { 5 },
+            { 2 },
+            { 5 },
+            { 5 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() const {
+        return int(stack_.committed_top().entry - entry(0));
+    }
+
+    bool expected(token_type token) const {
+        if (glr_active_) {
+            // any of the stacks
+            for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+                if (expected(glr_heads_[i]->state, token)) { return true; }
+            }
+            return false;
+        }
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_Add(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.Add(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Id(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Id(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    // GLR support
+    //   when a conflicted action is met, the parser leaves the deterministic
+    //   stack as is and continues on a graph-structured stack (GSS).
+    //   reductions are recorded in a shared packed forest and replayed on
+    //   the deterministic stack (with semantic actions) as soon as the GSS
+    //   has a single head and a single path down to the deterministic stack.
+    //   among local ambiguities, the first derivation found wins.
+    //   a reduction enumerates every path of its length down from the
+    //   head, so highly ambiguous input is polynomial but steep: for
+    //   "E : E + E | n" (samples/grammar/glr1.cpg) time grows about n^3.6
+    //   and memory about n^3 in the number of terms (0.8s for 100 terms,
+    //   10s for 200).
+    struct glr_node;
+    struct glr_forest;
+
+    struct glr_link {
+        glr_node*   prev;   // 0 = stack frame below (materialized lazily)
+        glr_forest* forest;
+    };
+
+    struct glr_node {
+        int                     state;
+        int                     frame;  // index of stack frame, or -1
+        std::vector<glr_link>   links;
+    };
+
+    struct glr_forest {
+        int                         rule;   // -1 = leaf (shifted value)
+        int                         state;
+        value_type                  value;
+        std::vector<glr_forest*>    children;
+        glr_forest*                 alternative;
+    };
+
+    struct glr_reduction {
+        glr_node*   node;
+        int         rule;
+        glr_node*   via_node;   // reduce only along paths via this link
+        int         via_link;
+    };
+
+    struct glr_rule_entry {
+        Nonterminal nonterminal;
+        int         length;
+    };
+
+    typedef std::pair<glr_node*, std::vector<glr_forest*> > glr_path;
+
+    bool                    glr_active_;
+    int                     glr_base_;
+    std::deque<glr_node>    glr_nodes_;
+    std::deque<glr_forest>  glr_forests_;
+    std::vector<glr_node*>  glr_heads_;
+    std::vector<glr_node*>  glr_frame_nodes_;
+
+    void glr_clear() {
+        glr_active_ = false;
+        glr_base_ = 0;
+        glr_nodes_.clear();
+        glr_forests_.clear();
+        glr_heads_.clear();
+        glr_frame_nodes_.clear();
+    }
+
+    glr_node* glr_new_node(int state, int frame) {
+        glr_nodes_.push_back(glr_node());
+        glr_node* n = &glr_nodes_.back();
+        n->state = state;
+        n->frame = frame;
+        return n;
+    }
+
+    glr_forest* glr_new_forest(int rule, int state, const value_type& value) {
+        glr_forests_.push_back(glr_forest());
+        glr_forest* f = &glr_forests_.back();
+        f->rule = rule;
+        f->state = state;
+        f->value = value;
+        f->alternative = 0;
+        return f;
+    }
+
+    glr_node* glr_frame_node(int index) {
+        if (glr_frame_nodes_[index]) { return glr_frame_nodes_[index]; }
+        stack_frame& f = stack_.nth(index);
+        glr_node* n = glr_new_node(int(f.entry - entry(0)), index);
+        if (0 < index) {
+            glr_link l = { 0, glr_new_forest(-1, n->state, f.value) };
+            n->links.push_back(l);
+        }
+        glr_frame_nodes_[index] = n;
+        return n;
+    }
+
+    glr_node* glr_prev(glr_node* n, size_t i) {
+        if (!n->links[i].prev) {
+            n->links[i].prev = glr_frame_node(n->frame - 1);
+        }
+        return n->links[i].prev;
+    }
+
+    glr_node* glr_find(const std::vector<glr_node*>& v, int state) {
+        for (size_t i = 0 ; i < v.size() ; i++) {
+            if (v[i]->state == state) { return v[i]; }
+        }
+        return 0;
+    }
+
+    bool glr_start(token_type token, const value_type& value) {
+        glr_clear();
+        glr_active_ = true;
+        int depth = int(stack_.depth());
+        glr_base_ = depth - 1;
+        glr_frame_nodes_.resize(depth, 0);
+
+        // the root is a copy of the top frame,
+        // so that frame nodes never get additional links
+        stack_frame& top = stack_.nth(depth - 1);
+        glr_node* root = glr_new_node(int(top.entry - entry(0)), -1);
+        if (1 < depth) {
+            glr_link l = {
+                glr_frame_node(depth - 2),
+                glr_new_forest(-1, root->state, top.value) };
+            root->links.push_back(l);
+        }
+        glr_heads_.push_back(root);
+
+        glr_post(token, value);
+        return false;
+    }
+
+    void glr_post(token_type token, const value_type& value) {
+        // reduce
+        std::vector<glr_reduction> queue;
+        for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+            glr_enqueue(queue, glr_heads_[i], token, 0, -1);
+        }
+        while (!queue.empty()) {
+            glr_reduction r = queue.back();
+            queue.pop_back();
+            glr_reduce_paths(queue, r, token);
+        }
+
+        // shift / accept
+        glr_node* accepted = 0;
+        std::vector<glr_node*> next;
+        for (size_t i = 0 ; i < glr_heads_.size() ; i++) {
+            glr_node* head = glr_heads_[i];
+            const int* codes;
+            int n = glr_actions(head->state, token, codes);
+            for (int j = 0 ; j < n ; j++) {
+                if (codes[j] == 2 && !accepted) { accepted = head; }
+                if ((codes[j] & 3) != 0) { continue; }
+
+                int dest = codes[j] >> 2;
+                glr_node* w = glr_find(next, dest);
+                glr_link l = { head, 0 };
+                if (w) {
+                    l.forest = w->links[0].forest;
+                } else {
+                    w = glr_new_node(dest, -1);
+                    l.forest = glr_new_forest(-1, dest, value);
+                    next.push_back(w);
+                }
+                w->links.push_back(l);
+            }
+        }
+
+        if (accepted) {
+            glr_collapse(accepted);
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return;
+        }
+        if (next.empty()) {
+            glr_clear();
+            sa_.syntax_error();
+            error_ = true;
+            return;
+        }
+
+        glr_heads_.swap(next);
+        if (glr_heads_.size() == 1 && glr_linear(glr_heads_[0])) {
+            glr_collapse(glr_heads_[0]);
+        }
+    }
+
+    void glr_enqueue(std::vector<glr_reduction>& queue, glr_node* node,
+                     token_type token, glr_node* via_node, int via_link) {
+        const int* codes;
+        int n = glr_actions(node->state, token, codes);
+        for (int j = 0 ; j < n ; j++) {
+            if ((codes[j] & 3) != 1) { continue; }
+            int rule = codes[j] >> 2;
+            if (via_node && glr_rule(rule).length == 0) { continue; }
+            glr_reduction r = { node, rule, via_node, via_link };
+            queue.push_back(r);
+        }
+    }
+
+    void glr_reduce_paths(std::vector<glr_reduction>& queue,
+                          const glr_reduction& r, token_type token) {
+        const glr_rule_entry& re = glr_rule(r.rule);
+
+        std::vector<glr_path> paths;
+        std::vector<glr_forest*> children;
+        glr_collect_paths(
+            paths, children, r.node, re.length, r, r.via_node == 0);
+
+        for (size_t i = 0 ; i < paths.size() ; i++) {
+            glr_node* u = paths[i].first;
+            int dest = (this->*(entry(u->state)->gotof))(re.nonterminal);
+            glr_forest* f = glr_new_forest(r.rule, dest, value_type());
+            f->children.swap(paths[i].second);
+
+            glr_node* w = glr_find(glr_heads_, dest);
+            if (!w) {
+                w = glr_new_node(dest, -1);
+                glr_link l = { u, f };
+                w->links.push_back(l);
+                glr_heads_.push_back(w);
+                glr_enqueue(queue, w, token, 0, -1);
+                continue;
+            }
+
+            int k = -1;
+            for (size_t j = 0 ; j < w->links.size() ; j++) {
+                if (w->links[j].prev == u && 0 <= w->links[j].forest->rule) {
+                    k = int(j);
+                    break;
+                }
+            }
+            if (0 <= k) {
+                // local ambiguity: pack into the existing derivation
+                glr_forest* g = w->links[k].forest;
+                f->alternative = g->alternative;
+                g->alternative = f;
+            } else {
+                // new link: reductions through it must be done again
+                glr_link l = { u, f };
+                w->links.push_back(l);
+                int index = int(w->links.size()) - 1;
+                for (size_t j = 0 ; j < glr_heads_.size() ; j++) {
+                    glr_enqueue(queue, glr_heads_[j], token, w, index);
+                }
+            }
+        }
+    }
+
+    void glr_collect_paths(std::vector<glr_path>& paths,
+                           std::vector<glr_forest*>& children,
+                           glr_node* node, int n,
+                           const glr_reduction& r, bool via) {
+        if (n == 0) {
+            if (via) {
+                paths.push_back(
+                    glr_path(
+                        node,
+                        std::vector<glr_forest*>(
+                            children.rbegin(), children.rend())));
+            }
+            return;
+        }
+        for (size_t i = 0 ; i < node->links.size() ; i++) {
+            glr_node* prev = glr_prev(node, i);
+            children.push_back(node->links[i].forest);
+            glr_collect_paths(
+                paths, children, prev, n - 1, r,
+                via || (node == r.via_node && int(i) == r.via_link));
+            children.pop_back();
+        }
+    }
+
+    bool glr_linear(glr_node* n) {
+        while (n->frame < 0 && !n->links.empty()) {
+            if (n->links.size() != 1) { return false; }
+            n = n->links[0].prev;
+        }
+        return true;
+    }
+
+    void glr_collapse(glr_node* head) {
+        // choose a path down to the deterministic stack
+        std::vector<glr_forest*> chain;
+        glr_node* n = head;
+        while (n->frame < 0 && !n->links.empty()) {
+            chain.push_back(n->links[0].forest);
+            n = glr_prev(n, 0);
+        }
+        int base = n->frame < 0 ? glr_base_ : n->frame;
+
+        // replay the derivation with semantic actions
+        glr_active_ = false;
+        stack_.pop(stack_.depth() - (base + 1));
+        for (size_t i = chain.size() ; 0 < i ; i--) {
+            if (!glr_replay(chain[i - 1])) { break; }
+        }
+        glr_clear();
+    }
+
+    bool glr_replay(glr_forest* f) {
+        if (f->rule < 0) {
+            return push_stack(f->state, f->value);
+        }
+        for (size_t i = 0 ; i < f->children.size() ; i++) {
+            if (!glr_replay(f->children[i])) { return false; }
+        }
+        return glr_reduce(f->rule);
+    }
+
+    int glr_actions(int state, token_type token, const int*& codes) const {
+        static const int index[] = {
+            0, 3, 9, 12, 18, 24, 
+        };
+        static const int keys[] = { // token, begin, end
+            1, 0, 1, 0, 1, 2, 2, 2, 3, 1, 3, 4, 
+            0, 4, 5, 2, 5, 7, 0, 7, 8, 2, 8, 9, 
+        };
+        static const int actions[] = {
+            16, 2, 8, 16, 5, 8, 5, 9, 9, 
+        };
+        for (int i = index[state] ; i < index[state + 1] ; i += 3) {
+            if (keys[i] == int(token)) {
+                codes = &actions[keys[i + 1]];
+                return keys[i + 2] - keys[i + 1];
+            }
+        }
+        return 0;
+    }
+
+    const glr_rule_entry& glr_rule(int rule) const {
+        static const glr_rule_entry rules[] = {
+            { Nonterminal(0), 1 }, // $implicit_root
+            { Nonterminal_Expr, 3 },
+            { Nonterminal_Expr, 1 },
+        };
+        return rules[rule];
+    }
+
+    bool glr_reduce(int rule) {
+        switch (rule) {
+        case 1: return call_0_Add(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        case 2: return call_0_Id(Nonterminal_Expr, /*pop*/ 1, 0);
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 1;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_Plus:
+            // shift
+            push_stack(/*state*/ 2, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 3;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Plus:
+            // conflict
+            return glr_start(token, value);
+        default:
+            // reduce
+            return call_0_Add(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Id(Nonterminal_Expr, /*pop*/ 1, 0);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_0, &Parser::gotof_2, false, false },
+            { &Parser::state_3, &Parser::gotof_1, false, false },
+            { &Parser::state_4, &Parser::gotof_1, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace glr1
+
+#endif // #ifndef GLR1_IPP_
+
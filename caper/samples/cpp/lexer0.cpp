@@ -0,0 +1,74 @@
+// %lexer sample
+//   the generated Lexer feeds the parser through Parser::parse(),
+//   identifiers are mapped to variable slots while scanning
+
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+#include "lexer0.ipp"
+
+struct SemanticAction {
+    std::vector<int> variables;
+
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int First(int x) { return x; }
+    int Next(int, int y) { return y; }
+    int Let(int slot, int x) { variables[slot] = x; return x; }
+    int Print(int x) { std::cout << x << std::endl; return x; }
+    int MakeExpr(int x) { return x; }
+    int AddExpr(int x, int y) { return x + y; }
+    int SubExpr(int x, int y) { return x - y; }
+    int MakeTerm(int x) { return x; }
+    int MulTerm(int x, int y) { return x * y; }
+    int DivTerm(int x, int y) { return x / y; }
+    int Identity(int x) { return x; }
+    int Load(int slot) { return variables[slot]; }
+
+};
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    // token count by the standalone lexer
+    typedef std::string::const_iterator iterator;
+    lexer::Lexer<iterator> l(source.begin(), source.end());
+    lexer::Token token;
+    int count = 0;
+    while (l.get(token) && token != lexer::token_eof) { count++; }
+    std::cout << count << " tokens" << std::endl;
+
+    SemanticAction sa;
+    std::map<std::string, int> slots;
+    auto make_value = [&](lexer::Token token, iterator b, iterator e) -> int {
+        switch (token) {
+            case lexer::token_Number:
+                return std::stoi(std::string(b, e));
+            case lexer::token_Ident: {
+                std::string name(b, e);
+                if (slots.count(name) == 0) {
+                    slots[name] = int(sa.variables.size());
+                    sa.variables.push_back(0);
+                }
+                return slots[name];
+            }
+            default:
+                return 0;
+        }
+    };
+
+    lexer::Parser<int, SemanticAction> parser(sa);
+    iterator b = source.begin();
+    if (!parser.parse(b, iterator(source.end()), make_value)) {
+        std::cout << "error at offset " << (b - source.begin()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
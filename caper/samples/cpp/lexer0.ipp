@@ -0,0 +1,997 @@
+#ifndef LEXER0_IPP_
+#define LEXER0_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+
+namespace lexer {
+
+enum Token {
+    token_eof,
+    token_Add,
+    token_Assign,
+    token_Div,
+    token_Ident,
+    token_LParen,
+    token_Let,
+    token_Mul,
+    token_Number,
+    token_Print,
+    token_RParen,
+    token_Semicolon,
+    token_Sub,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_Add",
+        "token_Assign",
+        "token_Div",
+        "token_Ident",
+        "token_LParen",
+        "token_Let",
+        "token_Mul",
+        "token_Number",
+        "token_Print",
+        "token_RParen",
+        "token_Semicolon",
+        "token_Sub",
+    };
+    return labels[t];
+}
+
+// lexer tables
+//   state 0 is the dead state, state 1 the start state. bytes are
+//   mapped to classes first, the transitions are indexed by class.
+struct lexer_table {
+    static int next(int state, unsigned char c) {
+        static const unsigned char classes[256] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 1, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            1, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 6, 0, 7, 0, 8,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 10, 0, 11, 0, 0,
+            0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 12,
+            0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        };
+        static const unsigned char transitions[14 * 13] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 2, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+            0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 12,
+            13, 13, 0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        };
+        return transitions[state * 13 + classes[c]];
+    }
+
+    // the token, -2 for skipped patterns, -1 if not accepting
+    static int accept(int state) {
+        static const int accepts[14] = {
+            -1,
+            -1,
+            -2,
+            token_LParen,
+            token_RParen,
+            token_Mul,
+            token_Add,
+            token_Sub,
+            token_Div,
+            token_Number,
+            token_Semicolon,
+            token_Assign,
+            token_Ident,
+            -2,
+        };
+        return accepts[state];
+    }
+
+    // keywords are looked up by perfect hash on [b, e) after the token
+    // they collide with has matched
+    template <class It>
+    static Token keyword(Token token, It b, It e) {
+        switch (token) {
+        case token_Ident: {
+            static const char* const texts[3] = {
+                "let",
+                0,
+                "print",
+            };
+            static const Token tokens[3] = {
+                token_Let,
+                token_Ident,
+                token_Print,
+            };
+            return find(token, b, e, 2, 3, texts, tokens);
+        }
+        default:
+            return token;
+        }
+    }
+
+    // the token a keyword is taken for where it is not expected
+    static Token fallback(Token token) {
+        switch (token) {
+        case token_Let: return token_Ident;
+        case token_Print: return token_Ident;
+        default:
+            return token;
+        }
+    }
+
+    template <class It>
+    static Token find(Token token, It b, It e, unsigned multiplier,
+                      unsigned size, const char* const* texts,
+                      const Token* tokens) {
+        unsigned h = 0;
+        for (It i = b ; i != e ; ++i) { h++; }
+        for (It i = b ; i != e ; ++i) { h = h * multiplier + (unsigned char)*i; }
+        h %= size;
+        const char* p = texts[h];
+        if (!p) { return token; }
+        for (It i = b ; i != e ; ++i, ++p) {
+            if (*p == '\0' || *p != *i) { return token; }
+        }
+        return *p == '\0' ? tokens[h] : token;
+    }
+};
+
+// Lexer
+//   longest match over the %lexer patterns, ties go to the one declared
+//   first. It must be a forward iterator over char.
+template <class It>
+class Lexer {
+public:
+    Lexer(It b, It e) : b_(b), c_(b), e_(e) {}
+
+    // reads the next token, token_eof at the end of the input.
+    // returns false if no pattern matches at begin().
+    bool get(Token& token) {
+        for (;;) {
+            b_ = c_;
+            if (c_ == e_) {
+                token = token_eof;
+                return true;
+            }
+            int accept = -1;
+            int state = 1;
+            for (It i = c_ ; i != e_ ; ) {
+                state = lexer_table::next(state, (unsigned char)*i);
+                if (state == 0) { break; }
+                ++i;
+                int a = lexer_table::accept(state);
+                if (a != -1) {
+                    accept = a;
+                    c_ = i;
+                }
+            }
+            if (accept == -1) { return false; }
+            if (accept != -2) {
+                token = lexer_table::keyword(Token(accept), b_, c_);
+                return true;
+            }
+        }
+    }
+
+    // lexeme of the last token
+    It begin() const { return b_; }
+    It end() const { return c_; }
+
+private:
+    It  b_;
+    It  c_;
+    It  e_;
+
+};
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { gap_ = 0; }
+
+    void rollback_tmp() {
+        gap_ = stack_.size();
+        tmp_.clear();
+    }
+
+    void commit_tmp() {
+        // may throw
+        stack_.reserve(gap_ + tmp_.size());
+	   
+        // expect not to throw
+        stack_.erase(stack_.begin()+ gap_, stack_.end());
+        stack_.insert(stack_.end(), tmp_.begin(), tmp_.end());
+        tmp_.clear();
+    }
+    bool push(const T& f) {
+        if (StackSize != 0 &&
+            int(StackSize) <= int(stack_.size() + tmp_.size())) {
+            return false;
+        }
+        tmp_.push_back(f);
+        return true;
+    }
+	   
+    void pop(size_t n) {
+        if (tmp_.size() < n) {
+            n -= tmp_.size();
+            tmp_.clear();
+            gap_ -= n;
+        } else {
+            tmp_.erase(tmp_.end() - n, tmp_.end());
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (!tmp_.empty()) {
+            return tmp_.back();
+        } else {
+            return stack_[gap_ - 1];
+        }
+    }
+
+    const T& committed_top() const {
+        assert(!stack_.empty());
+        return stack_.back();
+    }
+	   
+    const T& get_arg(size_t base, size_t index) {
+        size_t n = tmp_.size();
+        if (base - index <= n) {
+            return tmp_[n - (base - index)];
+        } else {
+            return stack_[gap_ - (base - n) + index];
+        }
+    }
+	   
+    void clear() {
+        stack_.clear();
+        tmp_.clear();
+        gap_ = 0; 
+    }
+	   
+    bool empty() const {
+        if (!tmp_.empty()) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+	   
+    size_t depth() const {
+        return gap_ + tmp_.size();
+    }
+	   
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return tmp_[index - gap_];
+        } else {
+            return stack_[index];
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    std::vector<T> stack_;
+    std::vector<T> tmp_;
+    size_t gap_;
+	   
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 0>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_Expr,
+        Nonterminal_Factor,
+        Nonterminal_Program,
+        Nonterminal_Statement,
+        Nonterminal_Term,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // scans [b, e) with Lexer and posts the tokens, the values are made
+    // by f(token, lexeme begin, lexeme end). b is left after the last
+    // token read, or at the offending char on a lexical error.
+    // a keyword that is not expected in the current state is taken for
+    // the token it collides with (contextual keywords).
+    template <class It, class F>
+    bool parse(It& b, It e, F f) {
+        reset();
+        Lexer<It> lexer(b, e);
+        Token token;
+        do {
+            if (!lexer.get(token)) {
+                b = lexer.begin();
+                sa_.syntax_error();
+                error_ = true;
+                return false;
+            }
+            b = lexer.end();
+            if (!expected(token)) {
+                Token t = lexer_table::fallback(token);
+                if (t != token && expected(t)) { token = t; }
+            }
+        } while (!post(token, f(token, lexer.begin(), lexer.end())));
+        return !error_;
+    }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[27][2] = {
+            { 64, 2 },
+            { 65, 2 },
+            { 65, 2 },
+            { 65, 2 },
+            { 16, 0 },
+            { 4, 0 },
+            { 48, 1 },
+            { 2, 24 },
+            { 65, 2 },
+            { 48, 1 },
+            { 2, 24 },
+            { 65, 2 },
+            { 48, 1 },
+            { 138, 28 },
+            { 2, 20 },
+            { 48, 1 },
+            { 138, 28 },
+            { 48, 1 },
+            { 138, 28 },
+            { 138, 28 },
+            { 48, 1 },
+            { 138, 28 },
+            { 48, 1 },
+            { 138, 28 },
+            { 138, 28 },
+            { 138, 28 },
+            { 138, 28 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() const {
+        return int(stack_.committed_top().entry - entry(0));
+    }
+
+    bool expected(token_type token) const {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_First(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.First(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Next(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.Next(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Let(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.Let(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Print(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Print(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeExpr(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.MakeExpr(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_AddExpr(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.AddExpr(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_SubExpr(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.SubExpr(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MakeTerm(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.MakeTerm(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_MulTerm(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.MulTerm(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_DivTerm(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.DivTerm(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Identity(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Identity(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Load(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Load(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Let:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Print:
+            // shift
+            push_stack(/*state*/ 9, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Program: return 1;
+        case Nonterminal_Statement: return 2;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_Let:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Print:
+            // shift
+            push_stack(/*state*/ 9, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Statement: return 3;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        // reduce
+        return call_0_First(Nonterminal_Program, /*pop*/ 1, 0);
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Next(Nonterminal_Program, /*pop*/ 2, 0, 1);
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Ident:
+            // shift
+            push_stack(/*state*/ 5, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Assign:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Ident:
+            // shift
+            push_stack(/*state*/ 25, value);
+            return false;
+        case token_LParen:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 24, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_6(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 7;
+        case Nonterminal_Factor: return 19;
+        case Nonterminal_Term: return 13;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Add:
+            // shift
+            push_stack(/*state*/ 15, value);
+            return false;
+        case token_Semicolon:
+            // shift
+            push_stack(/*state*/ 8, value);
+            return false;
+        case token_Sub:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Let(Nonterminal_Statement, /*pop*/ 5, 1, 3);
+    }
+
+    int gotof_9(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 10;
+        case Nonterminal_Factor: return 19;
+        case Nonterminal_Term: return 13;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Add:
+            // shift
+            push_stack(/*state*/ 15, value);
+            return false;
+        case token_Semicolon:
+            // shift
+            push_stack(/*state*/ 11, value);
+            return false;
+        case token_Sub:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_11(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Print(Nonterminal_Statement, /*pop*/ 3, 1);
+    }
+
+    int gotof_12(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 14;
+        case Nonterminal_Factor: return 19;
+        case Nonterminal_Term: return 13;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_13(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 22, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        default:
+            // reduce
+            return call_0_MakeExpr(Nonterminal_Expr, /*pop*/ 1, 0);
+        }
+    }
+
+    bool state_14(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Add:
+            // shift
+            push_stack(/*state*/ 15, value);
+            return false;
+        case token_RParen:
+            // shift
+            push_stack(/*state*/ 26, value);
+            return false;
+        case token_Sub:
+            // shift
+            push_stack(/*state*/ 17, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_15(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 19;
+        case Nonterminal_Term: return 16;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_16(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 22, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        default:
+            // reduce
+            return call_0_AddExpr(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    int gotof_17(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 19;
+        case Nonterminal_Term: return 18;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_18(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 22, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 20, value);
+            return false;
+        default:
+            // reduce
+            return call_0_SubExpr(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+    }
+
+    bool state_19(token_type token, const value_type& value) {
+        // reduce
+        return call_0_MakeTerm(Nonterminal_Term, /*pop*/ 1, 0);
+    }
+
+    int gotof_20(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 21;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_21(token_type token, const value_type& value) {
+        // reduce
+        return call_0_MulTerm(Nonterminal_Term, /*pop*/ 3, 0, 2);
+    }
+
+    int gotof_22(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 23;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_23(token_type token, const value_type& value) {
+        // reduce
+        return call_0_DivTerm(Nonterminal_Term, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_24(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Identity(Nonterminal_Factor, /*pop*/ 1, 0);
+    }
+
+    bool state_25(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Load(Nonterminal_Factor, /*pop*/ 1, 0);
+    }
+
+    bool state_26(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Identity(Nonterminal_Factor, /*pop*/ 3, 1);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_2, &Parser::gotof_2, false, true },
+            { &Parser::state_3, &Parser::gotof_2, false, true },
+            { &Parser::state_4, &Parser::gotof_2, false, false },
+            { &Parser::state_5, &Parser::gotof_2, false, false },
+            { &Parser::state_6, &Parser::gotof_6, false, false },
+            { &Parser::state_7, &Parser::gotof_2, false, false },
+            { &Parser::state_8, &Parser::gotof_2, false, true },
+            { &Parser::state_6, &Parser::gotof_9, false, false },
+            { &Parser::state_10, &Parser::gotof_2, false, false },
+            { &Parser::state_11, &Parser::gotof_2, false, true },
+            { &Parser::state_6, &Parser::gotof_12, false, false },
+            { &Parser::state_13, &Parser::gotof_2, false, false },
+            { &Parser::state_14, &Parser::gotof_2, false, false },
+            { &Parser::state_6, &Parser::gotof_15, false, false },
+            { &Parser::state_16, &Parser::gotof_2, false, false },
+            { &Parser::state_6, &Parser::gotof_17, false, false },
+            { &Parser::state_18, &Parser::gotof_2, false, false },
+            { &Parser::state_19, &Parser::gotof_2, false, true },
+            { &Parser::state_6, &Parser::gotof_20, false, false },
+            { &Parser::state_21, &Parser::gotof_2, false, true },
+            { &Parser::state_6, &Parser::gotof_22, false, false },
+            { &Parser::state_23, &Parser::gotof_2, false, true },
+            { &Parser::state_24, &Parser::gotof_2, false, true },
+            { &Parser::state_25, &Parser::gotof_2, false, true },
+            { &Parser::state_26, &Parser::gotof_2, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace lexer
+
+#endif // #ifndef LEXER0_IPP_
+
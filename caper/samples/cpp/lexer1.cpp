@@ -0,0 +1,21 @@
+// %lexer sample
+//   prints the tokens of the input, keywords follow declaration order
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "lexer1.ipp"
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    typedef std::string::const_iterator iterator;
+    lexer1::Lexer<iterator> l(source.begin(), source.end());
+    lexer1::Token token;
+    while (l.get(token) && token != lexer1::token_eof) {
+        std::cout << lexer1::token_label(token) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+// state minimization sample
+//   two states with different cores but the same rows are merged, the
+//   parser built from the merged table behaves the same
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "minimize0.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int First(int x) { return x; }
+    int Next(int, int y) { return y; }
+    int Print(int x) { std::cout << x << std::endl; return x; }
+    int Fraction(int x, int y) {
+        std::cout << x << "." << y << std::endl;
+        return x;
+    }
+    int Pair(int x, int y) {
+        std::cout << "pair " << x << " " << y << std::endl;
+        return x;
+    }
+    int Negate(int x) { return Print(-x); }
+    int NegateFraction(int x, int y) {
+        std::cout << "-";
+        return -Fraction(x, y);
+    }
+    int Identity(int x) { return x; }
+
+};
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    typedef std::string::const_iterator iterator;
+    auto make_value = [](minimize::Token token, iterator b, iterator e) {
+        return token == minimize::token_Number ?
+            std::stoi(std::string(b, e)) : 0;
+    };
+
+    SemanticAction sa;
+    minimize::Parser<int, SemanticAction> parser(sa);
+    iterator b = source.begin();
+    if (!parser.parse(b, iterator(source.end()), make_value)) {
+        std::cout << "error at offset " << (b - source.begin()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
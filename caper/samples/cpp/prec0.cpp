@@ -0,0 +1,52 @@
+// %left/%right/%nonassoc sample
+//   one flat Expr nonterminal, the operator levels come from the
+//   precedence declarations instead of a nonterminal per level
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "prec0.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int First(int x) { return x; }
+    int Next(int, int y) { return y; }
+    int Print(int x) { std::cout << x << std::endl; return x; }
+    int Less(int x, int y) { return x < y; }
+    int Add(int x, int y) { return x + y; }
+    int Sub(int x, int y) { return x - y; }
+    int Mul(int x, int y) { return x * y; }
+    int Div(int x, int y) { return x / y; }
+    int Pow(int x, int y) {
+        int n = 1;
+        while (0 < y--) { n *= x; }
+        return n;
+    }
+    int Neg(int x) { return -x; }
+    int Identity(int x) { return x; }
+
+};
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    typedef std::string::const_iterator iterator;
+    auto make_value = [](prec::Token token, iterator b, iterator e) -> int {
+        return token == prec::token_Number ? std::stoi(std::string(b, e)) : 0;
+    };
+
+    SemanticAction sa;
+    prec::Parser<int, SemanticAction> parser(sa);
+    iterator b = source.begin();
+    if (!parser.parse(b, iterator(source.end()), make_value)) {
+        std::cout << "error at offset " << (b - source.begin()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
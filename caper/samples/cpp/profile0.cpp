@@ -0,0 +1,114 @@
+// profiling sample
+//   generated with --profile, compiled with CAPER_TRACE_SIZE=8.
+//   input: one expression per line; prints the result and the
+//   counters, or the recent events on a syntax error.
+
+#include <iostream>
+#include <string>
+#include <cctype>
+#include "profile0.ipp"
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int MakeAdd(int x, int y) { return x + y; }
+    int MakeMul(int x, int y) { return x * y; }
+    int Identity(int x) { return x; }
+
+};
+
+typedef profile::Parser<int, SemanticAction> parser_type;
+
+void parse(parser_type& parser, const std::string& text) {
+    size_t offset = 0;
+    for (;;) {
+        while (offset < text.size() && isspace(text[offset])) { offset++; }
+
+        profile::Token token;
+        int v = 0;
+        if (text.size() <= offset) {
+            token = profile::token_eof;
+        } else if (text[offset] == '+') {
+            token = profile::token_Add;
+            offset++;
+        } else if (text[offset] == '*') {
+            token = profile::token_Mul;
+            offset++;
+        } else if (isdigit(text[offset])) {
+            token = profile::token_Number;
+            while (offset < text.size() && isdigit(text[offset])) {
+                v = v * 10 + text[offset++] - '0';
+            }
+        } else {
+            std::cerr << "unexpected char: " << text[offset] << std::endl;
+            exit(1);
+        }
+
+        if (parser.post(token, v)) { break; }
+    }
+}
+
+void dump_trace(const parser_type& parser) {
+    static const char* actions[] = { "shift", "reduce", "accept", "error" };
+
+    parser_type::trace_event events[8];
+    size_t n = parser.trace(events, 8);
+    for (size_t i = 0 ; i < n ; i++) {
+        const parser_type::trace_event& e = events[i];
+        std::cout << "  state " << e.state
+                  << " " << profile::token_label(profile::Token(e.token))
+                  << " " << actions[e.action];
+        if (e.action == parser_type::trace_shift) {
+            std::cout << " " << e.target;
+        }
+        if (e.action == parser_type::trace_reduce) {
+            std::cout << " " << parser_type::rule_label(e.target);
+        }
+        std::cout << std::endl;
+    }
+}
+
+void dump_stats(const parser_type& parser) {
+    const parser_type::stats_type& stats = parser.stats();
+
+    unsigned long shifts = 0;
+    unsigned long gotos = 0;
+    for (int i = 0 ; i < parser_type::state_count ; i++) {
+        shifts += stats.shifts[i];
+        gotos += stats.gotos[i];
+    }
+    std::cout << "  shifts: " << shifts
+              << ", gotos: " << gotos
+              << ", max depth: " << stats.max_depth << std::endl;
+    for (int i = 0 ; i < parser_type::rule_count ; i++) {
+        if (stats.reductions[i] != 0) {
+            std::cout << "  " << parser_type::rule_label(i)
+                      << ": " << stats.reductions[i] << std::endl;
+        }
+    }
+}
+
+int main(int, char**)
+{
+    SemanticAction sa;
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        parser_type parser(sa);
+        parse(parser, line);
+
+        int v;
+        if (!parser.error() && parser.accept(v)) {
+            std::cout << "result: " << v << std::endl;
+            dump_stats(parser);
+        } else {
+            std::cout << "error" << std::endl;
+            dump_trace(parser);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+// error recovery sample
+//   every semantic action is reported, none may run twice because of
+//   a token that turns out to be an error
+
+#include <iostream>
+#include <string>
+#include "recovery3.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int Pass(int x) { return x; }
+    int Item(int x) { std::cout << "Item " << x << std::endl; return x; }
+    int Err() { std::cout << "Err" << std::endl; return 0; }
+};
+
+// words: numbers, "-" and ";"
+recovery3::Token get(std::istream& is, int& v) {
+    std::string s;
+    if (!(is >> s)) { return recovery3::token_eof; }
+    if (s == "-") { return recovery3::token_Minus; }
+    if (s == ";") { return recovery3::token_Semi; }
+    v = std::stoi(s);
+    return recovery3::token_Number;
+}
+
+int main(int, char**) {
+    SemanticAction sa;
+    recovery3::Parser<int, SemanticAction> parser(sa);
+
+    recovery3::Token token;
+    do {
+        int v = 0;
+        token = get(std::cin, v);
+        parser.post(token, v);
+    } while (token != recovery3::token_eof);
+
+    int v = 0;
+    if (parser.accept(v)) {
+        std::cout << "accepted" << std::endl;
+    } else {
+        std::cout << "failed" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+// grammar simplification sample
+//   the parser is made from the simplified grammar, the semantic actions
+//   and their arguments are the same as written
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "simplify0.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int First(int x) { return x; }
+    int Next(int, int y) { return y; }
+    int Print(int x) { std::cout << x << std::endl; return x; }
+    int Add(int x, int y) { return x + y; }
+    int Mul(int x, int y) { return x * y; }
+    int Identity(int x) { return x; }
+
+};
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    typedef std::string::const_iterator iterator;
+    auto make_value = [](simplify::Token token, iterator b, iterator e) {
+        return token == simplify::token_Number ?
+            std::stoi(std::string(b, e)) : 0;
+    };
+
+    SemanticAction sa;
+    simplify::Parser<int, SemanticAction> parser(sa);
+    iterator b = source.begin();
+    if (!parser.parse(b, iterator(source.end()), make_value)) {
+        std::cout << "error at offset " << (b - source.begin()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,43 @@
+// grammar simplification sample
+//   a nonterminal used only in a sequence is kept, the sequence
+//   actions are the same as written
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "simplify1.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    template <class S>
+    int Doc(const S& x) {
+        int n = int(std::distance(x.begin(), x.end()));
+        std::cout << "Doc: " << n << " items" << std::endl;
+        return n;
+    }
+};
+
+int main(int, char**) {
+    std::string source(
+        (std::istreambuf_iterator<char>(std::cin)),
+        std::istreambuf_iterator<char>());
+
+    typedef std::string::const_iterator iterator;
+    auto make_value = [](simplify1::Token token, iterator b, iterator e) {
+        return token == simplify1::token_Number ?
+            std::stoi(std::string(b, e)) : 0;
+    };
+
+    SemanticAction sa;
+    simplify1::Parser<int, SemanticAction> parser(sa);
+    iterator b = source.begin();
+    if (!parser.parse(b, iterator(source.end()), make_value)) {
+        std::cout << "error at offset " << (b - source.begin()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+// snapshot() / restore() / fork() sample
+
+#include <iostream>
+#include <cctype>
+#include "snapshot0.ipp"
+
+class unexpected_char : public std::exception {};
+
+template <class It>
+class scanner {
+public:
+    typedef int char_type;
+
+public:
+    scanner(It b, It e) : b_(b), e_(e), c_(b), unget_(EOF) {}
+
+    snapshot::Token get(int& v) {
+        int c;
+        do {
+            c = getc();
+        } while (isspace(c));
+
+        if (c == EOF) {
+            return snapshot::token_eof;
+        }
+        if (c == '+') {
+            return snapshot::token_Plus;
+        }
+        if (isdigit(c)) {
+            int n = 0;
+            while (c != EOF && isdigit(c)) {
+                n *= 10;
+                n += c - '0';
+                c = getc();
+            }
+            ungetc(c);
+            v = n;
+            return snapshot::token_Number;
+        }
+
+        std::cerr << char(c) << std::endl;
+        throw unexpected_char();
+    }
+
+private:
+    char_type getc() {
+        int c;
+        if (unget_ != EOF) {
+            c = unget_;
+            unget_ = EOF;
+        } else if (c_ == e_) {
+            c = EOF; 
+        } else {
+            c = (unsigned char)(*c_++);
+        }
+        return c;
+    }
+
+    void ungetc(char_type c) {
+        unget_ = c;
+    }
+
+private:
+    It              b_;
+    It              e_;
+    It              c_;
+    char_type       unget_;
+
+};
+
+struct SemanticAction {
+    void syntax_error() {}
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int Add(int x, int y) { return x + y; }
+    int Identity(int x) { return x; }
+
+};
+
+typedef snapshot::Parser<int, SemanticAction> parser_type;
+
+void finish(const char* label, parser_type& parser, int extra) {
+    if (0 <= extra) {
+        parser.post(snapshot::token_Plus, 0);
+        parser.post(snapshot::token_Number, extra);
+    }
+    parser.post(snapshot::token_eof, 0);
+
+    int v;
+    if (parser.accept(v)) {
+        std::cout << label << ": " << v << std::endl;
+    } else {
+        std::cout << label << ": error" << std::endl;
+    }
+}
+
+int main(int, char**)
+{
+    typedef std::istreambuf_iterator<char> is_iterator;
+    is_iterator b(std::cin);
+    is_iterator e;
+    scanner<is_iterator> s(b, e);
+
+    SemanticAction sa;
+    parser_type parser(sa);
+
+    // post everything but eof
+    for(;;) {
+        int v;
+        snapshot::Token token = s.get(v);
+        if (token == snapshot::token_eof) { break; }
+        if (parser.post(token, v)) {
+            std::cerr << "error occured: " << snapshot::token_label(token)
+                      << std::endl;
+            exit(1);
+        }
+    }
+
+    parser_type::snapshot_type saved = parser.snapshot();
+    parser_type forked = parser.fork();
+
+    finish("original", parser, -1);
+    finish("forked", forked, 100);
+
+    parser.restore(saved);
+    finish("restored", parser, 1000);
+
+    return 0;
+}
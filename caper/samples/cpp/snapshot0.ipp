@@ -0,0 +1,562 @@
+#ifndef SNAPSHOT0_IPP_
+#define SNAPSHOT0_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <map>
+#include <memory>
+#include <cstddef>
+
+namespace snapshot {
+
+enum Token {
+    token_eof,
+    token_Number,
+    token_Plus,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_Number",
+        "token_Plus",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    // frames are immutable nodes linked to their parents,
+    // so copying a stack shares the whole contents (O(1))
+    Stack() {}
+    Stack(const Stack& x) : top_(x.top_), gap_(x.gap_) {}
+    ~Stack() { clear(); }
+
+    Stack& operator=(const Stack& x) {
+        node_ptr t = x.top_;
+        node_ptr g = x.gap_;
+        clear();
+        top_ = t;
+        gap_ = g;
+        return *this;
+    }
+
+    void rollback_tmp() {
+        top_ = gap_;
+    }
+
+    void commit_tmp() {
+        gap_ = top_;
+    }
+
+    bool push(const T& f) {
+        size_t d = depth();
+        if (StackSize != 0 && StackSize <= d) {
+            return false;
+        }
+        top_ = std::make_shared<node>(f, top_, d + 1);
+        return true;
+    }
+
+    void pop(size_t n) {
+        while (n--) {
+            top_ = top_->prev;
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        return top_->value;
+    }
+
+    const T& committed_top() const {
+        assert(gap_);
+        return gap_->value;
+    }
+
+    const T& get_arg(size_t base, size_t index) {
+        return at(base - index - 1)->value;
+    }
+
+    void clear() {
+        release(top_);
+        release(gap_);
+    }
+
+    bool empty() const {
+        return !top_;
+    }
+
+    size_t depth() const {
+        return top_ ? top_->depth : 0;
+    }
+
+    T& nth(size_t index) {
+        return at(depth() - 1 - index)->value;
+    }
+
+    bool equal(const Stack& x) const {
+        // stops at the first shared frame
+        if (depth() != x.depth()) { return false; }
+        const node* p = top_.get();
+        const node* q = x.top_.get();
+        while (p != q) {
+            if (!(p->value == q->value)) { return false; }
+            p = p->prev.get();
+            q = q->prev.get();
+        }
+        return true;
+    }
+
+private:
+    struct node {
+        T                       value;
+        std::shared_ptr<node>   prev;
+        size_t                  depth;
+
+        node(const T& v, const std::shared_ptr<node>& p, size_t d)
+            : value(v), prev(p), depth(d) {}
+    };
+    typedef std::shared_ptr<node> node_ptr;
+
+    node* at(size_t n) {
+        node* p = top_.get();
+        while (n--) {
+            p = p->prev.get();
+        }
+        return p;
+    }
+
+    static void release(node_ptr& p) {
+        // avoid recursive destruction of long chains
+        while (p && p.unique()) {
+            node_ptr q = p->prev;
+            p = q;
+        }
+        p.reset();
+    }
+
+private:
+    node_ptr top_;
+    node_ptr gap_;
+
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 0>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_Sum,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa), checkpoint_interval_(0) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        checkpoint_clear();
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[5][1] = {
+            { 2 },
+            { 5 },
+            { 2 },
+            { 5 },
+            { 5 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() const {
+        return int(stack_.committed_top().entry - entry(0));
+    }
+
+    bool expected(token_type token) const {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+
+        bool operator==(const stack_frame& x) const {
+            return entry == x.entry && value == x.value;
+        }
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+public:
+    // snapshot / fork
+    class snapshot_type {
+        friend class Parser;
+
+    public:
+        snapshot_type() : accepted_(false), error_(false) {}
+
+    private:
+        Stack<stack_frame, _StackSize>  stack_;
+        bool                            accepted_;
+        bool                            error_;
+        value_type                      accepted_value_;
+    };
+
+    snapshot_type snapshot() const {
+        snapshot_type s;
+        s.stack_ = stack_;
+        s.accepted_ = accepted_;
+        s.error_ = error_;
+        s.accepted_value_ = accepted_value_;
+        return s;
+    }
+
+    void restore(const snapshot_type& s) {
+        stack_ = s.stack_;
+        accepted_ = s.accepted_;
+        error_ = s.error_;
+        accepted_value_ = s.accepted_value_;
+    }
+
+    Parser fork() const {
+        return *this;
+    }
+
+    // incremental reparse
+    //   post_at() takes a snapshot before a token every
+    //   checkpoint_interval tokens and after each checkpoint token.
+    //   edit() rewinds to the last checkpoint before an edit.
+    //   checkpoints behind the edit are kept, and post_at() stops
+    //   reparsing (returns true, converged() == true) as soon as the
+    //   stack matches one of them again: the parser then takes the
+    //   state after the last token of the previous parse.
+    //   frames are compared with value_type::operator==.
+    void set_checkpoint_interval(size_t n) {
+        checkpoint_interval_ = n;
+    }
+
+    void add_checkpoint_token(token_type token) {
+        checkpoint_tokens_.push_back(token);
+    }
+
+    bool post_at(size_t offset, token_type token, const value_type& value) {
+        converged_ = false;
+
+        // convergence with the previous parse
+        typename checkpoint_map::iterator i = old_checkpoints_.begin();
+        while (i != old_checkpoints_.end() && (*i).first < offset) {
+            old_checkpoints_.erase(i++);
+        }
+        if (i != old_checkpoints_.end() && (*i).first == offset &&
+            !error_ && !(*i).second.error_ &&
+            stack_.equal((*i).second.stack_)) {
+            checkpoints_.insert(old_checkpoints_.begin(), old_checkpoints_.end());
+            old_checkpoints_.clear();
+            restore(old_last_);
+            last_ = old_last_;
+            converged_ = true;
+            return true;
+        }
+
+        // checkpoint
+        if (checkpoint_pending_ ||
+            (0 < checkpoint_interval_ &&
+             checkpoint_interval_ <= checkpoint_count_)) {
+            checkpoints_[offset] = snapshot();
+            checkpoint_pending_ = false;
+            checkpoint_count_ = 0;
+        }
+        checkpoint_count_++;
+        for (size_t j = 0 ; j < checkpoint_tokens_.size() ; j++) {
+            if (checkpoint_tokens_[j] == token) {
+                checkpoint_pending_ = true;
+                break;
+            }
+        }
+
+        bool r = post(token, value);
+        last_ = snapshot();
+        return r;
+    }
+
+    // [begin, end) of the previous input was replaced,
+    // changing its length by delta.
+    // returns the offset to restart lexing/posting from.
+    size_t edit(size_t begin, size_t end, std::ptrdiff_t delta) {
+        checkpoint_map old;
+        for (typename checkpoint_map::iterator i =
+                 checkpoints_.lower_bound(end);
+             i != checkpoints_.end() ; ++i) {
+            old[size_t((*i).first + delta)] = (*i).second;
+        }
+        snapshot_type old_last = last_;
+
+        typename checkpoint_map::iterator i = checkpoints_.lower_bound(begin);
+        size_t offset = 0;
+        if (i == checkpoints_.begin()) {
+            reset();
+        } else {
+            --i;
+            offset = (*i).first;
+            restore((*i).second);
+            checkpoints_.erase(i, checkpoints_.end());
+        }
+
+        old_checkpoints_.swap(old);
+        old_last_ = old_last;
+        checkpoint_pending_ = true;
+        checkpoint_count_ = 0;
+        converged_ = false;
+        return offset;
+    }
+
+    bool converged() const { return converged_; }
+
+private:
+    typedef std::map<size_t, snapshot_type> checkpoint_map;
+
+    size_t                  checkpoint_interval_;
+    std::vector<token_type> checkpoint_tokens_;
+    checkpoint_map          checkpoints_;
+    checkpoint_map          old_checkpoints_;
+    snapshot_type           last_;
+    snapshot_type           old_last_;
+    size_t                  checkpoint_count_;
+    bool                    checkpoint_pending_;
+    bool                    converged_;
+
+    void checkpoint_clear() {
+        checkpoints_.clear();
+        old_checkpoints_.clear();
+        last_ = snapshot_type();
+        old_last_ = snapshot_type();
+        checkpoint_count_ = 0;
+        checkpoint_pending_ = true;
+        converged_ = false;
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_Add(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.Add(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Identity(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Identity(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Sum: return 1;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_Plus:
+            // shift
+            push_stack(/*state*/ 2, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 3, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Add(Nonterminal_Sum, /*pop*/ 3, 0, 2);
+    }
+
+    bool state_4(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Identity(Nonterminal_Sum, /*pop*/ 1, 0);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_2, &Parser::gotof_1, false, false },
+            { &Parser::state_3, &Parser::gotof_1, false, true },
+            { &Parser::state_4, &Parser::gotof_1, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace snapshot
+
+#endif // #ifndef SNAPSHOT0_IPP_
+
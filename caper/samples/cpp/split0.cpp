@@ -0,0 +1,30 @@
+// %split sample
+//   the state handlers and the table of split::Parser<int, SemanticAction>
+//   are compiled in split0_0.cpp and split0_1.cpp, this translation unit
+//   only sees their declarations.
+
+#include <iostream>
+#include <iterator>
+#include <string>
+#include "split0_sa.hpp"
+
+int main(int, char**) {
+    typedef std::string::const_iterator iterator;
+    auto make_value = [](split::Token token, iterator b, iterator e) -> int {
+        return token == split::token_Number ? std::stoi(std::string(b, e)) : 0;
+    };
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        SemanticAction sa;
+        split::Parser<int, SemanticAction> parser(sa);
+
+        iterator b = line.begin();
+        int v;
+        if (parser.parse(b, iterator(line.end()), make_value) &&
+            parser.accept(v)) {
+            std::cout << v << std::endl;
+        }
+    }
+    return 0;
+}
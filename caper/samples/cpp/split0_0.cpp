@@ -0,0 +1,150 @@
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include "split0_sa.hpp"
+
+namespace split {
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_0(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_LParen:
+            // shift
+            push_stack(/*state*/ 2, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 14, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_0(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 1;
+        case Nonterminal_Factor: return 9;
+        case Nonterminal_Term: return 3;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_1(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_Add:
+            // shift
+            push_stack(/*state*/ 5, value);
+            return false;
+        case token_Sub:
+            // shift
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_1(Nonterminal nonterminal) -> int {
+        assert(0);
+        return true;
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_2(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Expr: return 4;
+        case Nonterminal_Factor: return 9;
+        case Nonterminal_Term: return 3;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_3(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 10, value);
+            return false;
+        default:
+            // reduce
+            return call_0_MakeExpr(Nonterminal_Expr, /*pop*/ 1, 0);
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_4(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_Add:
+            // shift
+            push_stack(/*state*/ 5, value);
+            return false;
+        case token_RParen:
+            // shift
+            push_stack(/*state*/ 15, value);
+            return false;
+        case token_Sub:
+            // shift
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            sa_.syntax_error();
+            error_ = true;
+            return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_5(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 9;
+        case Nonterminal_Term: return 6;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_6(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 10, value);
+            return false;
+        default:
+            // reduce
+            return call_0_AddExpr(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+}
+
+template auto Parser<int, SemanticAction>::state_0(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::gotof_0(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_1(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::gotof_1(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::gotof_2(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_3(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::state_4(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::gotof_5(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_6(token_type token, const value_type& value) -> bool;
+
+} // namespace split
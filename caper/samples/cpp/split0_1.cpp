@@ -0,0 +1,114 @@
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include "split0_sa.hpp"
+
+namespace split {
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_7(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 9;
+        case Nonterminal_Term: return 8;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_8(token_type token, const value_type& value) -> bool {
+        switch(token) {
+        case token_Div:
+            // shift
+            push_stack(/*state*/ 12, value);
+            return false;
+        case token_Mul:
+            // shift
+            push_stack(/*state*/ 10, value);
+            return false;
+        default:
+            // reduce
+            return call_0_SubExpr(Nonterminal_Expr, /*pop*/ 3, 0, 2);
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_9(token_type token, const value_type& value) -> bool {
+        // reduce
+        return call_0_MakeTerm(Nonterminal_Term, /*pop*/ 1, 0);
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_10(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 11;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_11(token_type token, const value_type& value) -> bool {
+        // reduce
+        return call_0_MulTerm(Nonterminal_Term, /*pop*/ 3, 0, 2);
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::gotof_12(Nonterminal nonterminal) -> int {
+        switch(nonterminal) {
+        case Nonterminal_Factor: return 13;
+        default: assert(0); return false;
+        }
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_13(token_type token, const value_type& value) -> bool {
+        // reduce
+        return call_0_DivTerm(Nonterminal_Term, /*pop*/ 3, 0, 2);
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_14(token_type token, const value_type& value) -> bool {
+        // reduce
+        return call_0_Identity(Nonterminal_Factor, /*pop*/ 1, 0);
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::state_15(token_type token, const value_type& value) -> bool {
+        // reduce
+        return call_0_Identity(Nonterminal_Factor, /*pop*/ 3, 1);
+}
+
+template <class _Value, class _SemanticAction, unsigned int _StackSize>
+auto Parser<_Value, _SemanticAction, _StackSize>::entry(int n) const -> const table_entry* {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_0, &Parser::gotof_2, false, false },
+            { &Parser::state_3, &Parser::gotof_1, false, false },
+            { &Parser::state_4, &Parser::gotof_1, false, false },
+            { &Parser::state_0, &Parser::gotof_5, false, false },
+            { &Parser::state_6, &Parser::gotof_1, false, false },
+            { &Parser::state_0, &Parser::gotof_7, false, false },
+            { &Parser::state_8, &Parser::gotof_1, false, false },
+            { &Parser::state_9, &Parser::gotof_1, false, true },
+            { &Parser::state_0, &Parser::gotof_10, false, false },
+            { &Parser::state_11, &Parser::gotof_1, false, true },
+            { &Parser::state_0, &Parser::gotof_12, false, false },
+            { &Parser::state_13, &Parser::gotof_1, false, true },
+            { &Parser::state_14, &Parser::gotof_1, false, true },
+            { &Parser::state_15, &Parser::gotof_1, false, true },
+        };
+        return &entries[n];
+}
+
+template auto Parser<int, SemanticAction>::gotof_7(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_8(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::state_9(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::gotof_10(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_11(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::gotof_12(Nonterminal nonterminal) -> int;
+template auto Parser<int, SemanticAction>::state_13(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::state_14(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::state_15(token_type token, const value_type& value) -> bool;
+template auto Parser<int, SemanticAction>::entry(int n) const -> const table_entry*;
+
+} // namespace split
@@ -0,0 +1,28 @@
+// %split sample
+//   the types the parser is instantiated with. the generated
+//   split0_N.cpp files include this header, so it has to include the
+//   generated header itself.
+
+#ifndef SPLIT0_SA_HPP
+#define SPLIT0_SA_HPP
+
+#include <iostream>
+#include "split0.ipp"
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int MakeExpr(int x) { return x; }
+    int AddExpr(int x, int y) { return x + y; }
+    int SubExpr(int x, int y) { return x - y; }
+    int MakeTerm(int x) { return x; }
+    int MulTerm(int x, int y) { return x * y; }
+    int DivTerm(int x, int y) { return x / y; }
+    int Identity(int x) { return x; }
+
+};
+
+#endif // SPLIT0_SA_HPP
@@ -0,0 +1,85 @@
+// parse_parallel() sample
+//   parses the input sequentially and in parallel, and compares
+//   the semantic actions only compute values from their arguments, as
+//   parse_parallel() may call them several times for the same tokens
+
+#include <iostream>
+#include <vector>
+#include <cctype>
+#include "sync0.ipp"
+
+class unexpected_char : public std::exception {};
+
+struct SemanticAction {
+    void syntax_error() { std::cout << "syntax error" << std::endl; }
+    void stack_overflow() {}
+    void downcast(int& x, int y) { x = y; }
+    void upcast(int& x, int y) { x = y; }
+
+    int First(int x) { return x; }
+    int Next(int x, int y) { return x + y; }
+    int Simple(int x) { return x; }
+    int Block(int x) { return x * 2; }
+    int Merge(int x, int y) { return x + y; }
+
+};
+
+typedef sync::Parser<int, SemanticAction> parser_type;
+
+void scan(std::vector<sync::Token>& tokens, std::vector<int>& values) {
+    typedef std::istreambuf_iterator<char> is_iterator;
+    is_iterator b(std::cin);
+    is_iterator e;
+
+    while (b != e) {
+        char c = *b;
+        if (isspace(c)) { ++b; continue; }
+
+        int v = 0;
+        sync::Token token;
+        if (isdigit(c)) {
+            while (b != e && isdigit(*b)) { v = v * 10 + *b++ - '0'; }
+            token = sync::token_Number;
+        } else {
+            ++b;
+            switch (c) {
+                case ';': token = sync::token_Semicolon; break;
+                case '{': token = sync::token_LBrace; break;
+                case '}': token = sync::token_RBrace; break;
+                default:
+                    std::cerr << c << std::endl;
+                    throw unexpected_char();
+            }
+        }
+        tokens.push_back(token);
+        values.push_back(v);
+    }
+}
+
+int main(int, char**)
+{
+    std::vector<sync::Token> tokens;
+    std::vector<int> values;
+    scan(tokens, values);
+
+    SemanticAction sa;
+
+    // sequential
+    parser_type parser(sa);
+    for (size_t i = 0 ; i < tokens.size() ; i++) {
+        if (parser.post(tokens[i], values[i])) { break; }
+    }
+    parser.post(sync::token_eof, 0);
+    int v0 = -1;
+    if (!parser.error()) { parser.accept(v0); }
+    std::cout << "sequential: " << v0 << std::endl;
+
+    // parallel
+    int v1 = -1;
+    if (parser.parse_parallel(tokens, values, 4)) {
+        parser.accept(v1);
+    }
+    std::cout << "parallel: " << v1 << std::endl;
+
+    return 0;
+}
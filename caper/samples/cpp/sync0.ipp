@@ -0,0 +1,678 @@
+#ifndef SYNC0_IPP_
+#define SYNC0_IPP_
+
+// This file was automatically generated by Caper.
+// (http://jonigata.github.io/caper/caper.html)
+
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace sync {
+
+enum Token {
+    token_eof,
+    token_LBrace,
+    token_Number,
+    token_RBrace,
+    token_Semicolon,
+};
+
+inline const char* token_label(Token t) {
+    static const char* labels[] = {
+        "token_eof",
+        "token_LBrace",
+        "token_Number",
+        "token_RBrace",
+        "token_Semicolon",
+    };
+    return labels[t];
+}
+
+template <class T, unsigned int StackSize>
+class Stack {
+public:
+    Stack() { gap_ = 0; }
+
+    void rollback_tmp() {
+        gap_ = stack_.size();
+        tmp_.clear();
+    }
+
+    void commit_tmp() {
+        // may throw
+        stack_.reserve(gap_ + tmp_.size());
+	   
+        // expect not to throw
+        stack_.erase(stack_.begin()+ gap_, stack_.end());
+        stack_.insert(stack_.end(), tmp_.begin(), tmp_.end());
+        tmp_.clear();
+    }
+    bool push(const T& f) {
+        if (StackSize != 0 &&
+            int(StackSize) <= int(stack_.size() + tmp_.size())) {
+            return false;
+        }
+        tmp_.push_back(f);
+        return true;
+    }
+	   
+    void pop(size_t n) {
+        if (tmp_.size() < n) {
+            n -= tmp_.size();
+            tmp_.clear();
+            gap_ -= n;
+        } else {
+            tmp_.erase(tmp_.end() - n, tmp_.end());
+        }
+    }
+
+    T& top() {
+        assert(0 < depth());
+        if (!tmp_.empty()) {
+            return tmp_.back();
+        } else {
+            return stack_[gap_ - 1];
+        }
+    }
+
+    const T& committed_top() const {
+        assert(!stack_.empty());
+        return stack_.back();
+    }
+	   
+    const T& get_arg(size_t base, size_t index) {
+        size_t n = tmp_.size();
+        if (base - index <= n) {
+            return tmp_[n - (base - index)];
+        } else {
+            return stack_[gap_ - (base - n) + index];
+        }
+    }
+	   
+    void clear() {
+        stack_.clear();
+        tmp_.clear();
+        gap_ = 0; 
+    }
+	   
+    bool empty() const {
+        if (!tmp_.empty()) {
+            return false;
+        } else {
+            return gap_ == 0;
+        }
+    }
+	   
+    size_t depth() const {
+        return gap_ + tmp_.size();
+    }
+	   
+    T& nth(size_t index) {
+        if (gap_ <= index) {
+            return tmp_[index - gap_];
+        } else {
+            return stack_[index];
+        }
+    }
+
+    void swap_top_and_second() {
+        int d = depth();
+        assert(2 <= d);
+        T x = nth(d - 1);
+        nth(d - 1) = nth(d - 2);
+        nth(d - 2) = x;
+    }
+
+private:
+    std::vector<T> stack_;
+    std::vector<T> tmp_;
+    size_t gap_;
+	   
+};
+
+template <class _Value, class _SemanticAction,
+          unsigned int _StackSize = 0>
+class Parser {
+public:
+    typedef Token token_type;
+    typedef _Value value_type;
+
+    enum Nonterminal {
+        Nonterminal_Program,
+        Nonterminal_Statement,
+        Nonterminal_Statements,
+    };
+
+public:
+    Parser(_SemanticAction& sa) : sa_(sa), speculative_(false) { reset(); }
+
+    void reset() {
+        error_ = false;
+        accepted_ = false;
+        clear_stack();
+        rollback_tmp_stack();
+        if (push_stack(0, value_type())) {
+            commit_tmp_stack();
+        } else {
+            sa_.stack_overflow();
+            error_ = true;
+        }
+    }
+
+    bool post(token_type token, const value_type& value) {
+        rollback_tmp_stack();
+        error_ = false;
+        while ((this->*(stack_top()->entry->state))(token, value))
+            ; // may throw
+        reduce_consistent(token, value);
+        if (!error_) {
+            commit_tmp_stack();
+        } else {
+            sync_recover(token, value);
+        }
+        return accepted_ || error_;
+    }
+
+    bool accept(value_type& v) {
+        assert(accepted_);
+        if (error_) { return false; }
+        v = accepted_value_;
+        return true;
+    }
+
+    bool error() { return error_; }
+
+    // expected tokens
+    //   a bitset per state of the tokens that have an action in it.
+    //   scanners can ask expected(token) before classifying a lexeme
+    //   to resolve context dependent tokens in a single pass.
+    static const unsigned char* expected_tokens(int state) {
+        static const unsigned char table[11][1] = {
+            { 6 },
+            { 7 },
+            { 7 },
+            { 7 },
+            { 6 },
+            { 14 },
+            { 16 },
+            { 15 },
+            { 15 },
+            { 14 },
+            { 14 },
+        };
+        return table[state];
+    }
+
+    static bool expected(int state, token_type token) {
+        return (expected_tokens(state)[token >> 3] >> (token & 7)) & 1;
+    }
+
+    // the state on top of the committed stack
+    int state() const {
+        return int(stack_.committed_top().entry - entry(0));
+    }
+
+    bool expected(token_type token) const {
+        return expected(state(), token);
+    }
+
+private:
+    typedef Parser<_Value, _SemanticAction, _StackSize> self_type;
+
+    typedef bool (self_type::*state_type)(token_type, const value_type&);
+    typedef int (self_type::*gotof_type)(Nonterminal);
+
+    bool            accepted_;
+    bool            error_;
+    value_type      accepted_value_;
+    _SemanticAction& sa_;
+
+    struct table_entry {
+        state_type  state;
+        gotof_type  gotof;
+        bool        handle_error;
+        bool        consistent;
+    };
+
+    struct stack_frame {
+        const table_entry*  entry;
+        value_type          value;
+        int                 sequence_length;
+
+        stack_frame(const table_entry* e, const value_type& v, int sl)
+            : entry(e), value(v), sequence_length(sl) {}
+    };
+
+    Stack<stack_frame, _StackSize> stack_;
+
+    bool push_stack(int state_index, const value_type& v, int sl = 0) {
+        bool f = stack_.push(stack_frame(entry(state_index), v, sl));
+        assert(!error_);
+        if (!f) { 
+            error_ = true;
+            sa_.stack_overflow();
+        }
+        return f;
+    }
+
+    void pop_stack(size_t n) {
+        stack_.pop(n);
+    }
+
+    stack_frame* stack_top() {
+        return &stack_.top();
+    }
+
+    const value_type& get_arg(size_t base, size_t index) {
+        return stack_.get_arg(base, index).value;
+    }
+
+    void clear_stack() {
+        stack_.clear();
+    }
+
+    void rollback_tmp_stack() {
+        stack_.rollback_tmp();
+    }
+
+    void commit_tmp_stack() {
+        stack_.commit_tmp();
+    }
+
+    // consistent states reduce whatever the next token is. they are
+    // reduced as soon as they are on top, before the next post.
+    void reduce_consistent(token_type token, const value_type& value) {
+        while (!error_ && stack_top()->entry->consistent) {
+            (this->*(stack_top()->entry->state))(token, value); // may throw
+        }
+    }
+
+public:
+    // parallel parsing
+    //   the input is split before tokens that can begin Statement
+    //   right after tokens that can end it. each chunk is parsed as a
+    //   whole Program by its own parser on a worker thread, and
+    //   the results are joined from left to right by Merge.
+    //   a chunk that is not a sentence by itself is parsed sequentially
+    //   together with the following chunks. if the input has a syntax
+    //   error, it is parsed again sequentially to report it.
+    //   note: semantic actions must be pure and idempotent. they are called
+    //   concurrently from several threads, for chunks whose result is
+    //   thrown away, and again for the same tokens when chunks are parsed
+    //   sequentially or the input is parsed again. only the values they
+    //   return are kept. syntax_error() and recovery are not called
+    //   while chunks are parsed speculatively.
+    bool parse_parallel(const std::vector<token_type>& tokens,
+                        const std::vector<value_type>& values,
+                        unsigned int threads = 0) {
+        if (threads == 0) {
+            threads = std::thread::hardware_concurrency();
+            if (threads == 0) { threads = 1; }
+        }
+        size_t n = tokens.size();
+        if (0 < n && tokens[n - 1] == token_eof) { n--; }
+
+        // split
+        std::vector<size_t> candidates;
+        for (size_t i = 1 ; i < n ; i++) {
+            if (sync_begin(tokens[i]) && sync_end(tokens[i - 1])) {
+                candidates.push_back(i);
+            }
+        }
+        std::vector<sync_chunk> chunks;
+        size_t chunk_count = threads * 4;
+        size_t b = 0;
+        for (size_t k = 1 ; k < chunk_count ; k++) {
+            size_t target = (std::max)(n * k / chunk_count, b + 1);
+            std::vector<size_t>::const_iterator i =
+                std::lower_bound(candidates.begin(), candidates.end(), target);
+            if (i == candidates.end()) { break; }
+            chunks.push_back(sync_chunk(b, *i));
+            b = *i;
+        }
+        chunks.push_back(sync_chunk(b, n));
+
+        // parse chunks
+        std::atomic<size_t> next(0);
+        std::vector<std::thread> workers;
+        for (size_t t = 1 ; t < threads && t < chunks.size() ; t++) {
+            workers.push_back(
+                std::thread(
+                    [&]() { sync_work(next, chunks, tokens, values); }));
+        }
+        sync_work(next, chunks, tokens, values);
+        for (size_t t = 0 ; t < workers.size() ; t++) {
+            workers[t].join();
+        }
+
+        // stitch
+        reset();
+        value_type result;
+        bool first = true;
+        size_t k = 0;
+        while (k < chunks.size()) {
+            value_type v;
+            if (chunks[k].accepted) {
+                v = chunks[k].value;
+                k++;
+            } else if (!sync_fallback(k, chunks, tokens, values, v)) {
+                // syntax error
+                reset();
+                for (size_t i = 0 ; i < n ; i++) {
+                    if (post(tokens[i], values[i])) { return false; }
+                }
+                post(token_eof, value_type());
+                return accepted_ && !error_;
+            }
+            result = first ? v : sync_merge(result, v);
+            first = false;
+        }
+        accepted_ = true;
+        accepted_value_ = result;
+        return true;
+    }
+
+private:
+    struct sync_chunk {
+        size_t      begin;
+        size_t      end;
+        bool        accepted;
+        value_type  value;
+
+        sync_chunk(size_t b, size_t e)
+            : begin(b), end(e), accepted(false) {}
+    };
+
+    bool speculative_;
+
+    void syntax_error() {
+        if (!speculative_) { sa_.syntax_error(); }
+    }
+
+    void sync_recover(token_type token, const value_type& value) {
+        if (!speculative_) { recover(token, value); }
+    }
+
+    static bool sync_begin(token_type token) {
+        switch (token) {
+        case token_LBrace:
+        case token_Number:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static bool sync_end(token_type token) {
+        switch (token) {
+        case token_RBrace:
+        case token_Semicolon:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void sync_work(std::atomic<size_t>& next,
+                   std::vector<sync_chunk>& chunks,
+                   const std::vector<token_type>& tokens,
+                   const std::vector<value_type>& values) {
+        for (;;) {
+            size_t k = next++;
+            if (chunks.size() <= k) { return; }
+
+            sync_chunk& c = chunks[k];
+            Parser p(sa_);
+            p.speculative_ = true;
+            size_t i = c.begin;
+            while (i < c.end && !p.post(tokens[i], values[i])) { i++; }
+            if (i == c.end &&
+                p.post(token_eof, value_type()) && !p.error_) {
+                c.accepted = true;
+                c.value = p.accepted_value_;
+            }
+        }
+    }
+
+    bool sync_fallback(size_t& k,
+                       const std::vector<sync_chunk>& chunks,
+                       const std::vector<token_type>& tokens,
+                       const std::vector<value_type>& values,
+                       value_type& v) {
+        // chunks[k] starts at a verified boundary; parse sequentially
+        // until the input read so far forms a sentence at a chunk end
+        Parser p(sa_);
+        p.speculative_ = true;
+        while (k < chunks.size()) {
+            for (size_t i = chunks[k].begin ; i < chunks[k].end ; i++) {
+                if (p.post(tokens[i], values[i])) { return false; }
+            }
+            k++;
+            Parser q(p);
+            if (q.post(token_eof, value_type()) && !q.error_) {
+                v = q.accepted_value_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    value_type sync_merge(const value_type& x, const value_type& y) {
+        int arg0; sa_.downcast(arg0, x);
+        int arg1; sa_.downcast(arg1, y);
+        int r = sa_.Merge(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        return v;
+    }
+
+    void recover(token_type, const value_type&) {
+    }
+
+    bool call_nothing(Nonterminal nonterminal, int base) {
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, value_type());
+    }
+
+    bool call_0_First(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.First(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Next(Nonterminal nonterminal, int base, int arg_index0, int arg_index1) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int arg1; sa_.downcast(arg1, get_arg(base, arg_index1));
+        int r = sa_.Next(arg0, arg1);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Simple(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Simple(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool call_0_Block(Nonterminal nonterminal, int base, int arg_index0) {
+        int arg0; sa_.downcast(arg0, get_arg(base, arg_index0));
+        int r = sa_.Block(arg0);
+        value_type v; sa_.upcast(v, r);
+        pop_stack(base);
+        int dest_index = (this->*(stack_top()->entry->gotof))(nonterminal);
+        return push_stack(dest_index, v);
+    }
+
+    bool state_0(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LBrace:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        default:
+            syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_0(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Program: return 1;
+        case Nonterminal_Statement: return 2;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_1(token_type token, const value_type& value) {
+        switch(token) {
+        case token_eof:
+            // accept
+            accepted_ = true;
+            accepted_value_ = get_arg(1, 0);
+            return false;
+        case token_LBrace:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        default:
+            syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_1(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Statement: return 3;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_2(token_type token, const value_type& value) {
+        // reduce
+        return call_0_First(Nonterminal_Program, /*pop*/ 1, 0);
+    }
+
+    int gotof_2(Nonterminal nonterminal) {
+        assert(0);
+        return true;
+    }
+
+    bool state_3(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Next(Nonterminal_Program, /*pop*/ 2, 0, 1);
+    }
+
+    int gotof_4(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Statement: return 9;
+        case Nonterminal_Statements: return 5;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_5(token_type token, const value_type& value) {
+        switch(token) {
+        case token_LBrace:
+            // shift
+            push_stack(/*state*/ 4, value);
+            return false;
+        case token_Number:
+            // shift
+            push_stack(/*state*/ 6, value);
+            return false;
+        case token_RBrace:
+            // shift
+            push_stack(/*state*/ 8, value);
+            return false;
+        default:
+            syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    int gotof_5(Nonterminal nonterminal) {
+        switch(nonterminal) {
+        case Nonterminal_Statement: return 10;
+        default: assert(0); return false;
+        }
+    }
+
+    bool state_6(token_type token, const value_type& value) {
+        switch(token) {
+        case token_Semicolon:
+            // shift
+            push_stack(/*state*/ 7, value);
+            return false;
+        default:
+            syntax_error();
+            error_ = true;
+            return false;
+        }
+    }
+
+    bool state_7(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Simple(Nonterminal_Statement, /*pop*/ 2, 0);
+    }
+
+    bool state_8(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Block(Nonterminal_Statement, /*pop*/ 3, 1);
+    }
+
+    bool state_9(token_type token, const value_type& value) {
+        // reduce
+        return call_0_First(Nonterminal_Statements, /*pop*/ 1, 0);
+    }
+
+    bool state_10(token_type token, const value_type& value) {
+        // reduce
+        return call_0_Next(Nonterminal_Statements, /*pop*/ 2, 0, 1);
+    }
+
+    const table_entry* entry(int n) const {
+        static const table_entry entries[] = {
+            { &Parser::state_0, &Parser::gotof_0, false, false },
+            { &Parser::state_1, &Parser::gotof_1, false, false },
+            { &Parser::state_2, &Parser::gotof_2, false, true },
+            { &Parser::state_3, &Parser::gotof_2, false, true },
+            { &Parser::state_0, &Parser::gotof_4, false, false },
+            { &Parser::state_5, &Parser::gotof_5, false, false },
+            { &Parser::state_6, &Parser::gotof_2, false, false },
+            { &Parser::state_7, &Parser::gotof_2, false, true },
+            { &Parser::state_8, &Parser::gotof_2, false, true },
+            { &Parser::state_9, &Parser::gotof_2, false, true },
+            { &Parser::state_10, &Parser::gotof_2, false, true },
+        };
+        return &entries[n];
+    }
+
+};
+
+} // namespace sync
+
+#endif // #ifndef SYNC0_IPP_
+
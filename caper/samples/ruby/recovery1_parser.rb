@@ -0,0 +1,974 @@
+# This file was automatically generated by Caper.
+# (http://jonigata.github.io/caper/caper.html)
+
+module Calc
+    Token = {
+        token_eof: 0,
+        token_error: 1,
+        token_LParen: 2,
+        token_Minus: 3,
+        token_NewLine: 4,
+        token_Number: 5,
+        token_Plus: 6,
+        token_RParen: 7,
+        token_Slash: 8,
+        token_Star: 9,
+    }
+
+    def self.assert exp, msg = nil
+        if $DEBUG && !exp
+            if msg
+                fail msg
+            else
+                fail
+            end
+        end
+    end
+
+    def self.token_label token
+        self.assert Token.has_key? token
+        token.to_s
+    end
+
+    Nonterminal = {
+        AddExp: 0,
+        Input: 1,
+        Line: 2,
+        MulExp: 3,
+        PrimExp: 4,
+        UnaryExp: 5,
+    }
+
+    class Stack
+        attr_accessor :stack, :tmp, :gap
+
+        def initialize
+            @stack = []
+            @tmp = []
+            @gap = 0
+        end
+
+        def rollback_tmp
+            @gap = @stack.size
+            @tmp = []
+        end
+
+        def commit_tmp
+            @stack.slice! @gap, @stack.size - @gap
+            @stack.concat @tmp
+            @tmp = []
+            @gap = @stack.size
+        end
+
+        def push x
+            @tmp.push x
+            true
+        end
+
+        def pop n
+            if @tmp.size < n
+                n -= @tmp.size
+                @tmp = []
+                @gap -= n
+            else
+                @tmp.slice! @tmp.size - n, n
+            end
+        end
+
+        def top
+            Calc::assert 0 < depth
+            if @tmp.size != 0
+                @tmp[@tmp.size - 1]
+            else
+                @stack[@gap - 1]
+            end
+        end
+
+        def get_arg base, index
+            n = @tmp.size
+            if base - index <= n
+                @tmp[n - (base - index)]
+            else
+                @stack[@gap - (base - n) + index]
+            end
+        end
+
+        def clear
+            @stack = []
+            @tmp = []
+            @gap = 0
+        end
+
+        def empty?
+            if 0 < @tmp.size
+                false
+            else
+                @gap == 0
+            end
+        end
+
+        def depth
+            @gap + @tmp.size
+        end
+
+        def nth index
+            if @gap <= index
+                @tmp[index - @gap]
+            else
+                @stack[index]
+            end
+        end
+
+        def set_nth index, obj
+            if @gap <= index
+                @tmp[index - @gap] = obj
+            else
+                @stack[index] = obj
+            end
+        end
+
+        def swap_top_and_second
+            d = depth
+            Calc::assert 2 <= d
+            x = nth(d - 1)
+            set_nth d - 1, nth(d - 2)
+            set_nth d - 2, x
+        end
+    end
+
+    class StackFrame
+        attr_accessor :entry, :value, :sequence_length
+
+        def initialize entry, v, sl
+            @entry = entry
+            @value = v
+            @sequence_length = sl
+        end
+    end
+
+    class TableEntry
+        attr_accessor :state, :gotof, :handle_error
+
+        def initialize s, g, he
+            @state = s
+            @gotof = g
+            @handle_error = he
+        end
+    end
+
+    class Parser
+        attr_accessor :sa, :stack, :accepted, :error, :accepted_value
+
+        Entries = [
+            TableEntry.new(:state_0, :gotof_0, true),
+            TableEntry.new(:state_1, :gotof_1, true),
+            TableEntry.new(:state_2, :gotof_2, true),
+            TableEntry.new(:state_3, :gotof_3, true),
+            TableEntry.new(:state_4, :gotof_4, true),
+            TableEntry.new(:state_5, :gotof_5, false),
+            TableEntry.new(:state_6, :gotof_6, true),
+            TableEntry.new(:state_7, :gotof_7, false),
+            TableEntry.new(:state_8, :gotof_8, true),
+            TableEntry.new(:state_9, :gotof_9, false),
+            TableEntry.new(:state_10, :gotof_10, false),
+            TableEntry.new(:state_11, :gotof_11, false),
+            TableEntry.new(:state_12, :gotof_12, false),
+            TableEntry.new(:state_13, :gotof_13, false),
+            TableEntry.new(:state_14, :gotof_14, false),
+            TableEntry.new(:state_15, :gotof_15, false),
+            TableEntry.new(:state_16, :gotof_16, false),
+            TableEntry.new(:state_17, :gotof_17, false),
+            TableEntry.new(:state_18, :gotof_18, false),
+            TableEntry.new(:state_19, :gotof_19, false),
+            TableEntry.new(:state_20, :gotof_20, false),
+            TableEntry.new(:state_21, :gotof_21, false),
+            TableEntry.new(:state_22, :gotof_22, false),
+            TableEntry.new(:state_23, :gotof_23, false),
+            TableEntry.new(:state_24, :gotof_24, false),
+            TableEntry.new(:state_25, :gotof_25, false),
+        ]
+
+        def entry index
+            index = 0 if index.class == TrueClass || index.class == FalseClass
+            Entries[index]
+        end
+
+        def initialize sa
+            @sa = sa
+            reset
+        end
+
+        def reset
+            @error = @accepted = false
+            @accepted_value = nil
+            clear_stack
+            rollback_tmp_stack
+            if push_stack(0, nil, 0)
+                commit_tmp_stack
+            else
+                @sa.stack_overflow
+                @error = true
+            end
+        end
+
+        def post token, value
+            rollback_tmp_stack
+            @error = false
+            while method(stack_top.entry.state).call(token, value)
+                ;
+            end
+            if !@error
+                commit_tmp_stack
+            else
+                recover token, value
+            end
+            @accepted || @error
+        end
+
+        def accept
+            return nil if @error
+            return true if @accepted_value == nil
+            @accepted_value
+        end
+
+        def push_stack state_index, v = nil, sl = 0
+            f = @stack.push(StackFrame.new(entry(state_index), v, sl))
+            Calc::assert !@error
+            if !f
+                @error = true
+                @sa.stack_overflow
+            end
+            f
+        end
+
+        def pop_stack n
+            @stack.pop n
+        end
+
+        def stack_top
+            @stack.top
+        end
+
+        def get_arg base, index
+            @stack.get_arg(base, index).value
+        end
+
+        def clear_stack
+            @stack = Stack.new
+        end
+
+        def rollback_tmp_stack
+            @stack.rollback_tmp
+        end
+
+        def commit_tmp_stack
+            @stack.commit_tmp
+        end
+
+        def recover token, value
+            rollback_tmp_stack
+            @error = false
+            while !stack_top.entry.handle_error
+                pop_stack 1
+                if @stack.empty?
+                    @error = true;
+                    return;
+                end
+            end
+            # post error_token;
+            while method(stack_top.entry.state).call(:token_error, nil)
+                ;
+            end
+            commit_tmp_stack
+            # repost original token
+            # if it still causes error, discard it;
+            while method(stack_top.entry.state).call(token, value)
+                ;
+            end
+            commit_tmp_stack if !@error
+            @error = false if token != :token_eof
+        end
+
+        def call_nothing nonterminal, base
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, nil, 0
+        end
+
+        def call_0_DoLine1 nonterminal, base
+            v = @sa.upcast(@sa.DoLine1())
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoLine2 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoLine2(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoLine3 nonterminal, base
+            v = @sa.upcast(@sa.DoLine3())
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoAddExp1 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoAddExp1(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoAddExp2 nonterminal, base, arg_index0, arg_index1
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            arg1 = @sa.downcast(get_arg(base, arg_index1))
+            v = @sa.upcast(@sa.DoAddExp2(arg0, arg1))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoAddExp3 nonterminal, base, arg_index0, arg_index1
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            arg1 = @sa.downcast(get_arg(base, arg_index1))
+            v = @sa.upcast(@sa.DoAddExp3(arg0, arg1))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoMulExp1 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoMulExp1(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoMulExp2 nonterminal, base, arg_index0, arg_index1
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            arg1 = @sa.downcast(get_arg(base, arg_index1))
+            v = @sa.upcast(@sa.DoMulExp2(arg0, arg1))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoMulExp3 nonterminal, base, arg_index0, arg_index1
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            arg1 = @sa.downcast(get_arg(base, arg_index1))
+            v = @sa.upcast(@sa.DoMulExp3(arg0, arg1))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoUnaryExp1 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoUnaryExp1(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoUnaryExp2 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoUnaryExp2(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoPrimExp1 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoPrimExp1(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def call_0_DoPrimExp2 nonterminal, base, arg_index0
+            arg0 = @sa.downcast(get_arg(base, arg_index0))
+            v = @sa.upcast(@sa.DoPrimExp2(arg0))
+            pop_stack base
+            dest_index = method(stack_top.entry.gotof).call(nonterminal)
+            push_stack dest_index, v, 0
+        end
+
+        def state_0 token, value
+            case token
+            when :token_error
+                # shift
+                push_stack 7, value, 0
+                false
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_NewLine
+                # shift
+                push_stack 4, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_0 nonterminal
+            case nonterminal
+            when :AddExp
+                5
+            when :Input
+                1
+            when :Line
+                3
+            when :MulExp
+                10
+            when :PrimExp
+                22
+            when :UnaryExp
+                16
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_1 token, value
+            case token
+            when :token_eof
+                # accept
+                @accepted = true
+                @accepted_value = get_arg(1, 0)
+                false
+            when :token_error
+                # shift
+                push_stack 7, value, 0
+                false
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_NewLine
+                # shift
+                push_stack 4, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_1 nonterminal
+            case nonterminal
+            when :AddExp
+                5
+            when :Line
+                2
+            when :MulExp
+                10
+            when :PrimExp
+                22
+            when :UnaryExp
+                16
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_2 token, value
+            case token
+            when :token_eof, :token_error, :token_LParen, :token_Minus, :token_NewLine, :token_Number
+                # reduce
+                return call_nothing(:Input, 2)
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_2 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_3 token, value
+            case token
+            when :token_eof, :token_error, :token_LParen, :token_Minus, :token_NewLine, :token_Number
+                # reduce
+                return call_nothing(:Input, 1)
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_3 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_4 token, value
+            case token
+            when :token_eof, :token_error, :token_LParen, :token_Minus, :token_NewLine, :token_Number
+                # reduce
+                call_0_DoLine1 :Line, 1
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_4 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_5 token, value
+            case token
+            when :token_Minus
+                # shift
+                push_stack 14, value, 0
+                false
+            when :token_NewLine
+                # shift
+                push_stack 6, value, 0
+                false
+            when :token_Plus
+                # shift
+                push_stack 12, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_5 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_6 token, value
+            case token
+            when :token_eof, :token_error, :token_LParen, :token_Minus, :token_NewLine, :token_Number
+                # reduce
+                call_0_DoLine2 :Line, 2, 0
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_6 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_7 token, value
+            case token
+            when :token_NewLine
+                # shift
+                push_stack 8, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_7 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_8 token, value
+            case token
+            when :token_eof, :token_error, :token_LParen, :token_Minus, :token_NewLine, :token_Number
+                # reduce
+                call_0_DoLine3 :Line, 2
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_8 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_9 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_9 nonterminal
+            case nonterminal
+            when :AddExp
+                11
+            when :MulExp
+                10
+            when :PrimExp
+                22
+            when :UnaryExp
+                16
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_10 token, value
+            case token
+            when :token_Slash
+                # shift
+                push_stack 19, value, 0
+                false
+            when :token_Star
+                # shift
+                push_stack 17, value, 0
+                false
+            else
+                # reduce
+                call_0_DoAddExp1 :AddExp, 1, 0
+            end
+        end
+        def gotof_10 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_11 token, value
+            case token
+            when :token_Minus
+                # shift
+                push_stack 14, value, 0
+                false
+            when :token_Plus
+                # shift
+                push_stack 12, value, 0
+                false
+            when :token_RParen
+                # shift
+                push_stack 25, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_11 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_12 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_12 nonterminal
+            case nonterminal
+            when :MulExp
+                13
+            when :PrimExp
+                22
+            when :UnaryExp
+                16
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_13 token, value
+            case token
+            when :token_Slash
+                # shift
+                push_stack 19, value, 0
+                false
+            when :token_Star
+                # shift
+                push_stack 17, value, 0
+                false
+            else
+                # reduce
+                call_0_DoAddExp2 :AddExp, 3, 0, 2
+            end
+        end
+        def gotof_13 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_14 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_14 nonterminal
+            case nonterminal
+            when :MulExp
+                15
+            when :PrimExp
+                22
+            when :UnaryExp
+                16
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_15 token, value
+            case token
+            when :token_Slash
+                # shift
+                push_stack 19, value, 0
+                false
+            when :token_Star
+                # shift
+                push_stack 17, value, 0
+                false
+            else
+                # reduce
+                call_0_DoAddExp3 :AddExp, 3, 0, 2
+            end
+        end
+        def gotof_15 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_16 token, value
+                # reduce
+                call_0_DoMulExp1 :MulExp, 1, 0
+        end
+        def gotof_16 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_17 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_17 nonterminal
+            case nonterminal
+            when :PrimExp
+                22
+            when :UnaryExp
+                18
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_18 token, value
+                # reduce
+                call_0_DoMulExp2 :MulExp, 3, 0, 2
+        end
+        def gotof_18 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_19 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_19 nonterminal
+            case nonterminal
+            when :PrimExp
+                22
+            when :UnaryExp
+                20
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_20 token, value
+                # reduce
+                call_0_DoMulExp3 :MulExp, 3, 0, 2
+        end
+        def gotof_20 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_21 token, value
+            case token
+            when :token_LParen
+                # shift
+                push_stack 9, value, 0
+                false
+            when :token_Minus
+                # shift
+                push_stack 21, value, 0
+                false
+            when :token_Number
+                # shift
+                push_stack 24, value, 0
+                false
+            else
+                @sa.syntax_error
+                @error = true
+                false
+            end
+        end
+        def gotof_21 nonterminal
+            case nonterminal
+            when :PrimExp
+                22
+            when :UnaryExp
+                23
+            else
+                Calc::assert false
+                false
+            end
+        end
+
+        def state_22 token, value
+                # reduce
+                call_0_DoUnaryExp1 :UnaryExp, 1, 0
+        end
+        def gotof_22 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_23 token, value
+                # reduce
+                call_0_DoUnaryExp2 :UnaryExp, 2, 1
+        end
+        def gotof_23 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_24 token, value
+                # reduce
+                call_0_DoPrimExp1 :PrimExp, 1, 0
+        end
+        def gotof_24 nonterminal
+            Calc::assert false
+            true
+        end
+
+        def state_25 token, value
+                # reduce
+                call_0_DoPrimExp2 :PrimExp, 3, 1
+        end
+        def gotof_25 nonterminal
+            Calc::assert false
+            true
+        end
+
+    end
+end
@@ -0,0 +1,149 @@
+// synthetic grammar generator
+//   usage: gengrammar family n > file.cpg
+//   writes a grammar of about n rules (EBNF counted after expansion)
+//
+//   tower       operator precedence tower, n/2 levels
+//   wide        one nonterminal with n alternatives
+//   nullable    chain of n/2 nullable nonterminals
+//   ebnf        n/8 groups of '*', '+', '?' and '/' sequences
+//   conflict    n/6 LR(1) but not LALR(1) patterns
+//               (reduce/reduce conflicts after LALR merging)
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+std::string name(const char* prefix, int i) {
+    return prefix + std::to_string(i);
+}
+
+void tower(std::ostream& os, int n) {
+    int levels = std::max(1, n / 2 - 1);
+
+    os << "%token Number LParen RParen";
+    for (int i = 0 ; i < levels ; i++) { os << " " << name("Op", i); }
+    os << ";\n%namespace tower;\n\n";
+
+    for (int i = 0 ; i < levels ; i++) {
+        os << name("E", i) << "<int>\n"
+           << "    : [] " << name("E", i) << " " << name("Op", i) << " "
+           << name("E", i + 1) << "\n"
+           << "    | [] " << name("E", i + 1) << "\n"
+           << "    ;\n";
+    }
+    os << name("E", levels) << "<int>\n"
+       << "    : [] Number\n"
+       << "    | [] LParen E0 RParen\n"
+       << "    ;\n";
+}
+
+void wide(std::ostream& os, int n) {
+    // alternative i is the base k representation of i
+    int k = 2;
+    while (k * k * k < n) { k++; }
+
+    os << "%token";
+    for (int i = 0 ; i < k ; i++) { os << " " << name("T", i); }
+    os << ";\n%namespace wide;\n\nS<int>\n";
+    for (int i = 0 ; i < n ; i++) {
+        os << (i == 0 ? "    : [] " : "    | [] ")
+           << name("T", i / (k * k)) << " "
+           << name("T", i / k % k) << " "
+           << name("T", i % k) << "\n";
+    }
+    os << "    ;\n";
+}
+
+void nullable(std::ostream& os, int n) {
+    int length = std::max(1, n / 2);
+
+    os << "%token End";
+    for (int i = 0 ; i < length ; i++) { os << " " << name("T", i); }
+    os << ";\n%namespace nullable;\n\n"
+       << "S<int> : [] N0 End;\n";
+    for (int i = 0 ; i < length ; i++) {
+        os << name("N", i) << "<int>\n"
+           << "    : [] " << name("N", i + 1) << " " << name("T", i) << "\n"
+           << "    | []\n"
+           << "    ;\n";
+    }
+    os << name("N", length) << "<int> : [];\n";
+}
+
+void ebnf(std::ostream& os, int n) {
+    // 1 + 4 + 8 rules per group after expansion
+    int groups = std::max(1, n / 13);
+
+    os << "%token Comma P";
+    for (int i = 0 ; i < groups ; i++) {
+        os << " " << name("X", i) << " " << name("Y", i)
+           << " " << name("Z", i) << " " << name("W", i);
+    }
+    os << ";\n%namespace ebnf;\n%allow_ebnf;\n\nS<int>\n";
+    for (int i = 0 ; i < groups ; i++) {
+        os << (i == 0 ? "    : [] " : "    | [] ") << name("L", i) << "\n";
+    }
+    os << "    ;\n";
+    for (int i = 0 ; i < groups ; i++) {
+        std::string x = name("X", i);
+        std::string y = name("Y", i);
+        std::string z = name("Z", i);
+        std::string w = name("W", i);
+        os << name("L", i) << "<int>\n"
+           << "    : [] " << x << " P " << x << "*\n"
+           << "    | [] " << y << " P " << y << "+\n"
+           << "    | [] " << z << " P " << z << "?\n"
+           << "    | [] " << w << " P " << w << "/Comma\n"
+           << "    ;\n";
+    }
+}
+
+void conflict(std::ostream& os, int n) {
+    int patterns = std::max(1, n / 6);
+
+    os << "%token A B D E";
+    for (int i = 0 ; i < patterns ; i++) { os << " " << name("C", i); }
+    os << ";\n%namespace conflict;\n\nS<int>\n";
+    for (int i = 0 ; i < patterns ; i++) {
+        std::string x = name("X", i);
+        std::string y = name("Y", i);
+        os << (i == 0 ? "    : [] " : "    | [] ") << "A " << x << " D\n"
+           << "    | [] B " << y << " D\n"
+           << "    | [] A " << y << " E\n"
+           << "    | [] B " << x << " E\n";
+    }
+    os << "    ;\n";
+    for (int i = 0 ; i < patterns ; i++) {
+        os << name("X", i) << "<int> : [] " << name("C", i) << ";\n"
+           << name("Y", i) << "<int> : [] " << name("C", i) << ";\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::cerr << "usage: gengrammar "
+                  << "(tower | wide | nullable | ebnf | conflict) n"
+                  << std::endl;
+        return 1;
+    }
+
+    std::string family = argv[1];
+    int n = std::atoi(argv[2]);
+
+    if (family == "tower") {
+        tower(std::cout, n);
+    } else if (family == "wide") {
+        wide(std::cout, n);
+    } else if (family == "nullable") {
+        nullable(std::cout, n);
+    } else if (family == "ebnf") {
+        ebnf(std::cout, n);
+    } else if (family == "conflict") {
+        conflict(std::cout, n);
+    } else {
+        std::cerr << "gengrammar: unknown family: " << family << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,29 @@
+# plots of results-*.dat, written by "make bench"
+
+set terminal png size 1200,400
+set output "scaling.png"
+set multiplot layout 1,3
+set logscale xy
+set xlabel "rules"
+set key left top
+set grid
+
+files = system("ls results-*.dat")
+label(f) = substr(f, 9, strlen(f) - 4)
+
+set title "table construction time"
+set ylabel "seconds"
+plot for [f in files] f using 1:3 with linespoints title label(f), \
+     1e-4 * (x / 10) ** 2 with lines dashtype 2 title "O(n^2)", \
+     1e-4 * (x / 10) ** 3 with lines dashtype 3 title "O(n^3)"
+
+set title "states"
+set ylabel "states"
+plot for [f in files] f using 1:2 with linespoints title label(f), \
+     x with lines dashtype 2 title "O(n)"
+
+set title "peak memory"
+set ylabel "KiB"
+plot for [f in files] f using 1:4 with linespoints title label(f)
+
+unset multiplot
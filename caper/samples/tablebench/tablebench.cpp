@@ -0,0 +1,117 @@
+// table construction benchmark
+//   usage: tablebench [-lalr1] file.cpg [label]
+//   builds the table of file.cpg like caper does and prints
+//   "label algorithm rules states seconds peak_kb" (tab separated).
+//   conflicts are reported on stderr as usual.
+//   the grammar is not simplified, so that the families keep
+//   their shape (e.g. the X/Y pairs of "conflict" would be merged).
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <sys/resource.h>
+#include "caper_error.hpp"
+#include "caper_scanner.hpp"
+#include "caper_mapped_file.hpp"
+#include "caper_cpg.hpp"
+#include "caper_tgt.hpp"
+
+long peak_kb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return long(usage.ru_maxrss / 1024);
+#else
+    return long(usage.ru_maxrss);
+#endif
+}
+
+int main(int argc, const char** argv) {
+    std::string algorithm = "lalr1";
+    int index = 1;
+    if (index < argc && argv[index][0] == '-') {
+        algorithm = argv[index++] + 1;
+        if (algorithm != "lalr1") {
+            std::cerr << "tablebench: unknown algorithm: " << algorithm
+                      << std::endl;
+            return 1;
+        }
+    }
+    if (argc <= index) {
+        std::cerr << "tablebench: usage: tablebench [-lalr1] file.cpg [label]"
+                  << std::endl;
+        return 1;
+    }
+    std::string infile = argv[index++];
+    std::string label = index < argc ? argv[index] : infile;
+
+    mapped_file input(infile);
+    if (!input.is_open()) {
+        std::cerr << "tablebench: can't open input file '" << infile << "'"
+                  << std::endl;
+        return 1;
+    }
+
+    scanner s(input.begin(), input.end());
+
+    try {
+        cpg::parser p;
+        make_cpg_parser(p);
+
+        Token token = token_empty;
+        while (token != token_eof) {
+            value_type v;
+            token = s.get(v);
+            try {
+                p.push(token, v);
+            }
+            catch(zw::gr::syntax_error&) {
+                throw syntax_error(v.range.beg, token);
+            }
+        }
+
+        GenerateOptions options;
+        options.simplify = false;
+        std::map<std::string, Type> terminal_types;
+        std::map<std::string, Type> nonterminal_types;
+        collect_informations(
+            options,
+            terminal_types,
+            nonterminal_types,
+            p.accept_value());
+
+        tgt::parsing_table table;
+        std::map<std::string, size_t> token_id_map;
+        action_map_type actions;
+
+        auto t0 = std::chrono::steady_clock::now();
+        make_target_parser(
+            table,
+            token_id_map,
+            actions,
+            p.accept_value(),
+            options,
+            terminal_types,
+            nonterminal_types);
+        auto t1 = std::chrono::steady_clock::now();
+
+        std::cout << label << "\t"
+                  << algorithm << "\t"
+                  << table.get_grammar().size() << "\t"
+                  << table.states().size() << "\t"
+                  << std::chrono::duration<double>(t1 - t0).count() << "\t"
+                  << peak_kb() << std::endl;
+    }
+    catch(caper_error& e) {
+        std::cerr << "tablebench: " << e.what() << std::endl;
+        return 1;
+    }
+    catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,569 @@
+// table equivalence check
+//   usage: tablecheck file.cpg...
+//   builds the table of each file like caper does and checks that
+//     - the packed tables of the TableIR decode to the actions and
+//       gotos of the tgt table,
+//     - they agree with the cases the switch generators emit,
+//     - the arrays of the Java, JavaScript, C#, D, Ruby and PHP %table
+//       outputs are the packed tables (if the grammar is supported by
+//       them).
+//   prints "file states tokens classes action_slots goto_slots java js cs
+//   d rb php mismatches" for each file (tab separated; the languages are
+//   "ok" or "-" if not supported) and the mismatches themselves on stderr.
+//   exits with 1 if there is any.
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "caper_error.hpp"
+#include "caper_scanner.hpp"
+#include "caper_mapped_file.hpp"
+#include "caper_cpg.hpp"
+#include "caper_tgt.hpp"
+#include "caper_ir.hpp"
+#include "caper_finder.hpp"
+#include "caper_generate_java.hpp"
+#include "caper_generate_js.hpp"
+#include "caper_generate_csharp.hpp"
+#include "caper_generate_d.hpp"
+#include "caper_generate_ruby.hpp"
+#include "caper_generate_php.hpp"
+
+namespace {
+
+struct grammar_data {
+    GenerateOptions                 options;
+    std::map<std::string, Type>     terminal_types;
+    std::map<std::string, Type>     nonterminal_types;
+    tgt::parsing_table              table;
+    std::vector<std::string>        tokens;
+    action_map_type                 actions;
+    TableIR                         ir;
+};
+
+void load_grammar(const std::string& infile, grammar_data& g) {
+    mapped_file input(infile);
+    if (!input.is_open()) {
+        throw std::runtime_error("can't open input file '" + infile + "'");
+    }
+
+    scanner s(input.begin(), input.end());
+
+    cpg::parser p;
+    make_cpg_parser(p);
+
+    Token token = token_empty;
+    while (token != token_eof) {
+        value_type v;
+        token = s.get(v);
+        try {
+            p.push(token, v);
+        }
+        catch(zw::gr::syntax_error&) {
+            throw syntax_error(v.range.beg, token);
+        }
+    }
+
+    collect_informations(
+        g.options,
+        g.terminal_types,
+        g.nonterminal_types,
+        p.accept_value());
+
+    std::map<std::string, size_t> token_id_map;
+    make_target_parser(
+        g.table,
+        token_id_map,
+        g.actions,
+        p.accept_value(),
+        g.options,
+        g.terminal_types,
+        g.nonterminal_types);
+
+    g.tokens.resize(token_id_map.size());
+    for (const auto& x: token_id_map) {
+        g.tokens[x.second] = x.first;
+    }
+
+    make_table_ir(
+        g.ir, g.options, g.nonterminal_types, g.tokens, g.actions, g.table);
+}
+
+int decode_action(const TableIR& ir, int state, int token) {
+    int c = ir.token_class[token];
+    size_t i = size_t(ir.action_base[state] + c);
+    return ir.action_check[i] == c ?
+        ir.action_next[i] : ir.action_default[state];
+}
+
+int decode_goto(const TableIR& ir, int state, int nonterminal) {
+    size_t i = size_t(ir.goto_base[state] + nonterminal);
+    return ir.goto_check[i] == nonterminal ? ir.goto_next[i] : -1;
+}
+
+// a reduction by ir.rules[r] makes the same call as one by rule
+bool same_call(const grammar_data& g, int r, const tgt::rule& rule) {
+    const TableIR::Rule& x = g.ir.rules[r];
+    int nonterminal = rule == g.table.get_grammar().root_rule() ?
+        -1 : g.ir.nonterminal_index(rule.left().name());
+    if (x.nonterminal != nonterminal ||
+        x.length != int(rule.right().size())) {
+        return false;
+    }
+
+    auto k = finder(g.actions, rule);
+    if (!k || !x.action) { return !k && !x.action; }
+    return (*k).name == x.action->name &&
+        (*k).source_indices == x.action->source_indices;
+}
+
+// packed tables against the tgt table
+int check_tgt(const grammar_data& g) {
+    int errors = 0;
+    const TableIR& ir = g.ir;
+    for (const auto& state: g.table.states()) {
+        int default_code = ir.action_default[state.no];
+        if (state.handle_error && default_code != 3) {
+            std::cerr << "state " << state.no
+                      << ": handles error but has a default reduction"
+                      << std::endl;
+            errors++;
+        }
+        for (int t = 0 ; t < int(g.tokens.size()) ; t++) {
+            int code = decode_action(ir, state.no, t);
+            auto i = state.action_table.find(t);
+            bool ok = false;
+            if (i == state.action_table.end()) {
+                // the default reduction detects the error a bit later
+                ok = code == 3 || (code == default_code && (code & 3) == 1);
+            } else {
+                const auto& action = i->second;
+                switch (action.type) {
+                    case zw::gr::action_shift:
+                        ok = code == action.dest_index << 2;
+                        break;
+                    case zw::gr::action_reduce:
+                        ok = (code & 3) == 1 &&
+                            same_call(g, code >> 2, action.rule);
+                        break;
+                    case zw::gr::action_accept:
+                        ok = code == 2;
+                        break;
+                    case zw::gr::action_error:
+                        // %nonassoc, never reduced over
+                        ok = code == 3;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            if (!ok) {
+                std::cerr << "state " << state.no << " token "
+                          << g.tokens[t] << ": action " << code
+                          << " does not match the table" << std::endl;
+                errors++;
+            }
+        }
+
+        for (int n = 0 ; n < int(ir.nonterminals.size()) ; n++) {
+            int dest = decode_goto(ir, state.no, n);
+            int expected = -1;
+            for (const auto& pair: state.goto_table) {
+                if (pair.first.name() == ir.nonterminals[n]) {
+                    expected = pair.second;
+                }
+            }
+            if (dest != expected) {
+                std::cerr << "state " << state.no << " nonterminal "
+                          << ir.nonterminals[n] << ": goto " << dest
+                          << " does not match the table" << std::endl;
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+// packed tables against the cases of the switch generators
+int check_cases(const grammar_data& g) {
+    int errors = 0;
+    const TableIR& ir = g.ir;
+    for (const auto& state: ir.states) {
+        std::vector<int> expected(
+            ir.tokens.size(), action_code(state.default_action));
+        for (const auto& c: state.cases) {
+            for (int t: c.tokens) {
+                // %glr conflicts are packed as the adopted action
+                expected[t] = c.action.kind == TableIR::Conflict ?
+                    decode_action(ir, state.no, t) : action_code(c.action);
+            }
+        }
+        for (int t = 0 ; t < int(ir.tokens.size()) ; t++) {
+            int code = decode_action(ir, state.no, t);
+            if (code != expected[t]) {
+                std::cerr << "state " << state.no << " token "
+                          << ir.tokens[t] << ": action " << code
+                          << " does not match the switch case "
+                          << expected[t] << std::endl;
+                errors++;
+            }
+        }
+        for (const auto& pair: state.gotos) {
+            if (decode_goto(ir, state.no, pair.first) != pair.second) {
+                std::cerr << "state " << state.no << " nonterminal "
+                          << ir.nonterminals[pair.first]
+                          << ": goto does not match the switch case"
+                          << std::endl;
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+
+// values between open and close after head in generated source,
+//   as "var name = new Int16Array([1,2,...]);" in JavaScript output
+bool read_array(
+    const std::string&  src,
+    const std::string&  head,
+    const std::string&  open,
+    const std::string&  close,
+    std::vector<int>&   v) {
+    size_t i = src.find(head);
+    if (i == std::string::npos) { return false; }
+    i = src.find(open, i);
+    if (i == std::string::npos) { return false; }
+    i += open.size();
+    size_t e = src.find(close, i);
+    if (e == std::string::npos) { return false; }
+
+    std::string body = src.substr(i, e - i);
+    for (char& c: body) {
+        if (c == ',') { c = ' '; }
+    }
+    std::istringstream iss(body);
+    v.clear();
+    int x;
+    while (iss >> x) { v.push_back(x); }
+    return iss.eof();
+}
+
+struct emitted_array {
+    std::string             head;
+    const std::vector<int>* values;
+};
+
+struct rule_tables {
+    std::vector<int>    length;
+    std::vector<int>    nonterminal;
+    std::vector<int>    handle_error;
+
+    rule_tables(const TableIR& ir) {
+        for (const auto& rule: ir.rules) {
+            length.push_back(rule.length);
+            nonterminal.push_back(rule.nonterminal);
+        }
+        for (const auto& state: ir.states) {
+            handle_error.push_back(state.handle_error ? 1 : 0);
+        }
+    }
+};
+
+int check_arrays(
+    const char*                         language,
+    const std::string&                  src,
+    const std::vector<emitted_array>&   arrays,
+    const std::string&                  open,
+    const std::string&                  close) {
+    int errors = 0;
+    for (const auto& x: arrays) {
+        std::vector<int> v;
+        if (!read_array(src, x.head, open, close, v) || v != *x.values) {
+            std::cerr << language << ": '" << x.head
+                      << "' does not match the packed table" << std::endl;
+            errors++;
+        }
+    }
+    return errors;
+}
+
+// values of "private static final short[] NAME = unpackShort(n, "...");"
+//   in Java output, decoded as the parser does: one short per char, or
+//   one int per two chars (high half first), 4096 values per string
+//   constant. chars are written as \u or octal escapes.
+bool read_java_table(
+    const std::string&  src,
+    const std::string&  name,
+    std::vector<int>&   v) {
+    bool s = true;
+    size_t i = src.find("final short[] " + name + " = unpackShort(");
+    if (i == std::string::npos) {
+        s = false;
+        i = src.find("final int[] " + name + " = unpackInt(");
+        if (i == std::string::npos) { return false; }
+    }
+    i = src.find('(', i) + 1;
+    size_t e = src.find(");", i);
+    if (e == std::string::npos) { return false; }
+    size_t n = std::stoul(src.substr(i, e - i));
+
+    const size_t chunk = 4096;
+    std::vector<int> chars;
+    std::vector<size_t> chunks;
+    while ((i = src.find('"', i)) < e) {
+        size_t begin = chars.size();
+        for (i++ ; src[i] != '"' ; ) {
+            if (src[i] != '\\') {
+                chars.push_back((unsigned char)src[i++]);
+            } else if (src[i + 1] == 'u') {
+                chars.push_back(std::stoi(src.substr(i + 2, 4), nullptr, 16));
+                i += 6;
+            } else {
+                chars.push_back(std::stoi(src.substr(i + 1, 3), nullptr, 8));
+                i += 4;
+            }
+        }
+        chunks.push_back((chars.size() - begin) / (s ? 1 : 2));
+        i++;
+    }
+
+    v.clear();
+    if (s) {
+        for (int c: chars) { v.push_back(short(c)); }
+    } else {
+        for (size_t k = 0 ; k + 1 < chars.size() ; k += 2) {
+            v.push_back(int(unsigned(chars[k]) << 16 | chars[k + 1]));
+        }
+    }
+    for (size_t k = 0 ; k < chunks.size() ; k++) {
+        if (chunks[k] != (k + 1 < chunks.size() ? chunk : n - k * chunk)) {
+            return false;
+        }
+    }
+    return v.size() == n && (s || chars.size() == 2 * n);
+}
+
+// %table outputs against the packed tables
+//   check_* return -1 if the grammar is not supported by the output
+template <class Generator>
+bool generate_table(
+    const grammar_data& g, Generator generator, std::ostream& os) {
+    GenerateOptions options = g.options;
+    options.table = true;
+    try {
+        generator(
+            "", os, options, g.terminal_types, g.nonterminal_types,
+            g.tokens, g.actions, g.table, g.ir);
+    }
+    catch(unsupported_feature&) {
+        return false;
+    }
+    return true;
+}
+
+int check_java(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_java, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    std::vector<emitted_array> arrays = {
+        {"TOKEN_CLASS", &ir.token_class},
+        {"ACTION_BASE", &ir.action_base},
+        {"ACTION_CHECK", &ir.action_check},
+        {"ACTION_NEXT", &ir.action_next},
+        {"ACTION_DEFAULT", &ir.action_default},
+        {"GOTO_BASE", &ir.goto_base},
+        {"GOTO_CHECK", &ir.goto_check},
+        {"GOTO_NEXT", &ir.goto_next},
+        {"RULE_LENGTH", &rt.length},
+        {"RULE_NONTERMINAL", &rt.nonterminal},
+    };
+    std::string src = oss.str();
+    int errors = 0;
+    for (const auto& x: arrays) {
+        std::vector<int> v;
+        if (!read_java_table(src, x.head, v) || v != *x.values) {
+            std::cerr << "java: '" << x.head
+                      << "' does not match the packed table" << std::endl;
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int check_javascript(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_javascript, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    return check_arrays(
+        "javascript", oss.str(), {
+            {"var tokenClass = ", &ir.token_class},
+            {"var actionBase = ", &ir.action_base},
+            {"var actionCheck = ", &ir.action_check},
+            {"var actionNext = ", &ir.action_next},
+            {"var actionDefault = ", &ir.action_default},
+            {"var gotoBase = ", &ir.goto_base},
+            {"var gotoCheck = ", &ir.goto_check},
+            {"var gotoNext = ", &ir.goto_next},
+            {"var ruleLength = ", &rt.length},
+            {"var ruleNonterminal = ", &rt.nonterminal},
+            {"var handleError = ", &rt.handle_error},
+        },
+        "([", "]);");
+}
+
+int check_csharp(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_csharp, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    return check_arrays(
+        "csharp", oss.str(), {
+            {"> TokenClass => ", &ir.token_class},
+            {"> ActionBase => ", &ir.action_base},
+            {"> ActionCheck => ", &ir.action_check},
+            {"> ActionNext => ", &ir.action_next},
+            {"> ActionDefault => ", &ir.action_default},
+            {"> GotoBase => ", &ir.goto_base},
+            {"> GotoCheck => ", &ir.goto_check},
+            {"> GotoNext => ", &ir.goto_next},
+            {"> RuleLength => ", &rt.length},
+            {"> RuleNonterminal => ", &rt.nonterminal},
+        },
+        "[] {", "};");
+}
+
+int check_d(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_d, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    return check_arrays(
+        "d", oss.str(), {
+            {"] tokenClass = ", &ir.token_class},
+            {"] actionBase = ", &ir.action_base},
+            {"] actionCheck = ", &ir.action_check},
+            {"] actionNext = ", &ir.action_next},
+            {"] actionDefault = ", &ir.action_default},
+            {"] gotoBase = ", &ir.goto_base},
+            {"] gotoCheck = ", &ir.goto_check},
+            {"] gotoNext = ", &ir.goto_next},
+            {"] ruleLength = ", &rt.length},
+            {"] ruleNonterminal = ", &rt.nonterminal},
+            {"] handleError = ", &rt.handle_error},
+        },
+        "[", "];");
+}
+
+int check_ruby(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_ruby, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    return check_arrays(
+        "ruby", oss.str(), {
+            {" TokenClass = ", &ir.token_class},
+            {" ActionBase = ", &ir.action_base},
+            {" ActionCheck = ", &ir.action_check},
+            {" ActionNext = ", &ir.action_next},
+            {" ActionDefault = ", &ir.action_default},
+            {" GotoBase = ", &ir.goto_base},
+            {" GotoCheck = ", &ir.goto_check},
+            {" GotoNext = ", &ir.goto_next},
+            {" RuleLength = ", &rt.length},
+            {" RuleNonterminal = ", &rt.nonterminal},
+            {" HandleError = ", &rt.handle_error},
+        },
+        "[", "].freeze");
+}
+
+int check_php(const grammar_data& g) {
+    std::ostringstream oss;
+    if (!generate_table(g, generate_php, oss)) { return -1; }
+
+    const TableIR& ir = g.ir;
+    rule_tables rt(ir);
+    return check_arrays(
+        "php", oss.str(), {
+            {"const TOKEN_CLASS = ", &ir.token_class},
+            {"const ACTION_BASE = ", &ir.action_base},
+            {"const ACTION_CHECK = ", &ir.action_check},
+            {"const ACTION_NEXT = ", &ir.action_next},
+            {"const ACTION_DEFAULT = ", &ir.action_default},
+            {"const GOTO_BASE = ", &ir.goto_base},
+            {"const GOTO_CHECK = ", &ir.goto_check},
+            {"const GOTO_NEXT = ", &ir.goto_next},
+            {"const RULE_LENGTH = ", &rt.length},
+            {"const RULE_NONTERMINAL = ", &rt.nonterminal},
+            {"const HANDLE_ERROR = ", &rt.handle_error},
+        },
+        "array(", ");");
+}
+
+} // unnamed namespace
+
+int main(int argc, const char** argv) {
+    if (argc < 2) {
+        std::cerr << "tablecheck: usage: tablecheck file.cpg..."
+                  << std::endl;
+        return 1;
+    }
+
+    int failed = 0;
+    for (int i = 1 ; i < argc ; i++) {
+        std::string infile = argv[i];
+        try {
+            grammar_data g;
+            load_grammar(infile, g);
+
+            int errors = check_tgt(g) + check_cases(g);
+            int java = check_java(g);
+            if (0 < java) { errors += java; }
+            int js = check_javascript(g);
+            if (0 < js) { errors += js; }
+            int cs = check_csharp(g);
+            if (0 < cs) { errors += cs; }
+            int d = check_d(g);
+            if (0 < d) { errors += d; }
+            int rb = check_ruby(g);
+            if (0 < rb) { errors += rb; }
+            int php = check_php(g);
+            if (0 < php) { errors += php; }
+
+            std::cout << infile << "\t"
+                      << g.ir.states.size() << "\t"
+                      << g.ir.tokens.size() << "\t"
+                      << g.ir.class_count << "\t"
+                      << g.ir.action_next.size() << "\t"
+                      << g.ir.goto_next.size() << "\t"
+                      << (java < 0 ? "-" : "ok") << "\t"
+                      << (js < 0 ? "-" : "ok") << "\t"
+                      << (cs < 0 ? "-" : "ok") << "\t"
+                      << (d < 0 ? "-" : "ok") << "\t"
+                      << (rb < 0 ? "-" : "ok") << "\t"
+                      << (php < 0 ? "-" : "ok") << "\t"
+                      << errors << std::endl;
+            if (errors) {
+                failed++;
+            }
+        }
+        catch(caper_error& e) {
+            std::cerr << "tablecheck: " << infile << ": " << e.what()
+                      << std::endl;
+            failed++;
+        }
+        catch(std::exception& e) {
+            std::cerr << "tablecheck: " << infile << ": " << e.what()
+                      << std::endl;
+            failed++;
+        }
+    }
+
+    return failed ? 1 : 0;
+}